@@ -26,6 +26,8 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "boosting_stump_ensemble.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -49,6 +51,39 @@ void BoostingPredictKernel<algorithmFPType, cpu>::compute(services::SharedPtr<Nu
     const algorithmFPType zero = (algorithmFPType)0.0;
     const algorithmFPType one  = (algorithmFPType)1.0;
 
+    /* If all weak learners are decision stumps predicted by the stump prediction algorithm,
+       the whole ensemble is evaluated on blocks of observations in parallel */
+    boosting::internal::StumpEnsemble<algorithmFPType, cpu> stumps;
+    if (boosting::internal::StumpEnsemble<algorithmFPType, cpu>::isStumpPrediction(parameter->weakLearnerPrediction.get()) &&
+        stumps.init(boostModel, nWeakLearners))
+    {
+        for (size_t i = 0; i < nWeakLearners; i++)
+        {
+            stumps.leftValue[i]  = ((stumps.leftValue[i]  > zero) ? alpha[i] : -alpha[i]);
+            stumps.rightValue[i] = ((stumps.rightValue[i] > zero) ? alpha[i] : -alpha[i]);
+        }
+
+        const size_t nFeatures = xTable->getNumberOfColumns();
+        const size_t blockSize = boosting::internal::stumpEnsembleRowBlockSize;
+        const size_t nBlocks = nVectors / blockSize + (nVectors % blockSize > 0 ? 1 : 0);
+        daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+        {
+            const size_t i0 = iBlock * blockSize;
+            const size_t nRows = (i0 + blockSize < nVectors ? blockSize : nVectors - i0);
+
+            BlockDescriptor<algorithmFPType> xBlock;
+            xTable->getBlockOfRows(i0, nRows, readOnly, xBlock);
+            algorithmFPType *rBlock = r + i0;
+            for (size_t j = 0; j < nRows; j++)
+            {
+                rBlock[j] = zero;
+            }
+            stumps.addResponses(xBlock.getBlockPtr(), nRows, nFeatures, rBlock);
+            xTable->releaseBlockOfRows(xBlock);
+        } );
+        return;
+    }
+
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > rWeakTable(
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(1, nVectors));
     algorithmFPType *rWeak = rWeakTable->getArray();
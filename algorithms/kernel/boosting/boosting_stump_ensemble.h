@@ -0,0 +1,164 @@
+/* file: boosting_stump_ensemble.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Decision stumps of a boosting model flattened for the fused evaluation
+//  of the whole ensemble on blocks of observations.
+//--
+*/
+
+#ifndef __BOOSTING_STUMP_ENSEMBLE_H__
+#define __BOOSTING_STUMP_ENSEMBLE_H__
+
+#include <typeinfo>
+#include "stump_model.h"
+#include "stump_predict.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+#include "service_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace boosting
+{
+namespace internal
+{
+
+const size_t stumpEnsembleRowBlockSize = 256;   /* Number of observations processed by one task */
+
+/**
+ *  \brief Parameters of the decision stumps stored as structure of arrays:
+ *         the observation gets leftValue[i] from the i-th stump if its splitFeature[i]-th feature
+ *         is less than splitValue[i] and rightValue[i] otherwise
+ */
+template <typename algorithmFPType, CpuType cpu>
+class StumpEnsemble
+{
+public:
+    StumpEnsemble() : nStumps(0), splitFeature(NULL), splitValue(NULL), leftValue(NULL), rightValue(NULL) {}
+
+    ~StumpEnsemble()
+    {
+        daal::services::daal_free(splitFeature);
+        daal::services::daal_free(splitValue);
+        daal::services::daal_free(leftValue);
+        daal::services::daal_free(rightValue);
+    }
+
+    /**
+     *  Checks that the weak learner prediction algorithm is the decision stump prediction of the library,
+     *  the only one the fused evaluation is equivalent to. Other algorithms, including the ones derived from it, are run as set
+     */
+    static bool isStumpPrediction(const weak_learner::prediction::Batch *predict)
+    {
+        if (!predict) { return false; }
+        return (typeid(*predict) == typeid(stump::prediction::Batch<float,  stump::prediction::defaultDense>) ||
+                typeid(*predict) == typeid(stump::prediction::Batch<double, stump::prediction::defaultDense>));
+    }
+
+    /**
+     *  Copies the parameters of the weak learners of the boosting model
+     *  \return false if one of the weak learners is not a decision stump or the memory allocation failed
+     */
+    template <typename BoostingModel>
+    bool init(BoostingModel *model, size_t nWeakLearners)
+    {
+        const size_t n = (nWeakLearners > 0 ? nWeakLearners : 1);
+        splitFeature = (int *)daal::services::daal_malloc(n * sizeof(int));
+        splitValue   = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+        leftValue    = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+        rightValue   = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+        if (!splitFeature || !splitValue || !leftValue || !rightValue) { return false; }
+
+        for (size_t i = 0; i < nWeakLearners; i++)
+        {
+            services::SharedPtr<weak_learner::Model> learnerModel = model->getWeakLearnerModel(i);
+            stump::Model *stumpModel = dynamic_cast<stump::Model *>(learnerModel.get());
+            if (!stumpModel || !stumpModel->values) { return false; }
+
+            algorithmFPType *values;
+            daal::internal::BlockMicroTable<algorithmFPType, readOnly, cpu> mtValues(stumpModel->values.get());
+            mtValues.getBlockOfRows(0, 1, &values);
+            splitFeature[i] = (int)stumpModel->splitFeature;
+            splitValue[i]   = values[0];
+            leftValue[i]    = values[1];
+            rightValue[i]   = values[2];
+            mtValues.release();
+        }
+        nStumps = nWeakLearners;
+        return true;
+    }
+
+    /**
+     *  Computes the responses of the i-th stump for the block of observations
+     *  \param[in]  i           Index of the stump
+     *  \param[in]  x           Block of observations stored row by row
+     *  \param[in]  nRows       Number of observations in the block
+     *  \param[in]  nFeatures   Number of features
+     *  \param[out] r           Responses of the stump
+     */
+    void computeResponses(size_t i, const algorithmFPType *x, size_t nRows, size_t nFeatures, algorithmFPType *r) const
+    {
+        const algorithmFPType *xf = x + splitFeature[i];
+        const algorithmFPType split = splitValue[i];
+        const algorithmFPType left  = leftValue[i];
+        const algorithmFPType right = rightValue[i];
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nRows; j++)
+        {
+            r[j] = (xf[j * nFeatures] < split ? left : right);
+        }
+    }
+
+    /**
+     *  Adds the responses of all stumps to the responses of the block of observations.
+     *  The stumps are applied one by one, so the sums are accumulated in the order of the weak learners
+     */
+    void addResponses(const algorithmFPType *x, size_t nRows, size_t nFeatures, algorithmFPType *r) const
+    {
+        for (size_t i = 0; i < nStumps; i++)
+        {
+            const algorithmFPType *xf = x + splitFeature[i];
+            const algorithmFPType split = splitValue[i];
+            const algorithmFPType left  = leftValue[i];
+            const algorithmFPType right = rightValue[i];
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nRows; j++)
+            {
+                r[j] += (xf[j * nFeatures] < split ? left : right);
+            }
+        }
+    }
+
+    size_t nStumps;
+    int *splitFeature;
+    algorithmFPType *splitValue;
+    algorithmFPType *leftValue;
+    algorithmFPType *rightValue;
+};
+
+} // namespace internal
+} // namespace boosting
+} // namespace algorithms
+} // namespace daal
+
+#endif
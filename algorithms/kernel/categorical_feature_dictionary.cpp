@@ -0,0 +1,355 @@
+/* file: categorical_feature_dictionary.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the concurrent dictionary of categorical feature values.
+//
+//  The categories are stored in the std::map base of the dictionary. The hash table
+//  caches the indices of the categories found by insert() and find(value, length).
+//  Values are distributed among shards by the high bits of their hash.
+//  Every shard is an open-addressing table with linear probing.
+//  Lookups do not take locks, insertions lock only the shard of the value
+//  and then the map. Tables replaced during growth are kept until the dictionary
+//  is destroyed, so concurrent lookups never access released memory.
+//--
+*/
+
+#include <cstring>
+#include "data_management/data/data_dictionary.h"
+#include "services/daal_memory.h"
+#include "tbb/atomic.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+namespace
+{
+
+typedef unsigned long long HashType;
+
+const size_t nShardsBits      = 6;
+const size_t nShards          = (size_t)1 << nShardsBits;
+const size_t initialCapacity  = 16;
+
+struct Entry
+{
+    HashType hash;
+    size_t length;
+    int index;
+    char value[1];
+};
+
+struct HashTable
+{
+    size_t capacity;
+    tbb::atomic<Entry *> *slots;
+    HashTable *retired;
+};
+
+struct Shard
+{
+    tbb::atomic<HashTable *> table;
+    tbb::atomic<int> lock;
+    size_t count;
+};
+
+struct DictionaryImpl
+{
+    Shard shards[nShards];
+    tbb::atomic<int> mapLock;
+};
+
+typedef CategoricalFeatureDictionary::MapType MapType;
+
+/* 64-bit FNV-1a hash of the value */
+inline HashType computeHash(const char *value, size_t length)
+{
+    HashType hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)value[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+inline Shard &getShard(DictionaryImpl *dict, HashType hash)
+{
+    return dict->shards[hash >> (sizeof(HashType) * 8 - nShardsBits)];
+}
+
+inline bool isEqual(const Entry *entry, HashType hash, const char *value, size_t length)
+{
+    return entry->hash == hash && entry->length == length && (length == 0 || memcmp(entry->value, value, length) == 0);
+}
+
+HashTable *createTable(size_t capacity)
+{
+    HashTable *table = (HashTable *)daal::services::daal_malloc(sizeof(HashTable));
+    if(!table) { return 0; }
+    table->slots = (tbb::atomic<Entry *> *)daal::services::daal_malloc(capacity * sizeof(tbb::atomic<Entry *>));
+    if(!table->slots)
+    {
+        daal::services::daal_free(table);
+        return 0;
+    }
+    for(size_t i = 0; i < capacity; i++)
+    {
+        table->slots[i] = 0;
+    }
+    table->capacity = capacity;
+    table->retired = 0;
+    return table;
+}
+
+/* Returns the slot that contains the value or the empty slot where the value should be placed */
+inline tbb::atomic<Entry *> *probe(const HashTable *table, HashType hash, const char *value, size_t length)
+{
+    const size_t mask = table->capacity - 1;
+    for(size_t i = (size_t)hash & mask; ; i = (i + 1) & mask)
+    {
+        Entry *entry = table->slots[i];
+        if(!entry || isEqual(entry, hash, value, length))
+        {
+            return table->slots + i;
+        }
+    }
+}
+
+/* Rehashes the entries of the shard into the table of the doubled capacity. Called under the shard lock */
+bool grow(Shard &shard)
+{
+    HashTable *oldTable = shard.table;
+    HashTable *newTable = createTable(oldTable->capacity * 2);
+    if(!newTable) { return false; }
+
+    const size_t mask = newTable->capacity - 1;
+    for(size_t i = 0; i < oldTable->capacity; i++)
+    {
+        Entry *entry = oldTable->slots[i];
+        if(!entry) { continue; }
+        size_t j = (size_t)entry->hash & mask;
+        while(newTable->slots[j]) { j = (j + 1) & mask; }
+        newTable->slots[j] = entry;
+    }
+    newTable->retired = oldTable;
+    shard.table = newTable;
+    return true;
+}
+
+inline void lockShard(Shard &shard)
+{
+    while(shard.lock.compare_and_swap(1, 0) != 0) {}
+}
+
+inline void unlockShard(Shard &shard)
+{
+    shard.lock = 0;
+}
+
+inline void lockMap(DictionaryImpl *dict)
+{
+    while(dict->mapLock.compare_and_swap(1, 0) != 0) {}
+}
+
+inline void unlockMap(DictionaryImpl *dict)
+{
+    dict->mapLock = 0;
+}
+
+DictionaryImpl *createImpl()
+{
+    DictionaryImpl *dict = new DictionaryImpl;
+    for(size_t i = 0; i < nShards; i++)
+    {
+        dict->shards[i].table = 0;
+        dict->shards[i].lock  = 0;
+        dict->shards[i].count = 0;
+    }
+    dict->mapLock = 0;
+    return dict;
+}
+
+/* Releases the entries and the tables of the shards */
+void clearImpl(DictionaryImpl *dict)
+{
+    for(size_t i = 0; i < nShards; i++)
+    {
+        HashTable *table = dict->shards[i].table;
+        if(table)
+        {
+            for(size_t j = 0; j < table->capacity; j++)
+            {
+                Entry *entry = table->slots[j];
+                if(entry) { daal::services::daal_free(entry); }
+            }
+        }
+        while(table)
+        {
+            HashTable *retired = table->retired;
+            daal::services::daal_free(table->slots);
+            daal::services::daal_free(table);
+            table = retired;
+        }
+        dict->shards[i].table = 0;
+        dict->shards[i].count = 0;
+    }
+}
+
+/* Returns the index of the category in the map, the category is added to the map if it is not there yet */
+int insertIntoMap(DictionaryImpl *dict, MapType &map, const char *value, size_t length)
+{
+    lockMap(dict);
+    std::pair<MapType::iterator, bool> result =
+        map.insert(MapType::value_type(std::string(value, length), std::pair<int, int>((int)map.size(), 1)));
+    int index = result.first->second.first;
+    unlockMap(dict);
+    return index;
+}
+
+int insertIntoShard(DictionaryImpl *dict, MapType &map, Shard &shard, HashType hash, const char *value, size_t length)
+{
+    lockShard(shard);
+
+    if(!shard.table)
+    {
+        shard.table = createTable(initialCapacity);
+        if(!shard.table)
+        {
+            unlockShard(shard);
+            return -1;
+        }
+    }
+
+    tbb::atomic<Entry *> *slot = probe(shard.table, hash, value, length);
+    Entry *entry = *slot;
+    if(entry)
+    {
+        unlockShard(shard);
+        return entry->index;
+    }
+
+    /* Keep the load factor of the table below one half */
+    if(2 * (shard.count + 1) > shard.table->capacity)
+    {
+        if(!grow(shard))
+        {
+            unlockShard(shard);
+            return -1;
+        }
+        slot = probe(shard.table, hash, value, length);
+    }
+
+    entry = (Entry *)daal::services::daal_malloc(sizeof(Entry) + length);
+    if(!entry)
+    {
+        unlockShard(shard);
+        return -1;
+    }
+    entry->hash   = hash;
+    entry->length = length;
+    if(length) { memcpy(entry->value, value, length); }
+    entry->value[length] = '\0';
+    entry->index = insertIntoMap(dict, map, value, length);
+
+    /* Publishes the initialized entry to the lock-free readers */
+    *slot = entry;
+    shard.count++;
+
+    unlockShard(shard);
+    return entry->index;
+}
+
+} // namespace
+
+CategoricalFeatureDictionary::CategoricalFeatureDictionary() : _ptr(createImpl()) {}
+
+CategoricalFeatureDictionary::CategoricalFeatureDictionary(const CategoricalFeatureDictionary &other) :
+    MapType(other), _ptr(createImpl()) {}
+
+CategoricalFeatureDictionary &CategoricalFeatureDictionary::operator= (const CategoricalFeatureDictionary &other)
+{
+    if(this != &other)
+    {
+        /* The indices cached in the hash table may differ from the copied ones */
+        clearImpl((DictionaryImpl *)_ptr);
+        MapType::operator= (other);
+    }
+    return *this;
+}
+
+CategoricalFeatureDictionary::~CategoricalFeatureDictionary()
+{
+    DictionaryImpl *dict = (DictionaryImpl *)_ptr;
+    clearImpl(dict);
+    delete dict;
+}
+
+int CategoricalFeatureDictionary::insert(const char *value, size_t length)
+{
+    DictionaryImpl *dict = (DictionaryImpl *)_ptr;
+    HashType hash = computeHash(value, length);
+    Shard &shard = getShard(dict, hash);
+
+    /* Most of the values are already in the dictionary, try to find them without locking */
+    HashTable *table = shard.table;
+    if(table)
+    {
+        Entry *entry = *probe(table, hash, value, length);
+        if(entry) { return entry->index; }
+    }
+    return insertIntoShard(dict, *this, shard, hash, value, length);
+}
+
+int CategoricalFeatureDictionary::find(const char *value, size_t length) const
+{
+    DictionaryImpl *dict = (DictionaryImpl *)_ptr;
+    HashType hash = computeHash(value, length);
+    HashTable *table = getShard(dict, hash).table;
+    if(table)
+    {
+        Entry *entry = *probe(table, hash, value, length);
+        if(entry) { return entry->index; }
+    }
+
+    /* The category may be added by the methods of std::map */
+    lockMap(dict);
+    MapType::const_iterator it = MapType::find(std::string(value, length));
+    int index = (it != end() ? it->second.first : -1);
+    unlockMap(dict);
+    return index;
+}
+
+CategoricalFeatureDictionary *CategoricalFeatureDictionary::create(CategoricalFeatureDictionary *&dict)
+{
+    CategoricalFeatureDictionary *newDict = new CategoricalFeatureDictionary;
+    CategoricalFeatureDictionary *oldDict = tbb::internal::as_atomic(dict).compare_and_swap(newDict, 0);
+    if(oldDict)
+    {
+        delete newDict;
+        return oldDict;
+    }
+    return newDict;
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -24,8 +24,10 @@
 #include "service_micro_table.h"
 #include "service_math.h"
 #include "service_memory.h"
+#include "service_defines.h"
+#include "service_distance_tiles.h"
 #include "daal_defines.h"
-#include "service_blas.h"
+#include "threading.h"
 
 using namespace daal::internal;
 
@@ -40,112 +42,198 @@ namespace internal
 template <typename algorithmFPType, CpuType cpu> bool isFull(NumericTableIface::StorageLayout layout);
 template <typename algorithmFPType, CpuType cpu> bool isUpper(NumericTableIface::StorageLayout layout);
 template <typename algorithmFPType, CpuType cpu> bool isLower(NumericTableIface::StorageLayout layout);
+
+const size_t blockSizeDefault = 128;    /* Number of rows in a tile of the distance matrix */
+
 /**
- *  \brief Kernel for Cosine distances calculation
+ *  \brief Kernel for Cosine distances calculation.
+ *         The distance matrix is computed by square tiles of blockSizeDefault rows that are written directly
+ *         into the result table. Tiles of the lower triangle are processed in parallel,
+ *         the dot products of the tile of the dense input data are computed by BLAS gemm.
+ *         Input data in the CSR layout is processed without conversion to the dense layout
  */
 template<typename algorithmFPType, Method method, CpuType cpu>
 void DistanceKernel<algorithmFPType, method, cpu>::compute(const size_t na, const NumericTable *const *a,
                                                            const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
 {
     NumericTable *xTable = const_cast<NumericTable *>( a[0] );  /* Input data */
-    MKL_INT n   = (MKL_INT)(xTable->getNumberOfRows());         /* Number of input feature vectors */
-    MKL_INT p   = (MKL_INT)(xTable->getNumberOfColumns());      /* Number of input vector dimension */
+    size_t n = xTable->getNumberOfRows();                       /* Number of input feature vectors */
+    size_t p = xTable->getNumberOfColumns();                    /* Number of input vector dimension */
     NumericTableIface::StorageLayout rLayout = r[0]->getDataLayout();
 
-    algorithmFPType *x;      /* Input data           */
-    algorithmFPType *d;      /* Resulting distances  */
-    algorithmFPType *xxt;    /* Buffer for algorithmFPTypeediate results */
-
-    xxt = (algorithmFPType *)daal::services::daal_malloc(n * n * sizeof(algorithmFPType));
-    if (!xxt) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
-
-    BlockMicroTable<algorithmFPType, readOnly, cpu> *aMicroTable  =
-        new BlockMicroTable<algorithmFPType, readOnly, cpu>(xTable);
-    aMicroTable->getBlockOfRows(0, n, &x);
+    const bool isFullLayout  = isFull<algorithmFPType, cpu>(rLayout);
+    const bool isLowerLayout = isLower<algorithmFPType, cpu>(rLayout);
+    const bool isUpperLayout = isUpper<algorithmFPType, cpu>(rLayout);
+    if (!isFullLayout && !isLowerLayout && !isUpperLayout)
+    {
+        this->_errors->add(services::ErrorIncorrectTypeOfOutputNumericTable); return;
+    }
 
-    char uplo, trans;
-    algorithmFPType alpha, beta;
-    /* Calculate X*X' */
-    uplo  = 'U';
-    trans = 'T';
-    alpha = 1.0;
-    beta  = 0.0;
-    Blas<algorithmFPType, cpu>::xsyrk(&uplo, &trans, &n, &p, &alpha, x, &p, &beta, xxt, &n);
+    const bool isCSR = (xTable->getDataLayout() == NumericTableIface::csrArray);
 
-    aMicroTable->release();
-    delete aMicroTable;
+    algorithmFPType *x = NULL;          /* Input data           */
+    algorithmFPType *values = NULL;     /* Input data in the CSR layout */
+    size_t *colIndices = NULL, *rowOffsets = NULL;
+    algorithmFPType *d;                 /* Resulting distances  */
+    algorithmFPType *normInv = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+    if (!normInv) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    algorithmFPType one = (algorithmFPType)1.0;
-    for (size_t i = 0; i < n; i++)
+    BlockMicroTable<algorithmFPType, readOnly, cpu> aMicroTable(xTable);
+    CSRBlockMicroTable<algorithmFPType, readOnly, cpu> aCSRMicroTable(xTable);
+    if (isCSR)
     {
-        if (xxt[i * n + i] != 0.0)
-        {
-            xxt[i * n + i] = one / sSqrt<cpu>(xxt[i * n + i]);
-        }
+        aCSRMicroTable.getSparseBlock(0, n, &values, &colIndices, &rowOffsets);
+    }
+    else
+    {
+        aMicroTable.getBlockOfRows(0, n, &x);
     }
 
-    if(isFull<algorithmFPType, cpu>(rLayout))
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> rMicroTable(r[0]);
+    PackedArrayMicroTable<algorithmFPType, writeOnly, cpu> rPackedMicroTable(r[0]);
+    if (isFullLayout)
     {
-        BlockMicroTable<algorithmFPType, writeOnly, cpu> *rMicroTable = new BlockMicroTable<algorithmFPType, writeOnly, cpu>
-        (r[0]);
-        rMicroTable->getBlockOfRows(0, n, &d);
+        rMicroTable.getBlockOfRows(0, n, &d);
+    }
+    else
+    {
+        rPackedMicroTable.getPackedArray(&d);
+    }
 
-        /* Pack the results into output array */
-        for (size_t i = 0; i < n; i++)
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType one  = (algorithmFPType)1.0;
+    const size_t blockSize = blockSizeDefault;
+    const size_t nBlocks   = n / blockSize + (n % blockSize > 0 ? 1 : 0);
+
+    /* Compute inversed norms of the feature vectors */
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        size_t i1 = (iBlock + 1) * blockSize;
+        if (i1 > n) { i1 = n; }
+        for (size_t i = iBlock * blockSize; i < i1; i++)
         {
-            for (size_t j = 0; j < i; j++)
+            algorithmFPType sum = zero;
+            if (isCSR)
+            {
+                for (size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+                {
+                    sum += values[k] * values[k];
+                }
+            }
+            else
             {
-                d[i * n + j] = one - xxt[i * n + j] * xxt[i * n + i] * xxt[j * n + j];
-                d[j * n + i] = d[i * n + j];
+                const algorithmFPType *xi = x + i * p;
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k < p; k++)
+                {
+                    sum += xi[k] * xi[k];
+                }
             }
-            d[i * n + i] = one;
+            normInv[i] = (sum != zero ? one / sSqrt<cpu>(sum) : zero);
         }
+    } );
 
-        rMicroTable->release();
-        delete rMicroTable;
-    }
-    else
+    /* In the CSR case the buffer of the tile is followed by the dense vector of p zeros for the scattered row */
+    daal::tls<algorithmFPType *> tileBuffer( [=]()-> algorithmFPType *
     {
-        PackedArrayMicroTable<algorithmFPType, writeOnly, cpu> *rPackedMicroTable =
-            new PackedArrayMicroTable<algorithmFPType, writeOnly, cpu>
-        (r[0]);
-        rPackedMicroTable->getPackedArray(&d);
+        return daal::services::internal::service_calloc<algorithmFPType, cpu>(blockSize * blockSize + (isCSR ? p : 0));
+    } );
+
+    bool isMemoryAllocated = true;
+
+    /* Compute the tiles of the lower triangle and write them with their transposes into the result */
+    daal::threader_for(nBlocks * nBlocks, nBlocks * nBlocks, [&](int iTile)
+    {
+        size_t iBlock = iTile / nBlocks;
+        size_t jBlock = iTile % nBlocks;
+        if (jBlock > iBlock) { return; }
+
+        algorithmFPType *res = tileBuffer.local();
+        if (!res) { isMemoryAllocated = false; return; }
+
+        size_t i0 = iBlock * blockSize;
+        size_t j0 = jBlock * blockSize;
+        size_t ni = (i0 + blockSize < n ? blockSize : n - i0);
+        size_t nj = (j0 + blockSize < n ? blockSize : n - j0);
+        const bool isDiagonal = (iBlock == jBlock);
 
-        /* Pack the results into output array */
-        size_t dIndex = 0;
-        if(isLower<algorithmFPType, cpu>(rLayout))
+        if (isCSR)
         {
-            for (size_t i = 0; i < n; i++)
+            daal::algorithms::internal::computeSparseDotProductsTile<algorithmFPType, cpu>(values, colIndices, rowOffsets,
+                                                                                      i0, ni, j0, nj, res + blockSize * blockSize, res);
+        }
+        else
+        {
+            daal::algorithms::internal::computeDotProductsTile<algorithmFPType, cpu>(x + i0 * p, ni, x + j0 * p, nj, p, res);
+        }
+
+        for (size_t ii = 0; ii < ni; ii++)
+        {
+            size_t i = i0 + ii;
+            size_t njInRow = (isDiagonal ? ii : nj);
+          PRAGMA_IVDEP
+            for (size_t jj = 0; jj < njInRow; jj++)
             {
-                for (size_t j = 0; j < i; j++)
+                size_t j = j0 + jj;
+                res[ii * nj + jj] = one - res[ii * nj + jj] * normInv[i] * normInv[j];
+            }
+
+            if (isFullLayout)
+            {
+                for (size_t jj = 0; jj < njInRow; jj++)
                 {
-                    d[dIndex++] = one - xxt[i * n + j] * xxt[i * n + i] * xxt[j * n + j];
+                    size_t j = j0 + jj;
+                    d[i * n + j] = res[ii * nj + jj];
+                    d[j * n + i] = res[ii * nj + jj];
                 }
-                d[dIndex++] = one;
+                if (isDiagonal) { d[i * n + i] = one; }
             }
-        }
-        else if(isUpper<algorithmFPType, cpu>(rLayout))
-        {
-            for (size_t j = 0; j < n; j++)
+            else if (isLowerLayout)
             {
-                d[dIndex++] = one;
-                for (size_t i = j + 1; i < n; i++)
+                algorithmFPType *dRow = d + i * (i + 1) / 2;
+                for (size_t jj = 0; jj < njInRow; jj++)
                 {
-                    d[dIndex++] = one - xxt[i * n + j] * xxt[i * n + i] * xxt[j * n + j];
+                    dRow[j0 + jj] = res[ii * nj + jj];
                 }
+                if (isDiagonal) { dRow[i] = one; }
+            }
+            else
+            {
+                for (size_t jj = 0; jj < njInRow; jj++)
+                {
+                    size_t j = j0 + jj;
+                    d[j * (2 * n - j + 1) / 2 + (i - j)] = res[ii * nj + jj];
+                }
+                if (isDiagonal) { d[i * (2 * n - i + 1) / 2] = one; }
             }
         }
-        else
-        {
-            this->_errors->add(services::ErrorIncorrectTypeOfOutputNumericTable); return;
-        }
+    } );
 
-        rPackedMicroTable->release();
-        delete rPackedMicroTable;
+    tileBuffer.reduce( [=](algorithmFPType *res)-> void
+    {
+        daal::services::daal_free(res);
+    } );
+
+    if (isFullLayout)
+    {
+        rMicroTable.release();
+    }
+    else
+    {
+        rPackedMicroTable.release();
+    }
+    if (isCSR)
+    {
+        aCSRMicroTable.release();
+    }
+    else
+    {
+        aMicroTable.release();
     }
 
-    daal::services::daal_free(xxt);
+    daal::services::daal_free(normInv);
 
+    if (!isMemoryAllocated) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -50,11 +50,15 @@
 
 #include "correlation_distance_types.h"
 #include "cosine_distance_types.h"
+#include "nearest_neighbors_types.h"
 
 #include "covariance_types.h"
 
 #include "em_gmm_types.h"
 
+#include "gbt_model.h"
+#include "gbt_train_types.h"
+
 #include "implicit_als_model.h"
 #include "implicit_als_training_types.h"
 #include "implicit_als_predict_ratings_types.h"
@@ -263,6 +267,7 @@ Factory::Factory()
 
     registerObject(new Creator<algorithms::correlation_distance::Result>());
     registerObject(new Creator<algorithms::cosine_distance::Result>());
+    registerObject(new Creator<algorithms::nearest_neighbors::Result>());
 
     registerObject(new Creator<algorithms::covariance::PartialResult>());
     registerObject(new Creator<algorithms::covariance::Result>());
@@ -325,6 +330,7 @@ Factory::Factory()
     registerObject(new Creator<algorithms::qr::DistributedPartialResultStep3>());
 
     registerObject(new Creator<algorithms::quantiles::Result>());
+    registerObject(new Creator<algorithms::quantiles::PartialResult>());
 
     registerObject(new Creator<algorithms::math::relu::Result>());
     registerObject(new Creator<algorithms::math::softmax::Result>());
@@ -341,6 +347,9 @@ Factory::Factory()
     registerObject(new Creator<algorithms::svd::DistributedPartialResult>());
     registerObject(new Creator<algorithms::svd::DistributedPartialResultStep3>());
 
+    registerObject(new Creator<algorithms::gbt::Model>());
+    registerObject(new Creator<algorithms::gbt::training::Result>());
+
     registerObject(new Creator<algorithms::svm::Model>());
     registerObject(new Creator<algorithms::svm::training::Result>());
 
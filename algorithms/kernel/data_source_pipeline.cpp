@@ -0,0 +1,120 @@
+/* file: data_source_pipeline.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source pipeline with double buffering.
+//--
+*/
+
+#include "data_source_pipeline.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+
+/* Adds the errors of the collection starting from the position to the errors of the pipeline.
+   Returns true if there are such errors */
+static bool addNewErrors(const services::SharedPtr<services::ErrorCollection> &collection, size_t position,
+                         services::KernelErrorCollection &errors)
+{
+    if(!collection || collection->size() <= position)
+    {
+        return false;
+    }
+
+    const services::SharedPtr<services::KernelErrorCollection> &kernelErrors = collection->getErrors();
+    for(size_t i = position; i < kernelErrors->size(); i++)
+    {
+        errors.add((*kernelErrors)[i]);
+    }
+    return true;
+}
+
+static size_t getErrorsSize(const services::SharedPtr<services::ErrorCollection> &collection)
+{
+    return (collection ? collection->size() : 0);
+}
+
+size_t runDataSourcePipeline(DataSource &dataSource, size_t blockSize,
+                             const services::SharedPtr<NumericTable> &buffer0,
+                             const services::SharedPtr<NumericTable> &buffer1,
+                             PipelineStepIface &step, services::KernelErrorCollection &errors)
+{
+    if(blockSize == 0 || !buffer0 || !buffer1)
+    {
+        errors.add(services::ErrorIncorrectParameter);
+        return 0;
+    }
+
+    const services::SharedPtr<NumericTable> *buffers[2] = { &buffer0, &buffer1 };
+    size_t nLoaded[2] = { 0, 0 };
+    size_t nProcessed = 0;
+    size_t current = 0;
+
+    /* The error collections accumulate the errors, so only the errors added by the pipeline are reported */
+    size_t nSourceErrors = getErrorsSize(dataSource.getErrors());
+    size_t nStepErrors   = getErrorsSize(step.getErrors());
+
+    nLoaded[current] = dataSource.loadDataBlock(blockSize, buffers[current]->get());
+    if(addNewErrors(dataSource.getErrors(), nSourceErrors, errors))
+    {
+        return 0;
+    }
+
+    while(nLoaded[current] > 0)
+    {
+        const size_t next = 1 - current;
+
+        /* Task 0 processes the current block, task 1 loads the next block into the other buffer.
+           The tasks overlap only if the threading layer runs them on different threads */
+        daal::threader_for(2, 2, [ &, next ](int i)
+        {
+            if(i == 0)
+            {
+                step.compute(*buffers[current]);
+            }
+            else
+            {
+                nLoaded[next] = dataSource.loadDataBlock(blockSize, buffers[next]->get());
+            }
+        } );
+
+        /* The errors of the current block are reported before the errors of the next one */
+        if(addNewErrors(step.getErrors(), nStepErrors, errors))
+        {
+            break;
+        }
+        nProcessed += nLoaded[current];
+
+        if(addNewErrors(dataSource.getErrors(), nSourceErrors, errors))
+        {
+            break;
+        }
+        current = next;
+    }
+
+    return nProcessed;
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -0,0 +1,45 @@
+/* file: data_source_utils.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the service functions of data sources.
+//--
+*/
+
+#include "data_source_utils.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+
+void runConcurrently(ConcurrentTaskIface &task0, ConcurrentTaskIface &task1)
+{
+    ConcurrentTaskIface *tasks[2] = { &task0, &task1 };
+    daal::threader_for(2, 2, [ & ](int i)
+    {
+        tasks[i]->run();
+    } );
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
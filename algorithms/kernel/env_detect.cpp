@@ -97,3 +97,13 @@ DAAL_EXPORT void daal::services::Environment::setNumberOfThreads(const size_t nu
 }
 
 DAAL_EXPORT size_t daal::services::Environment::getNumberOfThreads() const { return _numThreads; }
+
+DAAL_EXPORT void daal::services::Environment::setReproducibleReductions(bool enable)
+{
+    _daal_threader_set_reproducible(enable ? 1 : 0);
+}
+
+DAAL_EXPORT bool daal::services::Environment::getReproducibleReductions() const
+{
+    return (_daal_threader_get_reproducible() != 0);
+}
@@ -536,6 +536,15 @@ void ErrorMessageCollection::parseResourceFile()
                   new Message<ErrorID>(ErrorRleDataFormatNotFullBlock,
                                        "Input compressed stream contains not a whole number of compressed blocks")));
 
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorChunkedStreamDataFormat,
+              "Input chunked compressed stream is in wrong format or corrupted")));
+    push_back(services::SharedPtr<Message<ErrorID> >(
+                  new Message<ErrorID>(ErrorChunkedStreamNotFull,
+                                       "Input chunked compressed stream does not contain all compressed chunks listed in the chunk index")));
+    push_back(services::SharedPtr<Message<ErrorID> >(
+                  new Message<ErrorID>(ErrorChunkedStreamInvalid,
+                                       "Chunked compression stream does not accept data after compression of a chunk failed")));
+
     // Quantile error: -10000..-11000
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorQuantileOrderValueIsInvalid,
               "Quantile order value is invalid")));
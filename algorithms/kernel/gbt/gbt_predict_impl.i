@@ -0,0 +1,149 @@
+/* file: gbt_predict_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Gradient boosted trees prediction algorithm implementation
+//--
+*/
+
+#ifndef __GBT_PREDICT_IMPL_I__
+#define __GBT_PREDICT_IMPL_I__
+
+#include "service_memory.h"
+#include "service_micro_table.h"
+#include "gbt_tree_node.h"
+#include "threading.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+
+using gbt::internal::TreeNode;
+
+const size_t rowBlockSizeDefault = 256;     /* Number of observations processed by one task */
+
+template <typename AlgorithmFPType, CpuType cpu>
+struct GBTPredictImpl<defaultDense, AlgorithmFPType, cpu> : public Kernel
+{
+    /**
+     *  \brief Computes the sums of the responses of the trees for the observations.
+     *         The trees are applied to a block of observations one by one, so that a tree stays in cache
+     */
+    void compute(const services::SharedPtr<NumericTable> a, const daal::algorithms::Model *m, services::SharedPtr<NumericTable> r,
+                 const daal::algorithms::Parameter *par)
+    {
+        const AlgorithmFPType zero = (AlgorithmFPType)0.0;
+        const AlgorithmFPType one  = (AlgorithmFPType)1.0;
+        services::SharedPtr<NumericTable> xTable = a;
+        Model *model = static_cast<Model *>(const_cast<daal::algorithms::Model *>(m));
+
+        const size_t nVectors  = xTable->getNumberOfRows();
+        const size_t nFeatures = xTable->getNumberOfColumns();
+        const size_t nTrees    = model->getNumberOfTrees();
+        const size_t nNodes    = model->getNodes()->getNumberOfRows();
+        const AlgorithmFPType baseResponse = (AlgorithmFPType)model->getBaseResponse();
+        const bool isClassification = (model->getLossFunction() == logisticLoss);
+
+        TreeNode<AlgorithmFPType> *nodes = (TreeNode<AlgorithmFPType> *)daal::services::daal_malloc(
+                                               (nNodes > 0 ? nNodes : 1) * sizeof(TreeNode<AlgorithmFPType>));
+        if (!nodes) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        AlgorithmFPType *nodesData;
+        BlockMicroTable<AlgorithmFPType, readOnly, cpu> nodesMicroTable(model->getNodes().get());
+        nodesMicroTable.getBlockOfRows(0, nNodes, &nodesData);
+        for (size_t i = 0; i < nNodes; i++)
+        {
+            const AlgorithmFPType *node = nodesData + i * nNodeAttributes;
+            nodes[i].splitFeature = (int)node[splitFeature];
+            nodes[i].leftChild    = (int)node[leftChild];
+            nodes[i].splitValue   = node[splitValue];
+            nodes[i].response     = node[response];
+        }
+        nodesMicroTable.release();
+
+        int *treeRoots;
+        BlockMicroTable<int, readOnly, cpu> treeRootsMicroTable(model->getTreeRoots().get());
+        treeRootsMicroTable.getBlockOfRows(0, nTrees, &treeRoots);
+
+        AlgorithmFPType *x;
+        BlockMicroTable<AlgorithmFPType, readOnly, cpu> xMicroTable(xTable.get());
+        xMicroTable.getBlockOfRows(0, nVectors, &x);
+
+        AlgorithmFPType *prediction;
+        BlockMicroTable<AlgorithmFPType, writeOnly, cpu> rMicroTable(r.get());
+        rMicroTable.getBlockOfRows(0, nVectors, &prediction);
+
+        const size_t nBlocks = nVectors / rowBlockSizeDefault + (nVectors % rowBlockSizeDefault > 0 ? 1 : 0);
+        daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+        {
+            const size_t i0 = iBlock * rowBlockSizeDefault;
+            const size_t nRows = (i0 + rowBlockSizeDefault < nVectors ? rowBlockSizeDefault : nVectors - i0);
+            AlgorithmFPType *blockPrediction = prediction + i0;
+
+            for (size_t i = 0; i < nRows; i++)
+            {
+                blockPrediction[i] = baseResponse;
+            }
+
+            for (size_t iTree = 0; iTree < nTrees; iTree++)
+            {
+                const TreeNode<AlgorithmFPType> *root = nodes + treeRoots[iTree];
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const AlgorithmFPType *xi = x + (i0 + i) * nFeatures;
+                    const TreeNode<AlgorithmFPType> *node = root;
+                    while (node->splitFeature >= 0)
+                    {
+                        node = nodes + node->leftChild + (xi[node->splitFeature] < node->splitValue ? 0 : 1);
+                    }
+                    blockPrediction[i] += node->response;
+                }
+            }
+
+            if (isClassification)
+            {
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    blockPrediction[i] = (blockPrediction[i] >= zero ? one : -one);
+                }
+            }
+        } );
+
+        rMicroTable.release();
+        xMicroTable.release();
+        treeRootsMicroTable.release();
+        daal::services::daal_free(nodes);
+    }
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
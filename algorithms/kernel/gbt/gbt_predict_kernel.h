@@ -0,0 +1,63 @@
+/* file: gbt_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that contains gradient boosted trees prediction functions.
+//--
+*/
+
+#ifndef __GBT_PREDICT_KERNEL_H__
+#define __GBT_PREDICT_KERNEL_H__
+
+#include "numeric_table.h"
+#include "model.h"
+#include "daal_defines.h"
+#include "gbt_predict_types.h"
+#include "kernel.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+
+template <Method method, typename AlgorithmFPType, CpuType cpu>
+struct GBTPredictImpl : public Kernel
+{
+    void compute(const services::SharedPtr<NumericTable> a, const daal::algorithms::Model *m, services::SharedPtr<NumericTable> r,
+                 const daal::algorithms::Parameter *par);
+};
+
+} // namespace internal
+
+} // namespace prediction
+
+} // namespace gbt
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,703 @@
+/* file: gbt_train_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram-based training of the gradient boosted trees.
+//
+//  The values of every feature are quantized into at most 256 bins once.
+//  The trees are grown level by level. The split of a node is searched in
+//  the histograms of the gradients and the hessians over the bins of the features.
+//  The histogram is computed only for the smaller child of a split node,
+//  the histogram of the larger child is the difference of the histograms
+//  of the parent and the smaller child.
+//--
+*/
+
+#include "service_micro_table.h"
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "service_defines.h"
+#include "threading.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+
+const size_t rowBlockSizeDefault        = 1024;  /* Number of observations processed by one task */
+const size_t minRowsInParallelHistogram = 4096;  /* Histograms of smaller nodes are computed sequentially */
+
+/**
+ *  \brief Adds the gradients and the hessians of the observations
+ *         in the range [begin, end) of the row indices to the histogram
+ */
+template <typename algorithmFPType, CpuType cpu>
+void addRowsToHistogram(const TrainTask<algorithmFPType> &t, size_t begin, size_t end, HistogramBin<algorithmFPType> *hist)
+{
+    const size_t p = t.p;
+    const size_t maxBins = t.maxBins;
+    for (size_t i = begin; i < end; i++)
+    {
+        const size_t row = t.rowIndices[i];
+        const unsigned char *xb = t.binnedData + row * p;
+        const algorithmFPType g = t.grad[row];
+        const algorithmFPType h = t.hess[row];
+        for (size_t j = 0; j < p; j++)
+        {
+            HistogramBin<algorithmFPType> &bin = hist[j * maxBins + xb[j]];
+            bin.g += g;
+            bin.h += h;
+            bin.n++;
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void clearHistogram(HistogramBin<algorithmFPType> *hist, size_t histSize)
+{
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    for (size_t b = 0; b < histSize; b++)
+    {
+        hist[b].g = zero;
+        hist[b].h = zero;
+        hist[b].n = 0;
+    }
+}
+
+/**
+ *  \brief Computes the borders of the bins of every feature from the sorted values of the feature
+ *         and replaces the values of the features with the indices of the bins
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+bool GBTTrainImpl<method, algorithmFPType, cpu>::computeBins(const algorithmFPType *x, TrainTask<algorithmFPType> &t)
+{
+    const size_t n = t.n;
+    const size_t p = t.p;
+    const size_t maxBins = t.maxBins;
+
+    daal::tls<algorithmFPType *> columns( [=]()-> algorithmFPType *
+    {
+        return (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+    } );
+
+    bool isMemoryAllocated = true;
+
+    /* If the feature has not more distinct values than bins, every value gets its own bin,
+       otherwise the borders of the bins are the quantiles of the values */
+    daal::threader_for(p, p, [&](int j)
+    {
+        algorithmFPType *column = columns.local();
+        if (!column) { isMemoryAllocated = false; return; }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            column[i] = x[i * p + j];
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(n, column);
+
+        size_t nDistinct = 1;
+        for (size_t i = 1; i < n; i++)
+        {
+            nDistinct += (column[i] != column[i - 1]);
+        }
+
+        algorithmFPType *borders = t.binBorders + j * maxBins;
+        size_t nBorders = 0;
+        if (nDistinct <= maxBins)
+        {
+            for (size_t i = 1; i < n; i++)
+            {
+                if (column[i] != column[i - 1]) { borders[nBorders++] = column[i]; }
+            }
+        }
+        else
+        {
+            algorithmFPType prev = column[0];
+            for (size_t b = 1; b < maxBins; b++)
+            {
+                const algorithmFPType value = column[(b * n) / maxBins];
+                if (value > prev) { borders[nBorders++] = value; prev = value; }
+            }
+        }
+        t.nBins[j] = (int)nBorders + 1;
+    } );
+
+    columns.reduce( [=](algorithmFPType *column)-> void
+    {
+        daal::services::daal_free(column);
+    } );
+
+    if (!isMemoryAllocated) { return false; }
+
+    /* The value goes into the bin whose index is the number of borders not greater than the value */
+    const size_t nBlocks = n / rowBlockSizeDefault + (n % rowBlockSizeDefault > 0 ? 1 : 0);
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        size_t i1 = (iBlock + 1) * rowBlockSizeDefault;
+        if (i1 > n) { i1 = n; }
+        for (size_t i = iBlock * rowBlockSizeDefault; i < i1; i++)
+        {
+            for (size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType value = x[i * p + j];
+                const algorithmFPType *borders = t.binBorders + j * maxBins;
+                size_t lo = 0;
+                size_t hi = t.nBins[j] - 1;
+                while (lo < hi)
+                {
+                    const size_t mid = (lo + hi) / 2;
+                    if (borders[mid] <= value) { lo = mid + 1; }
+                    else { hi = mid; }
+                }
+                t.binnedData[i * p + j] = (unsigned char)lo;
+            }
+        }
+    } );
+
+    return true;
+}
+
+/**
+ *  \brief Computes the gradients and the hessians of the loss function at the current responses of the model
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+void GBTTrainImpl<method, algorithmFPType, cpu>::computeGradients(TrainTask<algorithmFPType> &t, LossFunctionId lossFunction)
+{
+    const size_t n = t.n;
+    const algorithmFPType one = (algorithmFPType)1.0;
+    const algorithmFPType minHessian = (algorithmFPType)1.0e-16;
+    const size_t nBlocks = n / rowBlockSizeDefault + (n % rowBlockSizeDefault > 0 ? 1 : 0);
+
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        const size_t i0 = iBlock * rowBlockSizeDefault;
+        const size_t nRows = (i0 + rowBlockSizeDefault < n ? rowBlockSizeDefault : n - i0);
+        const algorithmFPType *f = t.f + i0;
+        const algorithmFPType *y = t.y + i0;
+        algorithmFPType *grad = t.grad + i0;
+        algorithmFPType *hess = t.hess + i0;
+
+        if (lossFunction == squaredLoss)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                grad[i] = f[i] - y[i];
+                hess[i] = one;
+            }
+            return;
+        }
+
+        /* The hessians are used as the buffer for the exponents of the responses */
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; i++)
+        {
+            hess[i] = -f[i];
+        }
+        Math<algorithmFPType, cpu>::vExp(nRows, hess, hess);
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType prob = one / (one + hess[i]);
+            const algorithmFPType h = prob * (one - prob);
+            grad[i] = prob - y[i];
+            hess[i] = (h > minHessian ? h : minHessian);
+        }
+    } );
+}
+
+/**
+ *  \brief Computes the histogram of the observations in the range [begin, end) of the row indices.
+ *         Large nodes are split into blocks of observations accumulated in the histograms of the threads
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+bool GBTTrainImpl<method, algorithmFPType, cpu>::buildHistogram(TrainTask<algorithmFPType> &t, size_t begin, size_t end,
+                                                                 Bin *hist, HistogramTls &tls)
+{
+    const size_t histSize = t.histSize;
+    const size_t nRows = end - begin;
+
+    clearHistogram<algorithmFPType, cpu>(hist, histSize);
+
+    if (nRows < minRowsInParallelHistogram)
+    {
+        addRowsToHistogram<algorithmFPType, cpu>(t, begin, end, hist);
+        return true;
+    }
+
+    bool isMemoryAllocated = true;
+    const size_t nBlocks = nRows / rowBlockSizeDefault + (nRows % rowBlockSizeDefault > 0 ? 1 : 0);
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        LocalHistogram<algorithmFPType> *local = tls.local();
+        if (!local || !local->bins) { isMemoryAllocated = false; return; }
+
+        if (!local->isUsed)
+        {
+            clearHistogram<algorithmFPType, cpu>(local->bins, histSize);
+            local->isUsed = true;
+        }
+
+        const size_t i0 = begin + iBlock * rowBlockSizeDefault;
+        const size_t i1 = (i0 + rowBlockSizeDefault < end ? i0 + rowBlockSizeDefault : end);
+        addRowsToHistogram<algorithmFPType, cpu>(t, i0, i1, local->bins);
+    } );
+
+    tls.reduce( [&](LocalHistogram<algorithmFPType> *local)-> void
+    {
+        if (!local || !local->isUsed) { return; }
+        for (size_t b = 0; b < histSize; b++)
+        {
+            hist[b].g += local->bins[b].g;
+            hist[b].h += local->bins[b].h;
+            hist[b].n += local->bins[b].n;
+        }
+        local->isUsed = false;
+    } );
+
+    return isMemoryAllocated;
+}
+
+/**
+ *  \brief Finds the split of the node with the largest reduction of the regularized loss.
+ *         The features are processed in parallel
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+bool GBTTrainImpl<method, algorithmFPType, cpu>::findBestSplit(TrainTask<algorithmFPType> &t, const ActiveNode<algorithmFPType> &node,
+                                                                const Parameter *par, Split<algorithmFPType> &split)
+{
+    const size_t p = t.p;
+    const size_t maxBins = t.maxBins;
+    const size_t nNode = node.end - node.begin;
+    const size_t minObservations = par->minObservationsInLeafNode;
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType lambda = (algorithmFPType)par->lambda;
+    const algorithmFPType nodeScore = node.g * node.g / (node.h + lambda);
+
+    daal::threader_for(p, p, [&](int j)
+    {
+        Split<algorithmFPType> &best = t.featureSplits[j];
+        best.feature = -1;
+        best.gain = zero;
+
+        const Bin *featureHist = node.hist + j * maxBins;
+        const size_t nBorders = t.nBins[j] - 1;
+        algorithmFPType gLeft = zero;
+        algorithmFPType hLeft = zero;
+        size_t nLeft = 0;
+        for (size_t b = 0; b < nBorders; b++)
+        {
+            gLeft += featureHist[b].g;
+            hLeft += featureHist[b].h;
+            nLeft += featureHist[b].n;
+            if (nLeft < minObservations) { continue; }
+            if (nNode - nLeft < minObservations) { break; }
+
+            const algorithmFPType gRight = node.g - gLeft;
+            const algorithmFPType hRight = node.h - hLeft;
+            const algorithmFPType gain = gLeft * gLeft / (hLeft + lambda) + gRight * gRight / (hRight + lambda) - nodeScore;
+            if (gain > best.gain)
+            {
+                best.feature = j;
+                best.bin     = (int)b;
+                best.gain    = gain;
+                best.gLeft   = gLeft;
+                best.hLeft   = hLeft;
+                best.nLeft   = nLeft;
+            }
+        }
+    } );
+
+    split.feature = -1;
+    split.gain = zero;
+    for (size_t j = 0; j < p; j++)
+    {
+        if (t.featureSplits[j].feature >= 0 && t.featureSplits[j].gain > split.gain)
+        {
+            split = t.featureSplits[j];
+        }
+    }
+    return (split.feature >= 0);
+}
+
+/**
+ *  \brief Stable partition of the row indices in the range [begin, end):
+ *         the observations with the bins of the feature not greater than the given one go first
+ *  \return End of the range of the left child
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+size_t GBTTrainImpl<method, algorithmFPType, cpu>::partition(TrainTask<algorithmFPType> &t, size_t begin, size_t end,
+                                                              int feature, int bin)
+{
+    const size_t p = t.p;
+    int *rowIndices = t.rowIndices;
+    size_t nLeft = begin;
+    size_t nRight = 0;
+    for (size_t i = begin; i < end; i++)
+    {
+        const int row = rowIndices[i];
+        if (t.binnedData[row * p + feature] <= bin) { rowIndices[nLeft++] = row; }
+        else { t.partitionBuffer[nRight++] = row; }
+    }
+    for (size_t i = 0; i < nRight; i++)
+    {
+        rowIndices[nLeft + i] = t.partitionBuffer[i];
+    }
+    return nLeft;
+}
+
+/**
+ *  \brief Grows the tree level by level and adds the responses of its leaves to the responses of the model
+ *  \return Number of nodes in the tree, 0 if memory allocation failed
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+size_t GBTTrainImpl<method, algorithmFPType, cpu>::buildTree(TrainTask<algorithmFPType> &t, const Parameter *par, HistogramTls &tls,
+                                                              TreeNode<algorithmFPType> *tree, size_t maxLeaves,
+                                                              ActiveNode<algorithmFPType> *level, ActiveNode<algorithmFPType> *nextLevel)
+{
+    const size_t n = t.n;
+    const size_t histSize = t.histSize;
+    const size_t minObservations = par->minObservationsInLeafNode;
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType lambda = (algorithmFPType)par->lambda;
+    const algorithmFPType shrinkage = (algorithmFPType)par->shrinkage;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        t.rowIndices[i] = (int)i;
+    }
+
+    Bin *rootHist = (Bin *)daal::services::daal_malloc(histSize * sizeof(Bin));
+    if (!rootHist || !buildHistogram(t, 0, n, rootHist, tls))
+    {
+        daal::services::daal_free(rootHist);
+        return 0;
+    }
+
+    /* The sums over the bins of any feature are the sums over the node */
+    ActiveNode<algorithmFPType> &root = level[0];
+    root.iNode = 0;
+    root.begin = 0;
+    root.end   = n;
+    root.g     = zero;
+    root.h     = zero;
+    root.hist  = rootHist;
+    for (size_t b = 0; b < (size_t)t.nBins[0]; b++)
+    {
+        root.g += rootHist[b].g;
+        root.h += rootHist[b].h;
+    }
+
+    size_t nNodes = 1;
+    size_t nLevelNodes = 1;
+    bool isMemoryAllocated = true;
+    for (size_t depth = 0; nLevelNodes > 0; depth++)
+    {
+        size_t nNextLevelNodes = 0;
+        for (size_t k = 0; k < nLevelNodes; k++)
+        {
+            ActiveNode<algorithmFPType> &node = level[k];
+            TreeNode<algorithmFPType> &treeNode = tree[node.iNode];
+            Split<algorithmFPType> split;
+
+            const bool canSplit = isMemoryAllocated && depth < par->maxTreeDepth &&
+                                  node.end - node.begin >= 2 * minObservations && nNextLevelNodes + 2 <= maxLeaves;
+            if (!canSplit || !findBestSplit(t, node, par, split))
+            {
+                const algorithmFPType leafResponse = -shrinkage * node.g / (node.h + lambda);
+                treeNode.splitFeature = -1;
+                treeNode.leftChild    = 0;
+                treeNode.splitValue   = zero;
+                treeNode.response     = leafResponse;
+                for (size_t i = node.begin; i < node.end; i++)
+                {
+                    t.f[t.rowIndices[i]] += leafResponse;
+                }
+                daal::services::daal_free(node.hist);
+                continue;
+            }
+
+            treeNode.splitFeature = split.feature;
+            treeNode.leftChild    = (int)nNodes;
+            treeNode.splitValue   = t.binBorders[split.feature * t.maxBins + split.bin];
+            treeNode.response     = zero;
+
+            const size_t middle = partition(t, node.begin, node.end, split.feature, split.bin);
+
+            ActiveNode<algorithmFPType> &left  = nextLevel[nNextLevelNodes];
+            ActiveNode<algorithmFPType> &right = nextLevel[nNextLevelNodes + 1];
+            left.iNode  = nNodes;
+            left.begin  = node.begin;
+            left.end    = middle;
+            left.g      = split.gLeft;
+            left.h      = split.hLeft;
+            right.iNode = nNodes + 1;
+            right.begin = middle;
+            right.end   = node.end;
+            right.g     = node.g - split.gLeft;
+            right.h     = node.h - split.hLeft;
+            nNodes += 2;
+            nNextLevelNodes += 2;
+
+            /* The histogram of the parent becomes the histogram of the larger child */
+            const bool isLeftSmaller = (middle - node.begin <= node.end - middle);
+            ActiveNode<algorithmFPType> &smaller = (isLeftSmaller ? left : right);
+            ActiveNode<algorithmFPType> &larger  = (isLeftSmaller ? right : left);
+            larger.hist  = node.hist;
+            smaller.hist = (Bin *)daal::services::daal_malloc(histSize * sizeof(Bin));
+            if (!smaller.hist || !buildHistogram(t, smaller.begin, smaller.end, smaller.hist, tls))
+            {
+                isMemoryAllocated = false;
+                continue;
+            }
+
+            Bin *largerHist = larger.hist;
+            const Bin *smallerHist = smaller.hist;
+            for (size_t b = 0; b < histSize; b++)
+            {
+                largerHist[b].g -= smallerHist[b].g;
+                largerHist[b].h -= smallerHist[b].h;
+                largerHist[b].n -= smallerHist[b].n;
+            }
+        }
+
+        ActiveNode<algorithmFPType> *tmp = level;
+        level = nextLevel;
+        nextLevel = tmp;
+        nLevelNodes = nNextLevelNodes;
+    }
+
+    return (isMemoryAllocated ? nNodes : 0);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+void GBTTrainImpl<method, algorithmFPType, cpu>::compute(const size_t na, services::SharedPtr<NumericTable> *a,
+                                                          daal::algorithms::Model *r, const daal::algorithms::Parameter *par)
+{
+    services::SharedPtr<NumericTable> xTable = a[0];
+    services::SharedPtr<NumericTable> yTable = a[1];
+    gbt::Model *model = static_cast<gbt::Model *>(r);
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+
+    const size_t n = xTable->getNumberOfRows();
+    const size_t p = xTable->getNumberOfColumns();
+    const size_t maxBins = parameter->maxBins;
+    const size_t nTrees = parameter->nIterations;
+    const LossFunctionId lossFunction = parameter->lossFunction;
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType one  = (algorithmFPType)1.0;
+
+    /* Every leaf contains at least minObservationsInLeafNode observations */
+    size_t maxLeaves = n / parameter->minObservationsInLeafNode;
+    if (maxLeaves == 0) { maxLeaves = 1; }
+    if (parameter->maxTreeDepth < 31 && ((size_t)1 << parameter->maxTreeDepth) < maxLeaves)
+    {
+        maxLeaves = (size_t)1 << parameter->maxTreeDepth;
+    }
+    const size_t maxTreeNodes = 2 * maxLeaves - 1;
+
+    TrainTask<algorithmFPType> t;
+    t.n = n;
+    t.p = p;
+    t.maxBins  = maxBins;
+    t.histSize = p * maxBins;
+    t.nBins           = (int *)daal::services::daal_malloc(p * sizeof(int));
+    t.binBorders      = (algorithmFPType *)daal::services::daal_malloc(p * maxBins * sizeof(algorithmFPType));
+    t.binnedData      = (unsigned char *)daal::services::daal_malloc(n * p * sizeof(unsigned char));
+    t.y               = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+    t.f               = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+    t.grad            = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+    t.hess            = (algorithmFPType *)daal::services::daal_malloc(n * sizeof(algorithmFPType));
+    t.rowIndices      = (int *)daal::services::daal_malloc(n * sizeof(int));
+    t.partitionBuffer = (int *)daal::services::daal_malloc(n * sizeof(int));
+    t.featureSplits   = (Split<algorithmFPType> *)daal::services::daal_malloc(p * sizeof(Split<algorithmFPType>));
+
+    TreeNode<algorithmFPType> *tree = (TreeNode<algorithmFPType> *)daal::services::daal_malloc(
+                                          maxTreeNodes * sizeof(TreeNode<algorithmFPType>));
+    ActiveNode<algorithmFPType> *level     = (ActiveNode<algorithmFPType> *)daal::services::daal_malloc(
+                                                 maxLeaves * sizeof(ActiveNode<algorithmFPType>));
+    ActiveNode<algorithmFPType> *nextLevel = (ActiveNode<algorithmFPType> *)daal::services::daal_malloc(
+                                                 maxLeaves * sizeof(ActiveNode<algorithmFPType>));
+    int *treeRoots = (int *)daal::services::daal_malloc(nTrees * sizeof(int));
+
+    size_t modelNodesCapacity = maxTreeNodes;
+    size_t nModelNodes = 0;
+    TreeNode<algorithmFPType> *modelNodes = (TreeNode<algorithmFPType> *)daal::services::daal_malloc(
+                                                modelNodesCapacity * sizeof(TreeNode<algorithmFPType>));
+
+    bool isMemoryAllocated = (t.nBins && t.binBorders && t.binnedData && t.y && t.f && t.grad && t.hess &&
+                              t.rowIndices && t.partitionBuffer && t.featureSplits &&
+                              tree && level && nextLevel && treeRoots && modelNodes);
+
+    algorithmFPType baseResponse = zero;
+    if (isMemoryAllocated)
+    {
+        algorithmFPType *x, *y;
+        BlockMicroTable<algorithmFPType, readOnly, cpu> xMicroTable(xTable.get());
+        BlockMicroTable<algorithmFPType, readOnly, cpu> yMicroTable(yTable.get());
+        xMicroTable.getBlockOfRows(0, n, &x);
+        yMicroTable.getBlockOfRows(0, n, &y);
+
+        isMemoryAllocated = computeBins(x, t);
+        xMicroTable.release();
+
+        /* The base response minimizes the loss function over the constant responses */
+        algorithmFPType sum = zero;
+        for (size_t i = 0; i < n; i++)
+        {
+            t.y[i] = (lossFunction == logisticLoss ? (y[i] > zero ? one : zero) : y[i]);
+            sum += t.y[i];
+        }
+        yMicroTable.release();
+
+        baseResponse = sum / (algorithmFPType)n;
+        if (lossFunction == logisticLoss)
+        {
+            const algorithmFPType minProb = (algorithmFPType)1.0e-6;
+            if (baseResponse < minProb)       { baseResponse = minProb; }
+            if (baseResponse > one - minProb) { baseResponse = one - minProb; }
+            baseResponse = Math<algorithmFPType, cpu>::sLog(baseResponse / (one - baseResponse));
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            t.f[i] = baseResponse;
+        }
+    }
+
+    if (isMemoryAllocated)
+    {
+        const size_t histSize = t.histSize;
+        HistogramTls tls( [=]()-> LocalHistogram<algorithmFPType> *
+        {
+            LocalHistogram<algorithmFPType> *local = new LocalHistogram<algorithmFPType>();
+            local->bins = (HistogramBin<algorithmFPType> *)daal::services::daal_malloc(histSize * sizeof(HistogramBin<algorithmFPType>));
+            local->isUsed = false;
+            return local;
+        } );
+
+        for (size_t iTree = 0; iTree < nTrees && isMemoryAllocated; iTree++)
+        {
+            computeGradients(t, lossFunction);
+
+            const size_t nTreeNodes = buildTree(t, parameter, tls, tree, maxLeaves, level, nextLevel);
+            if (nTreeNodes == 0) { isMemoryAllocated = false; break; }
+
+            if (nModelNodes + nTreeNodes > modelNodesCapacity)
+            {
+                size_t newCapacity = 2 * modelNodesCapacity;
+                if (newCapacity < nModelNodes + nTreeNodes) { newCapacity = nModelNodes + nTreeNodes; }
+                TreeNode<algorithmFPType> *newModelNodes = (TreeNode<algorithmFPType> *)daal::services::daal_malloc(
+                                                               newCapacity * sizeof(TreeNode<algorithmFPType>));
+                if (!newModelNodes) { isMemoryAllocated = false; break; }
+                daal::services::daal_memcpy_s(newModelNodes, newCapacity * sizeof(TreeNode<algorithmFPType>),
+                                              modelNodes, nModelNodes * sizeof(TreeNode<algorithmFPType>));
+                daal::services::daal_free(modelNodes);
+                modelNodes = newModelNodes;
+                modelNodesCapacity = newCapacity;
+            }
+
+            /* The indices of the children in the model are counted from the first node of the first tree */
+            for (size_t i = 0; i < nTreeNodes; i++)
+            {
+                modelNodes[nModelNodes + i] = tree[i];
+                if (tree[i].splitFeature >= 0) { modelNodes[nModelNodes + i].leftChild += (int)nModelNodes; }
+            }
+            treeRoots[iTree] = (int)nModelNodes;
+            nModelNodes += nTreeNodes;
+        }
+
+        tls.reduce( [=](LocalHistogram<algorithmFPType> *local)-> void
+        {
+            if (!local) { return; }
+            daal::services::daal_free(local->bins);
+            delete local;
+        } );
+    }
+
+    if (isMemoryAllocated)
+    {
+        services::SharedPtr<NumericTable> nodesTable = model->getNodes();
+        nodesTable->setNumberOfRows(nModelNodes);
+        nodesTable->allocateDataMemory();
+
+        algorithmFPType *nodes;
+        BlockMicroTable<algorithmFPType, writeOnly, cpu> nodesMicroTable(nodesTable.get());
+        nodesMicroTable.getBlockOfRows(0, nModelNodes, &nodes);
+        for (size_t i = 0; i < nModelNodes; i++)
+        {
+            algorithmFPType *node = nodes + i * nNodeAttributes;
+            node[splitFeature] = (algorithmFPType)modelNodes[i].splitFeature;
+            node[splitValue]   = modelNodes[i].splitValue;
+            node[leftChild]    = (algorithmFPType)modelNodes[i].leftChild;
+            node[response]     = modelNodes[i].response;
+        }
+        nodesMicroTable.release();
+
+        services::SharedPtr<NumericTable> treeRootsTable = model->getTreeRoots();
+        treeRootsTable->setNumberOfRows(nTrees);
+        treeRootsTable->allocateDataMemory();
+
+        int *roots;
+        BlockMicroTable<int, writeOnly, cpu> treeRootsMicroTable(treeRootsTable.get());
+        treeRootsMicroTable.getBlockOfRows(0, nTrees, &roots);
+        for (size_t i = 0; i < nTrees; i++)
+        {
+            roots[i] = treeRoots[i];
+        }
+        treeRootsMicroTable.release();
+
+        model->setBaseResponse((double)baseResponse);
+        model->setLossFunction(lossFunction);
+    }
+
+    daal::services::daal_free(t.nBins);
+    daal::services::daal_free(t.binBorders);
+    daal::services::daal_free(t.binnedData);
+    daal::services::daal_free(t.y);
+    daal::services::daal_free(t.f);
+    daal::services::daal_free(t.grad);
+    daal::services::daal_free(t.hess);
+    daal::services::daal_free(t.rowIndices);
+    daal::services::daal_free(t.partitionBuffer);
+    daal::services::daal_free(t.featureSplits);
+    daal::services::daal_free(tree);
+    daal::services::daal_free(level);
+    daal::services::daal_free(nextLevel);
+    daal::services::daal_free(treeRoots);
+    daal::services::daal_free(modelNodes);
+
+    if (!isMemoryAllocated) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
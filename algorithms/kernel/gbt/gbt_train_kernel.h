@@ -0,0 +1,155 @@
+/* file: gbt_train_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate gradient boosted trees training functions.
+//--
+*/
+
+#ifndef __GBT_TRAIN_KERNEL_H__
+#define __GBT_TRAIN_KERNEL_H__
+
+#include "numeric_table.h"
+#include "model.h"
+#include "daal_defines.h"
+#include "gbt_train_types.h"
+#include "gbt_tree_node.h"
+#include "kernel.h"
+#include "threading.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+
+using gbt::internal::TreeNode;
+
+/**
+ *  \brief Sums of the gradients and the hessians of the observations that fall into a bin of a feature
+ */
+template <typename algorithmFPType>
+struct HistogramBin
+{
+    algorithmFPType g;
+    algorithmFPType h;
+    size_t n;
+};
+
+/**
+ *  \brief Node of the tree under construction that may be split at the current level.
+ *         The observations of the node are stored in the range [begin, end) of the array of row indices
+ */
+template <typename algorithmFPType>
+struct ActiveNode
+{
+    size_t iNode;
+    size_t begin;
+    size_t end;
+    algorithmFPType g;
+    algorithmFPType h;
+    HistogramBin<algorithmFPType> *hist;
+};
+
+/**
+ *  \brief Best split of a node found in its histogram
+ */
+template <typename algorithmFPType>
+struct Split
+{
+    int feature;
+    int bin;
+    algorithmFPType gain;
+    algorithmFPType gLeft;
+    algorithmFPType hLeft;
+    size_t nLeft;
+};
+
+/**
+ *  \brief Histogram of the thread that accumulates a part of the observations of a node
+ */
+template <typename algorithmFPType>
+struct LocalHistogram
+{
+    HistogramBin<algorithmFPType> *bins;
+    bool isUsed;
+};
+
+/**
+ *  \brief Data shared by the iterations of the training: the quantized data set,
+ *         the gradients of the loss function and the current responses of the model
+ */
+template <typename algorithmFPType>
+struct TrainTask
+{
+    size_t n;                       /* Number of observations */
+    size_t p;                       /* Number of features */
+    size_t maxBins;                 /* Maximal number of bins of a feature */
+    size_t histSize;                /* Number of bins in the histogram of a node */
+    int *nBins;                     /* Number of bins of every feature */
+    algorithmFPType *binBorders;    /* Lower borders of the bins except the first one, maxBins per feature */
+    unsigned char *binnedData;      /* Indices of the bins of the observations, n x p */
+    algorithmFPType *y;             /* Responses transformed for the loss function */
+    algorithmFPType *f;             /* Current responses of the model */
+    algorithmFPType *grad;          /* Gradients of the loss function */
+    algorithmFPType *hess;          /* Hessians of the loss function */
+    int *rowIndices;                /* Indices of the observations grouped by the nodes */
+    int *partitionBuffer;           /* Buffer for the stable partition of the row indices */
+    Split<algorithmFPType> *featureSplits;  /* Best splits of the node over every feature */
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct GBTTrainImpl : public Kernel
+{
+    void compute(const size_t na, services::SharedPtr<NumericTable> *a, daal::algorithms::Model *r,
+                 const daal::algorithms::Parameter *par);
+
+protected:
+    typedef HistogramBin<algorithmFPType> Bin;
+    typedef daal::tls<LocalHistogram<algorithmFPType> *> HistogramTls;
+
+    bool computeBins(const algorithmFPType *x, TrainTask<algorithmFPType> &t);
+
+    void computeGradients(TrainTask<algorithmFPType> &t, LossFunctionId lossFunction);
+
+    size_t buildTree(TrainTask<algorithmFPType> &t, const Parameter *par, HistogramTls &tls,
+                     TreeNode<algorithmFPType> *tree, size_t maxLeaves,
+                     ActiveNode<algorithmFPType> *level, ActiveNode<algorithmFPType> *nextLevel);
+
+    bool buildHistogram(TrainTask<algorithmFPType> &t, size_t begin, size_t end, Bin *hist, HistogramTls &tls);
+
+    bool findBestSplit(TrainTask<algorithmFPType> &t, const ActiveNode<algorithmFPType> &node,
+                       const Parameter *par, Split<algorithmFPType> &split);
+
+    size_t partition(TrainTask<algorithmFPType> &t, size_t begin, size_t end, int feature, int bin);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
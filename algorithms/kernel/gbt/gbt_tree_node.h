@@ -0,0 +1,54 @@
+/* file: gbt_tree_node.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the tree node used by the gradient boosted trees kernels.
+//--
+*/
+
+#ifndef __GBT_TREE_NODE_H__
+#define __GBT_TREE_NODE_H__
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace internal
+{
+
+/**
+ *  \brief Node of a tree in the form convenient for the traversal.
+ *         The leaves have negative index of the split feature
+ */
+template <typename algorithmFPType>
+struct TreeNode
+{
+    int splitFeature;
+    int leftChild;
+    algorithmFPType splitValue;
+    algorithmFPType response;
+};
+
+} // namespace internal
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
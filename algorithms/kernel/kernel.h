@@ -24,8 +24,10 @@
 #ifndef __KERNEL_H__
 #define __KERNEL_H__
 
+#include <typeinfo>
 #include "daal_defines.h"
 #include "service_defines.h"
+#include "service_profiler.h"
 
 #undef __DAAL_INTIALIZE_KERNELS
 #define __DAAL_INTIALIZE_KERNELS(KernelClass, ...)        \
@@ -42,9 +44,20 @@
 #undef __DAAL_KERNEL_ARGUMENTS
 #define __DAAL_KERNEL_ARGUMENTS(...) __VA_ARGS__
 
+#undef __DAAL_PROFILER_KERNEL_TASK
+#if defined(DAAL_PROFILER)
+#define __DAAL_PROFILER_KERNEL_TASK(KernelClass, templateArguments, method)                                  \
+    static const char *__daalKernelName = daal::services::Profiler::getMethodName(                          \
+        typeid(KernelClass<templateArguments, cpu>).name(), #method);                                       \
+    __DAAL_PROFILER_CPU_TASK(profilerKernel, __daalKernelName, cpu);
+#else
+#define __DAAL_PROFILER_KERNEL_TASK(KernelClass, templateArguments, method)
+#endif
+
 #undef __DAAL_CALL_KERNEL
 #define __DAAL_CALL_KERNEL(env, KernelClass, templateArguments, method, ...)            \
     {                                                                                   \
+        __DAAL_PROFILER_KERNEL_TASK(KernelClass, __DAAL_KERNEL_ARGUMENTS(templateArguments), method)  \
         ((KernelClass<templateArguments, cpu> *)(_kernel))->method(__VA_ARGS__);        \
     }
 
@@ -44,15 +44,44 @@ namespace kmeans
 namespace internal
 {
 
+/* Partial sums of the observations assigned to the clusters, accumulated by a thread or by a range of blocks */
+template<typename interm, CpuType cpu>
+struct partialSums
+{
+    int    * cS0;       /* Numbers of the observations in the clusters */
+    interm * cS1;       /* Sums of the observations in the clusters */
+    interm   goalFunc;  /* Partial value of the goal function */
+};
+
+template<typename interm, CpuType cpu>
+partialSums<interm,cpu> * createPartialSums(int dim, int clNum)
+{
+    partialSums<interm,cpu> * s = (partialSums<interm,cpu> *)daal::services::daal_malloc(sizeof(partialSums<interm,cpu>));
+    if(!s) { return 0; }
+
+    s->cS0      = service_calloc<int,cpu>(clNum);
+    s->cS1      = service_calloc<interm,cpu>(clNum*dim);
+    s->goalFunc = (interm)(0.0);
+    return s;
+}
+
+template<typename interm, CpuType cpu>
+void freePartialSums(partialSums<interm,cpu> * s)
+{
+    if(!s) { return; }
+
+    daal::services::daal_free( s->cS0 );
+    daal::services::daal_free( s->cS1 );
+    daal::services::daal_free( s );
+}
+
 template<typename interm, CpuType cpu>
 struct task
 {
     int      dim;
     int      clNum;
     interm * cCenters;
-    daal::tls<interm*> * goalFunc;
-    daal::tls<int   *> * cS0;
-    daal::tls<interm*> * cS1;
+    daal::partial_tls<partialSums<interm,cpu>*> * partials;
 
     int max_block_size;
 
@@ -69,11 +98,13 @@ void * kmeansInitTask(int dim, int clNum, interm * centroids)
     t->dim       = dim;
     t->clNum     = clNum;
     t->cCenters  = centroids;
-    t->goalFunc  = new daal::tls<interm*>( [=]()-> interm* { return service_calloc<interm,cpu>(1);         } );
-    t->cS0       = new daal::tls<int   *>( [=]()-> int   * { return service_calloc<int,cpu>(clNum);        } );
-    t->cS1       = new daal::tls<interm*>( [=]()-> interm* { return service_calloc<interm,cpu>(clNum*dim); } );
+    t->partials  = new daal::partial_tls<partialSums<interm,cpu>*>( [=]()-> partialSums<interm,cpu>*
+    {
+        return createPartialSums<interm,cpu>(dim, clNum);
+    } );
 
-    t->max_block_size = 512;
+    /* Rows of the data and of the distances to the centroids of the largest block fit into the cache */
+    t->max_block_size = daal::threader_get_block_size<interm>(0, dim + clNum, 0);
 
     t->clSq      = service_calloc<interm,cpu>(clNum);
     for(size_t k=0;k<clNum;k++)
@@ -91,6 +122,14 @@ void * kmeansInitTask(int dim, int clNum, interm * centroids)
     return task_id;
 }
 
+/* Returns the number of the rows in the blocks of the n rows processed by one task */
+template<typename interm, CpuType cpu>
+inline size_t getBlockSize(const struct task<interm,cpu> *t, size_t n)
+{
+    size_t blockSize = daal::threader_get_block_size<interm>(n, t->dim + t->clNum);
+    return (blockSize < (size_t)t->max_block_size ? blockSize : (size_t)t->max_block_size);
+}
+
 template<typename interm, CpuType cpu, int assignFlag>
 void addNTToTaskThreadedDense(void * task_id, const NumericTable * ntData, interm *catCoef, NumericTable * ntAssign = 0 )
 {
@@ -98,35 +137,26 @@ void addNTToTaskThreadedDense(void * task_id, const NumericTable * ntData, inter
 
     size_t n = ntData->getNumberOfRows();
 
-    size_t blockSizeDeafult = t->max_block_size;
-
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks*blockSizeDeafult != n);
+    size_t blockSizeDefault = getBlockSize<interm, cpu>(t, n);
 
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    t->partials->for_row_blocks( n, blockSizeDefault, [=](size_t iStartRow, size_t blockSize, partialSums<interm,cpu> *sums)
     {
-        size_t blockSize = blockSizeDeafult;
-        if( k == nBlocks-1 )
-        {
-            blockSize = n - k*blockSizeDeafult;
-        }
-
         BlockDescriptor<int> assignBlock;
 
         BlockMicroTable<interm, readOnly,  cpu> mtData( ntData );
         interm* data;
 
-        int*    cS0 = t->cS0->local();
-        interm* cS1 = t->cS1->local();
-        interm* trg = t->goalFunc->local();
+        int*    cS0 = sums->cS0;
+        interm* cS1 = sums->cS1;
+        interm* trg = &sums->goalFunc;
 
-        mtData.getBlockOfRows( k*blockSizeDeafult, blockSize, &data );
+        mtData.getBlockOfRows( iStartRow, blockSize, &data );
 
         int* assignments = 0;
 
         if(assignFlag)
         {
-            ntAssign->getBlockOfRows( k*blockSizeDeafult, blockSize, writeOnly, assignBlock );
+            ntAssign->getBlockOfRows( iStartRow, blockSize, writeOnly, assignBlock );
             assignments = assignBlock.getBlockPtr();
         }
 
@@ -323,26 +353,17 @@ void getNTAssignmentsThreaded(void * task_id, const NumericTable * ntData, const
 
     size_t n = ntData->getNumberOfRows();
 
-    size_t blockSizeDeafult = t->max_block_size;
-
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks*blockSizeDeafult != n);
+    size_t blockSizeDefault = getBlockSize<interm, cpu>(t, n);
 
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_row_blocks( n, blockSizeDefault, daal::autoPartitioner, [=](size_t iStartRow, size_t blockSize)
     {
-        size_t blockSize = blockSizeDeafult;
-        if( k == nBlocks-1 )
-        {
-            blockSize = n - k*blockSizeDeafult;
-        }
-
         BlockMicroTable<interm, readOnly,  cpu> mtData( ntData );
         BlockMicroTable<int   , writeOnly, cpu> mtAssign( ntAssign );
         interm* data;
         int*    assign;
 
-        mtData  .getBlockOfRows( k*blockSizeDeafult, blockSize, &data   );
-        mtAssign.getBlockOfRows( k*blockSizeDeafult, blockSize, &assign );
+        mtData  .getBlockOfRows( iStartRow, blockSize, &data   );
+        mtAssign.getBlockOfRows( iStartRow, blockSize, &assign );
 
         size_t p = t->dim;
         size_t nClusters = t->clNum;
@@ -388,34 +409,48 @@ void getNTAssignmentsThreaded(void * task_id, const NumericTable * ntData, const
     } );
 }
 
+/* Merges the partial sums of the threads or of the ranges of blocks, the merge is done once per task */
 template<typename interm, CpuType cpu>
-int kmeansUpdateCluster(void * task_id, int jidx, interm *s1)
+partialSums<interm,cpu> * kmeansMergePartialSums(struct task<interm,cpu> * t)
 {
-    int i, j;
-    struct task<interm,cpu> * t = static_cast<task<interm,cpu> *>(task_id);
-
-    int idx   = (int)jidx;
     int dim   = t->dim;
     int clNum = t->clNum;
 
-    int s0=0;
-
-    t->cS0->reduce( [&](int *v)-> void
-    {
-        s0 += v[idx];
-    } );
-
-    t->cS1->reduce( [=](interm *v)-> void
+    return t->partials->merge( [=](partialSums<interm,cpu> *dst, partialSums<interm,cpu> *src)-> void
     {
         int j;
+        for(j=0;j<clNum;j++)
+        {
+            dst->cS0[j] += src->cS0[j];
+        }
       PRAGMA_IVDEP
-        for(j=0;j<dim;j++)
+        for(j=0;j<clNum*dim;j++)
         {
-            s1[j] += v[idx*dim + j];
+            dst->cS1[j] += src->cS1[j];
         }
+        dst->goalFunc += src->goalFunc;
     } );
+}
+
+template<typename interm, CpuType cpu>
+int kmeansUpdateCluster(void * task_id, int jidx, interm *s1)
+{
+    struct task<interm,cpu> * t = static_cast<task<interm,cpu> *>(task_id);
 
-    return s0;
+    int idx   = (int)jidx;
+    int dim   = t->dim;
+
+    partialSums<interm,cpu> * sums = kmeansMergePartialSums<interm,cpu>(t);
+    if(!sums) { return 0; }
+
+    int j;
+  PRAGMA_IVDEP
+    for(j=0;j<dim;j++)
+    {
+        s1[j] += sums->cS1[idx*dim + j];
+    }
+
+    return sums->cS0[idx];
 }
 
 template<typename interm, CpuType cpu>
@@ -426,17 +461,17 @@ void kmeansClearClusters(void * task_id, interm *goalFunc)
 
     if( t->clNum != 0)
     {
-        t->cS0->reduce( [=](int *v)-> void
+        if( goalFunc!= 0 )
         {
-            daal::services::daal_free( v );
-        } );
-        delete t->cS0;
+            partialSums<interm,cpu> * sums = kmeansMergePartialSums<interm,cpu>(t);
+            *goalFunc = (sums ? sums->goalFunc : (interm)(0.0));
+        }
 
-        t->cS1->reduce( [=](interm *v)-> void
+        t->partials->reduce( [=](partialSums<interm,cpu> *v)-> void
         {
-            daal::services::daal_free( v );
+            freePartialSums<interm,cpu>( v );
         } );
-        delete t->cS1;
+        delete t->partials;
 
         t->mkl_buff->reduce( [=](interm *v)-> void
         {
@@ -447,21 +482,6 @@ void kmeansClearClusters(void * task_id, interm *goalFunc)
         daal::services::daal_free( t->clSq );
 
         t->clNum = 0;
-
-        if( goalFunc!= 0 )
-        {
-            *goalFunc = (interm)(0.0);
-
-            t->goalFunc->reduce( [=](interm *v)-> void
-            {
-                (*goalFunc) += (*v);
-            } );
-        }
-        t->goalFunc->reduce( [=](interm *v)-> void
-        {
-            daal::services::daal_free( v );
-        } );
-        delete t->goalFunc;
     }
 
     daal::services::daal_free(t);
@@ -24,8 +24,8 @@
 #ifndef __LBFGS_DENSE_DEFAULT_IMPL__
 #define __LBFGS_DENSE_DEFAULT_IMPL__
 
-#include "service_blas.h"
 #include "service_rng.h"
+#include "mse_batch.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -84,9 +84,30 @@ void LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
 
     SharedPtr<sum_of_functions::Batch> hessianFunction = gradientFunction->clone();
     hessianFunction->sumOfFunctionsParameter->batchIndices = task.ntCorrectionPairBatchIndices;
-    hessianFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::hessian;
     hessianFunction->sumOfFunctionsInput->set(sum_of_functions::argument, task.argumentLCurTable);
 
+    /* If the objective function supports it, the correction pairs use only the product of the sub-sampled
+       Hessian matrix and the vector s, so the matrix itself is never formed */
+    bool useHessianVectorProduct = supportsHessianVectorProduct(hessianFunction.get());
+    SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > hessianVectorTable(
+        new HomogenNumericTableCPU<algorithmFPType, cpu>(task.correctionS, argumentSize, 1));
+    if (useHessianVectorProduct)
+    {
+        hessianFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::hessianVectorProduct;
+
+        SharedPtr<DataCollection> hessianCollection(new DataCollection(objective_function::hessianVectorIdx + 1));
+        (*hessianCollection)[(int)objective_function::hessianVectorIdx] = hessianVectorTable;
+        SharedPtr<objective_function::Result> hessianResult(new objective_function::Result());
+        hessianResult->set(objective_function::resultCollection, hessianCollection);
+        hessianResult->allocate<algorithmFPType>(hessianFunction->sumOfFunctionsInput,
+                                                 hessianFunction->sumOfFunctionsParameter, 0);
+        hessianFunction->setResult(hessianResult);
+    }
+    else
+    {
+        hessianFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::hessian;
+    }
+
     BlockDescriptor<algorithmFPType> gradientBlock;
     BlockDescriptor<algorithmFPType> hessianBlock;
     SharedPtr<NumericTable> ntGradient;
@@ -130,6 +151,12 @@ void LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
         {
             /* Compute new correction pair */
             correctionIndex = mod(correctionIndex + 1, m);
+            algorithmFPType *correctionS = task.correctionS + correctionIndex * argumentSize;
+            for (size_t j = 0; j < argumentSize; j++)
+            {
+                correctionS[j] = argumentLCur[j] - argumentLPrev[j];
+            }
+            hessianVectorTable->setArray(correctionS);
 
             updateBatchIndices(nTerms, correctionPairBatchSize, &(task.correctionPairBatchIndices),
                                task.correctionPairBatchIndicesStatus, task.mtCorrectionPairBatchIndices,
@@ -139,13 +166,24 @@ void LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
             if (hessianFunction->getErrors()->size() != 0) { setNIterations(result->get(lbfgs::nIterations).get(), epoch); return; }
             if (task.correctionPairBatchIndicesStatus == user) { task.mtCorrectionPairBatchIndices.release(); }
 
-            ntHessian = hessianFunction->getResult()->get(objective_function::resultCollection, objective_function::hessianIdx);
-            ntHessian->getBlockOfRows(0, argumentSize, readOnly, hessianBlock);
-
-            computeCorrectionPair(argumentSize, argumentLCur, argumentLPrev, hessianBlock.getBlockPtr(),
-                task.correctionS + correctionIndex * argumentSize,
-                task.correctionY + correctionIndex * argumentSize, &(task.rho[correctionIndex]));
-
+            algorithmFPType *correctionY = task.correctionY + correctionIndex * argumentSize;
+            if (useHessianVectorProduct)
+            {
+                ntHessian = hessianFunction->getResult()->get(objective_function::resultCollection,
+                                                              objective_function::hessianVectorProductIdx);
+                ntHessian->getBlockOfRows(0, 1, readOnly, hessianBlock);
+                computeCorrectionPair(argumentSize, hessianBlock.getBlockPtr(), correctionS,
+                    correctionY, &(task.rho[correctionIndex]));
+            }
+            else
+            {
+                ntHessian = hessianFunction->getResult()->get(objective_function::resultCollection,
+                                                              objective_function::hessianIdx);
+                ntHessian->getBlockOfRows(0, argumentSize, readOnly, hessianBlock);
+                computeHessianVectorProduct(argumentSize, hessianBlock.getBlockPtr(), correctionS, correctionY);
+                computeCorrectionPair(argumentSize, correctionY, correctionS,
+                    correctionY, &(task.rho[correctionIndex]));
+            }
             ntHessian->releaseBlockOfRows(hessianBlock);
         }
         for (size_t j = 0; j < argumentSize; j++)
@@ -355,35 +393,29 @@ void LBFGSKernel<algorithmFPType, defaultDense, cpu>::twoLoopRecursion(
 }
 
 /**
- * Computes the correction pair (s, y) and the corresponding value rho
+ * Computes the part y of the correction pair (s, y) and the corresponding value rho
  *
- * \param[in]  argumentSize   Number of elements in the argument of objective function
- * \param[in]  argumentLCur   Average of objective function arguments for the last L iterations. See formula (2.1) in [1]
- * \param[in]  argumentLPrev  Average of objective function arguments for the previous L iterations. See formula (2.1) in [1]
- * \param[in]  hessian        Approximation of Hessian matrix of the objective function on the current iteration
- * \param[out] s              Part of the correction pair. See formula (2.1) in [1]
- * \param[out] y              Part of the correction pair. See formula (2.2) in [1]
- * \param[out] rhoPtr         Pointer to the value rho of BFGS update that corresponds to pair (s, y).
- *                            See formula (7.17) in [2]
+ * \param[in]  argumentSize          Number of elements in the argument of objective function
+ * \param[in]  hessianVectorProduct  Approximation of Hessian matrix of the objective function on the current iteration
+ *                                   multiplied by s
+ * \param[in]  s                     Part of the correction pair. See formula (2.1) in [1]
+ * \param[out] y                     Part of the correction pair. See formula (2.2) in [1]
+ * \param[out] rhoPtr                Pointer to the value rho of BFGS update that corresponds to pair (s, y).
+ *                                   See formula (7.17) in [2]
  */
 template<typename algorithmFPType, CpuType cpu>
 void LBFGSKernel<algorithmFPType, defaultDense, cpu>::computeCorrectionPair(
-            size_t argumentSize,
-            const algorithmFPType *argumentLCur, const algorithmFPType *argumentLPrev, algorithmFPType *hessian,
-            algorithmFPType *s, algorithmFPType *y, algorithmFPType *rhoPtr)
+            size_t argumentSize, const algorithmFPType *hessianVectorProduct,
+            const algorithmFPType *s, algorithmFPType *y, algorithmFPType *rhoPtr)
 {
-    for (size_t j = 0; j < argumentSize; j++)
+    if (y != hessianVectorProduct)
     {
-        s[j] = argumentLCur[j] - argumentLPrev[j];
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            y[j] = hessianVectorProduct[j];
+        }
     }
 
-    char trans = 'N';
-    algorithmFPType zero = 0.0;
-    algorithmFPType one = 1.0;
-    MKL_INT n = (MKL_INT)argumentSize;
-    MKL_INT ione = 1;
-    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &n, &one, hessian, &n, s, &ione, &zero, y, &ione);
-
     algorithmFPType rho = dotProduct(argumentSize, s, y);
     if (rho != 0.0) // threshold
     {
@@ -392,6 +424,46 @@ void LBFGSKernel<algorithmFPType, defaultDense, cpu>::computeCorrectionPair(
     *rhoPtr = rho;
 }
 
+/**
+ * Computes the product of the full Hessian matrix and the vector s.
+ * The Hessian matrix is symmetric, so its rows are multiplied by s. Used when the objective function does not support the hessian-vector product result
+ *
+ * \param[in]  argumentSize          Number of elements in the argument of objective function
+ * \param[in]  hessian               Approximation of Hessian matrix of the objective function on the current iteration
+ * \param[in]  s                     Part of the correction pair. See formula (2.1) in [1]
+ * \param[out] hessianVectorProduct  Hessian matrix multiplied by s
+ */
+template<typename algorithmFPType, CpuType cpu>
+void LBFGSKernel<algorithmFPType, defaultDense, cpu>::computeHessianVectorProduct(
+            size_t argumentSize, const algorithmFPType *hessian, const algorithmFPType *s, algorithmFPType *hessianVectorProduct)
+{
+    for (size_t i = 0; i < argumentSize; i++)
+    {
+        const algorithmFPType *hessianRow = hessian + i * argumentSize;
+        algorithmFPType sum = 0.0;
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            sum += hessianRow[j] * s[j];
+        }
+        hessianVectorProduct[i] = sum;
+    }
+}
+
+/**
+ * Checks whether the objective function computes the hessian-vector product result.
+ * Other objective functions, including the user-defined ones, are given the full Hessian matrix request
+ *
+ * \param[in]  function  Objective function
+ * 
+eturn true if the objective function supports the hessian-vector product result
+ */
+template<typename algorithmFPType, CpuType cpu>
+bool LBFGSKernel<algorithmFPType, defaultDense, cpu>::supportsHessianVectorProduct(sum_of_functions::Batch *function)
+{
+    return (dynamic_cast<mse::Batch<float,  mse::defaultDense> *>(function) != 0 ||
+            dynamic_cast<mse::Batch<double, mse::defaultDense> *>(function) != 0);
+}
+
 /**
  * Creates structure for storing data used in itermediate computations in LBFGS algorithm
  *
@@ -84,10 +84,22 @@ protected:
                 algorithmFPType *alpha);
 
     /*
-     * Computes the correction pair (s, y) and the corresponding value rho
+     * Computes the part y of the correction pair (s, y) from the Hessian-vector product
+     * and the corresponding value rho
      */
-    void computeCorrectionPair(size_t argumentSize, const algorithmFPType *argumentLCur, const algorithmFPType *argumentLPrev,
-                algorithmFPType *hessian, algorithmFPType *s, algorithmFPType *y, algorithmFPType *rhoPtr);
+    void computeCorrectionPair(size_t argumentSize, const algorithmFPType *hessianVectorProduct,
+                const algorithmFPType *s, algorithmFPType *y, algorithmFPType *rhoPtr);
+
+    /*
+     * Computes the product of the full Hessian matrix and the vector s
+     */
+    void computeHessianVectorProduct(size_t argumentSize, const algorithmFPType *hessian, const algorithmFPType *s,
+                algorithmFPType *hessianVectorProduct);
+
+    /*
+     * Checks whether the objective function computes the hessian-vector product result
+     */
+    bool supportsHessianVectorProduct(sum_of_functions::Batch *function);
 
     void setNIterations(NumericTable *nIterationsTable, size_t nIterations);
 };
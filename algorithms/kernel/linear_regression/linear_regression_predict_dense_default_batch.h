@@ -71,6 +71,10 @@ protected:
     void computeBlockOfResponses(MKL_INT *numFeatures, MKL_INT *numRows, algorithmFpType *dataBlock,
                                  MKL_INT *numBetas, algorithmFpType *beta,
                                  MKL_INT *numResponses, algorithmFpType *responseBlock, bool findBeta0);
+
+    void computeSparseBlockOfResponses(size_t numRows, const algorithmFpType *values, const size_t *colIndices,
+                                       const size_t *rowOffsets, size_t numBetas, const algorithmFpType *beta,
+                                       size_t numResponses, algorithmFpType *responseBlock, bool findBeta0);
 };
 
 } // namespace internal
@@ -26,6 +26,7 @@
 
 #include "algorithm.h"
 #include "numeric_table.h"
+#include "csr_numeric_table.h"
 #include "linear_regression_training_batch.h"
 #include "linear_regression_training_online.h"
 #include "linear_regression_training_distributed.h"
@@ -95,6 +96,48 @@ void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::computeB
 
 }
 
+/**
+ *  \brief Function that computes linear regression prediction results
+ *         for a block of input data rows stored in the CSR layout.
+ *         Only the non-zero values of the rows are visited
+ *
+ *  \param numRows[in]          Number of input data rows
+ *  \param values[in]           Non-zero values of the block of input data rows
+ *  \param colIndices[in]       One-based column indices of the non-zero values
+ *  \param rowOffsets[in]       One-based offsets of the rows in the array of non-zero values
+ *  \param numBetas[in]         Number of regression coefficients
+ *  \param beta[in]             Regression coefficients
+ *  \param numResponses[in]     Number of responses to calculate for each input data row
+ *  \param responseBlock[out]   Resulting block of responses
+ *  \param findBeta0[in]        Flag. True if regression coefficient contain intercept term;
+ *                              false - otherwise.
+ */
+template<typename algorithmFpType, CpuType cpu>
+void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::computeSparseBlockOfResponses(
+            size_t numRows, const algorithmFpType *values, const size_t *colIndices, const size_t *rowOffsets,
+            size_t numBetas, const algorithmFpType *beta,
+            size_t numResponses, algorithmFpType *responseBlock, bool findBeta0)
+{
+    for (size_t i = 0; i < numRows; i++)
+    {
+        algorithmFpType *response = responseBlock + i * numResponses;
+        for (size_t j = 0; j < numResponses; j++)
+        {
+            response[j] = (findBeta0 ? beta[j * numBetas] : (algorithmFpType)0.0);
+        }
+
+        for (size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+        {
+            /* Column indices are one-based, so they skip the intercept term of the coefficients */
+            const algorithmFpType *betaColumn = beta + colIndices[k];
+            for (size_t j = 0; j < numResponses; j++)
+            {
+                response[j] += values[k] * betaColumn[j * numBetas];
+            }
+        }
+    }
+}
+
 template<typename algorithmFpType, CpuType cpu>
 void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::compute(
             const NumericTable *a, const daal::algorithms::Model *m, NumericTable *r,
@@ -108,6 +151,11 @@ void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::compute(
     NumericTable *dataTable = const_cast<NumericTable *>(a);
     BlockDescriptor<algorithmFpType> dataBM;
 
+    /* Input data in the CSR layout is processed without conversion to the dense layout */
+    CSRNumericTableIface *csrDataTable = (dataTable->getDataLayout() == NumericTableIface::csrArray ?
+                                          dynamic_cast<CSRNumericTableIface *>(dataTable) : NULL);
+    CSRBlockDescriptor<algorithmFpType> dataCSRBM;
+
     /* Get numeric table to store results */
     BlockDescriptor<algorithmFpType> responseBM;
 
@@ -147,16 +195,31 @@ void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::compute(
 
         /* Retrieve data blocks associated with input and resulting tables */
         algorithmFpType *dataBlock, *responseBlock;
-        dataTable->getBlockOfRows(startRow, endRow, readOnly,  dataBM);
-        dataBlock = dataBM.getBlockPtr();
-        r        ->getBlockOfRows(startRow, endRow, writeOnly, responseBM);
+        r        ->getBlockOfRows(startRow, numRows, writeOnly, responseBM);
         responseBlock = responseBM.getBlockPtr();
 
-        /* Calculate predictions */
-        computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &nAllBetas,
-                                beta, &numResponses, responseBlock, findBeta0);
+        if (csrDataTable)
+        {
+            csrDataTable->getSparseBlock(startRow, numRows, readOnly, dataCSRBM);
+
+            computeSparseBlockOfResponses(numRows, dataCSRBM.getBlockValuesPtr(), dataCSRBM.getBlockColumnIndicesPtr(),
+                                          dataCSRBM.getBlockRowIndicesPtr(), nAllBetas, beta, numResponses,
+                                          responseBlock, findBeta0);
+
+            csrDataTable->releaseSparseBlock(dataCSRBM);
+        }
+        else
+        {
+            dataTable->getBlockOfRows(startRow, numRows, readOnly,  dataBM);
+            dataBlock = dataBM.getBlockPtr();
+
+            /* Calculate predictions */
+            computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &nAllBetas,
+                                    beta, &numResponses, responseBlock, findBeta0);
+
+            dataTable->releaseBlockOfRows(dataBM);
+        }
 
-        dataTable->releaseBlockOfRows(dataBM);
         r        ->releaseBlockOfRows(responseBM);
     }
 
@@ -32,6 +32,7 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "boosting_stump_ensemble.h"
 #include "logitboost_impl.i"
 
 using namespace daal::algorithms::logitboost::internal;
@@ -60,6 +61,16 @@ void LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::compute( servi
     algorithmFPType *F;      /* Additive function values */
     Model *boostModel = const_cast<Model *>(m);
 
+    /* If all weak learners are decision stumps predicted by the stump prediction algorithm,
+       the whole ensemble is evaluated on blocks of observations in parallel */
+    boosting::internal::StumpEnsemble<algorithmFPType, cpu> stumps;
+    if (boosting::internal::StumpEnsemble<algorithmFPType, cpu>::isStumpPrediction(parameter->weakLearnerPrediction.get()) &&
+        stumps.init(boostModel, M * nc))
+    {
+        computeWithStumps(a, stumps, M, nc, r);
+        return;
+    }
+
     /* Allocate memory */
     pred = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
     F    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
@@ -120,6 +131,81 @@ void LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::compute( servi
     daal::services::daal_free (pred);
 }
 
+/**
+ *  Computes the additive function values and the class labels block by block,
+ *  the observations of a block are processed by all weak learners of the model
+ */
+template<typename algorithmFPType, CpuType cpu>
+void LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::computeWithStumps( services::SharedPtr<NumericTable> a,
+        const boosting::internal::StumpEnsemble<algorithmFPType, cpu> &stumps, size_t M, size_t nc, NumericTable *r )
+{
+    size_t dim = a->getNumberOfColumns();
+    size_t n   = a->getNumberOfRows();
+    const size_t blockSize = boosting::internal::stumpEnsembleRowBlockSize;
+    const size_t nBlocks = n / blockSize + (n % blockSize > 0 ? 1 : 0);
+
+    /* Responses of the weak learners and additive function values for a block of observations */
+    daal::tls<algorithmFPType *> tlsBuffer( [=]()-> algorithmFPType *
+    {
+        return (algorithmFPType *)daal::services::daal_malloc(2 * blockSize * nc * sizeof(algorithmFPType));
+    } );
+
+    int *cl;
+    BlockDescriptor<int> block;
+    r->getBlockOfColumnValues( 0, 0, n, writeOnly, block );
+    cl = block.getBlockPtr();
+
+    bool isMemoryAllocated = true;
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        algorithmFPType *pred = tlsBuffer.local();
+        if (!pred) { isMemoryAllocated = false; return; }
+
+        const size_t i0 = iBlock * blockSize;
+        const size_t nRows = (i0 + blockSize < n ? blockSize : n - i0);
+        algorithmFPType *F = pred + blockSize * nc;
+        daal::services::internal::service_memset<algorithmFPType, cpu>(F, 0, nRows * nc);
+
+        BlockDescriptor<algorithmFPType> xBlock;
+        a->getBlockOfRows(i0, nRows, readOnly, xBlock);
+        const algorithmFPType *x = xBlock.getBlockPtr();
+
+        for ( size_t m = 0; m < M; m++ )
+        {
+            for (size_t j = 0; j < nc; j++)
+            {
+                stumps.computeResponses(m * nc + j, x, nRows, dim, pred + j * nRows);
+            }
+            UpdateF<algorithmFPType, cpu>( dim, nRows, nc, pred, F );
+        }
+        a->releaseBlockOfRows(xBlock);
+
+        for ( size_t i = 0; i < nRows; i++ )
+        {
+            int idx = 0;
+            algorithmFPType fmax = F[i * nc];
+            for ( size_t j = 1; j < nc; j++ )
+            {
+                if ( F[i * nc + j] > fmax )
+                {
+                    idx = (int)j;
+                    fmax = F[i * nc + j];
+                }
+            }
+            cl[i0 + i] = idx;
+        }
+    } );
+
+    tlsBuffer.reduce( [=](algorithmFPType *pred)-> void
+    {
+        daal::services::daal_free(pred);
+    } );
+
+    r->releaseBlockOfColumnValues( block );
+
+    if (!isMemoryAllocated) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
 } // namepsace internal
 } // namespace prediction
 } // namespace logitboost
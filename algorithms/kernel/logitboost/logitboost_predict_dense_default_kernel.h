@@ -28,6 +28,7 @@
 #include "numeric_table.h"
 #include "logitboost_model.h"
 #include "daal_defines.h"
+#include "boosting_stump_ensemble.h"
 
 #include "logitboost_predict_kernel.h"
 
@@ -50,6 +51,10 @@ template<typename algorithmFPType, CpuType cpu>
 struct LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu> : public Kernel
 {
     void compute( services::SharedPtr<NumericTable> a, const Model *m, NumericTable *r, const Parameter *par );
+
+protected:
+    void computeWithStumps( services::SharedPtr<NumericTable> a, const boosting::internal::StumpEnsemble<algorithmFPType, cpu> &stumps,
+                            size_t M, size_t nc, NumericTable *r );
 };
 
 } // namepsace internal
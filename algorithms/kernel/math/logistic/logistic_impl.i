@@ -82,18 +82,12 @@ void LogisticKernel<algorithmFPType, method, cpu>::compute(const Input *input, R
     size_t nInputRows    = inputTable->getNumberOfRows();
     size_t nInputColumns = inputTable->getNumberOfColumns();
 
-    size_t nBlocks = nInputRows / _nRowsInBlock;
-    nBlocks += (nBlocks * _nRowsInBlock != nInputRows);
+    const size_t nRowsInBlock = daal::threader_get_block_size<algorithmFPType>(nInputRows, nInputColumns);
 
-    daal::threader_for(nBlocks, nBlocks, [ = ](int block)
+    daal::threader_for_row_blocks(nInputRows, nRowsInBlock, daal::autoPartitioner,
+                                  [ = ](size_t iStartRow, size_t nRowsToProcess)
     {
-        size_t nRowsToProcess = _nRowsInBlock;
-        if( block == nBlocks - 1 )
-        {
-            nRowsToProcess = nInputRows - block * _nRowsInBlock;
-        }
-
-        processBlock(inputTable, nInputColumns, block * _nRowsInBlock, nRowsToProcess, resultTable);
+        processBlock(inputTable, nInputColumns, iStartRow, nRowsToProcess, resultTable);
     } );
 }
 
@@ -52,8 +52,6 @@ public:
     void compute(const Input *input, Result *result);
 
 private:
-    const size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
                              SharedPtr<NumericTable> resultTable);
 };
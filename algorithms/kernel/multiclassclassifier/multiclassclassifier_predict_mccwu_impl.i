@@ -40,6 +40,7 @@
 #include "service_data_utils.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
+#include "service_defines.h"
 
 #include "service_blas.h"
 
@@ -71,42 +72,79 @@ void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgai
 
     size_t nFeatures = a->getNumberOfColumns();
     size_t nVectors  = a->getNumberOfRows();
+    size_t nPairs    = nClasses * (nClasses - 1) / 2;
 
     size_t nRowsInBlock = getMultiClassClassifierPredictBlockSize<algorithmFPType, cpu>();
     /* Calculate number of blocks of rows including tail block */
     size_t nBlocks = nVectors / nRowsInBlock;
     if (nBlocks * nRowsInBlock < nVectors) { nBlocks++; }
 
+    /* Blocks of rows are processed by chunks. The 2-class probabilities of all observations of a chunk
+       are computed in parallel over the "simple" classifiers and the blocks of rows,
+       then the multiclass probabilities are computed in parallel over the blocks of rows */
+    size_t nBlocksInChunk = daal::threader_get_threads_number();
+    if (nBlocksInChunk == 0) { nBlocksInChunk = 1; }
+    if (nBlocksInChunk > nBlocks) { nBlocksInChunk = nBlocks; }
+    size_t nRowsInChunk = nBlocksInChunk * nRowsInBlock;
+
     services::SharedPtr<classifier::Model> *simpleModels = model->getTwoClassClassifierModels();
 
     /* Allocate data for storing intermediate results */
+    algorithmFPType *pairProb = (algorithmFPType *)daal::services::daal_malloc(
+                                    (nPairs * nRowsInChunk > 0 ? nPairs * nRowsInChunk : 1) * sizeof(algorithmFPType));
+    if (!pairProb) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
     /* Allocate thread local storage */
     daal::tls<MultiClassClassifierTls<algorithmFPType, cpu> *> tls([=]()
     {
         return new MultiClassClassifierTls<algorithmFPType, cpu>(
-                nClasses, nRowsInBlock, a, r, mccPar->prediction);
+                nClasses, a, r, mccPar->prediction);
     } );
 
-    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    bool isErrorFound = false;
+    for (size_t iChunk = 0; iChunk < nBlocks && !isErrorFound; iChunk += nBlocksInChunk)
     {
-        size_t startRow = iBlock * nRowsInBlock;
-        size_t nRows = nRowsInBlock;
-        if (startRow + nRows > nVectors) { nRows = nVectors - startRow; }
-
-        MultiClassClassifierTls<algorithmFPType, cpu> *localValues = tls.local();
-        MicroTable *mtX = localValues->mtX;
-        FeatureMicroTable <int, writeOnly, cpu> &mtR = localValues->mtR;
-        services::SharedPtr<classifier::prediction::Batch> simplePrediction = localValues->simplePrediction;
-        algorithmFPType *buffer = localValues->buffer;
-        services::Error &localError = localValues->error;
-        int oldNumberOfThreads = fpk_serv_set_num_threads_local(1);
-        getBlockOfRowsOfResults(nFeatures, startRow, nRows, nClasses, mtX, mtR,
-                                simplePrediction, simpleModels,
-                                nIter, eps, buffer, localError);
-        fpk_serv_set_num_threads_local(oldNumberOfThreads);
-        if(localError.id() != services::NoErrorMessageFound) { return; }
-    } );
+        size_t nChunkBlocks = nBlocksInChunk;
+        if (iChunk + nChunkBlocks > nBlocks) { nChunkBlocks = nBlocks - iChunk; }
+
+        /* Get 2-class probabilities, consecutive tasks share the "simple" classifier */
+        size_t nTasks = nPairs * nChunkBlocks;
+        daal::threader_for(nTasks, nTasks, [&](size_t iTask)
+        {
+            size_t imodel = iTask / nChunkBlocks;
+            size_t iBlock = iTask % nChunkBlocks;
+            size_t startRow = (iChunk + iBlock) * nRowsInBlock;
+            size_t nRows = nRowsInBlock;
+            if (startRow + nRows > nVectors) { nRows = nVectors - startRow; }
+
+            MultiClassClassifierTls<algorithmFPType, cpu> *localValues = tls.local();
+            services::Error &localError = localValues->error;
+            if(localError.id() != services::NoErrorMessageFound) { return; }
+            int oldNumberOfThreads = fpk_serv_set_num_threads_local(1);
+            get2ClassProbabilities(nFeatures, startRow, nRows, localValues->mtX,
+                                   localValues->simplePrediction, simpleModels[imodel],
+                                   pairProb + imodel * nRowsInChunk + iBlock * nRowsInBlock, localError);
+            fpk_serv_set_num_threads_local(oldNumberOfThreads);
+        } );
+
+        tls.reduce([&](MultiClassClassifierTls<algorithmFPType, cpu> *localValues)
+        {
+            if(localValues->error.id() != services::NoErrorMessageFound) { isErrorFound = true; }
+        } );
+        if (isErrorFound) { break; }
+
+        /* Get multiclass classification results */
+        daal::threader_for(nChunkBlocks, nChunkBlocks, [&](size_t iBlock)
+        {
+            size_t startRow = (iChunk + iBlock) * nRowsInBlock;
+            size_t nRows = nRowsInBlock;
+            if (startRow + nRows > nVectors) { nRows = nVectors - startRow; }
+
+            MultiClassClassifierTls<algorithmFPType, cpu> *localValues = tls.local();
+            getBlockOfRowsOfResults(startRow, nRows, nClasses, pairProb + iBlock * nRowsInBlock, nRowsInChunk,
+                                    localValues->mtR, nIter, eps, localValues->buffer);
+        } );
+    }
 
     tls.reduce([=](MultiClassClassifierTls<algorithmFPType, cpu> *localValues)
     {
@@ -116,35 +154,52 @@ void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgai
         }
         delete localValues;
     } );
+
+    daal::services::daal_free(pairProb);
 }
 
 template<typename algorithmFPType, CpuType cpu>
 inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, algorithmFPType, cpu>::
-    getBlockOfRowsOfResults(size_t nFeatures, size_t startRow, size_t nRows, size_t nClasses,
-                            MicroTable *mtX, FeatureMicroTable<int, writeOnly, cpu> &mtR,
-                            services::SharedPtr<classifier::prediction::Batch> simplePrediction,
-                            services::SharedPtr<classifier::Model> *simpleModels,
-                            size_t nIter, double eps, algorithmFPType *buffer,
-                            services::Error &error)
+    getBlockOfRowsOfResults(size_t startRow, size_t nRows, size_t nClasses,
+                            const algorithmFPType *pairProb, size_t pairProbStride,
+                            FeatureMicroTable<int, writeOnly, cpu> &mtR,
+                            size_t nIter, double eps, algorithmFPType *buffer)
 {
+    algorithmFPType zero = 0.0;
     algorithmFPType one = 1.0;
     algorithmFPType invNClasses = one / (algorithmFPType)nClasses;
 
-    algorithmFPType *rProb = buffer;
-    algorithmFPType *Q     = rProb + nRows * nClasses * nClasses;
-    algorithmFPType *Qp    = Q     + nClasses * nClasses;
-    algorithmFPType *p     = Qp    + nClasses;
-    algorithmFPType *y     = p     + nClasses;
+    size_t nClassesSq = nClasses * nClasses;
+    algorithmFPType *rProb  = buffer;
+    algorithmFPType *rProbT = rProb  + nClassesSq;
+    algorithmFPType *Q      = rProbT + nClassesSq;
+    algorithmFPType *Qp     = Q      + nClassesSq;
+    algorithmFPType *p      = Qp     + nClasses;
 
-    /* Get 2-class probabilities */
-    get2ClassProbabilities(nFeatures, startRow, nRows, nClasses, mtX, y,
-                           simplePrediction, simpleModels, rProb, error);
-    if(error.id() != services::NoErrorMessageFound) { return; }
+    /* The diagonal elements do not contribute to the matrix Q and to the objective function */
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        rProb [i * nClasses + i] = zero;
+        rProbT[i * nClasses + i] = zero;
+    }
 
-    algorithmFPType *rProbPtr = rProb;
-    size_t nClassesSq = nClasses * nClasses;
-    for (size_t k = 0; k < nRows; k++, rProbPtr += nClassesSq)
+    int *label;
+    mtR.getBlockOfColumnValues(0, startRow, nRows, &label);
+    for (size_t k = 0; k < nRows; k++)
     {
+        /* Get matrix of 2-class probabilities and its transposition */
+        for (size_t i = 1, imodel = 0; i < nClasses; i++)
+        {
+            for (size_t j = 0; j < i; j++, imodel++)
+            {
+                algorithmFPType pji = pairProb[imodel * pairProbStride + k];
+                rProb [i * nClasses + j] = one - pji;
+                rProb [j * nClasses + i] = pji;
+                rProbT[j * nClasses + i] = one - pji;
+                rProbT[i * nClasses + j] = pji;
+            }
+        }
+
         /* Set initial probabilities */
         for (size_t j = 0; j < nClasses; j++)
         {
@@ -152,14 +207,14 @@ inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::
         }
 
         /* Calculate matrix Q */
-        computeQ(nClasses, rProbPtr, Q);
+        computeQ(nClasses, rProb, rProbT, Q);
 
         algorithmFPType objFuncPrev;
         objFuncPrev = daal::DataFeatureUtils::internal::MaxVal<algorithmFPType, cpu>::get();
         for (size_t it = 0; it < nIter; it++)
         {
             /* Check convergence criteria */
-            algorithmFPType objFunc = computeObjFunc(nClasses, p, rProbPtr);
+            algorithmFPType objFunc = computeObjFunc(nClasses, p, rProb, rProbT);
             if (sFabs<algorithmFPType, cpu>(objFunc - objFuncPrev) < eps) { break; }
             objFuncPrev = objFunc;
 
@@ -168,29 +223,27 @@ inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::
         }
 
         /* Calculate resulting classes labels */
-        int *label;
         algorithmFPType maxProb = p[0];
-        mtR.getBlockOfColumnValues(0, startRow + k, 1, &label);
-        label[0] = 0;
+        label[k] = 0;
         for (int j = 1; j < nClasses; j++)
         {
             if (p[j] > maxProb)
             {
                 maxProb = p[j];
-                label[0] = j;
+                label[k] = j;
             }
         }
-        mtR.release();
     }
+    mtR.release();
 }
 
 template<typename algorithmFPType, CpuType cpu>
 inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, algorithmFPType, cpu>::
-    get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows, size_t nClasses,
-                           MicroTable *mtX, algorithmFPType *y,
+    get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows,
+                           MicroTable *mtX,
                            services::SharedPtr<classifier::prediction::Batch> simplePrediction,
-                           services::SharedPtr<classifier::Model> *simpleModels,
-                           algorithmFPType *rProb, services::Error &error)
+                           services::SharedPtr<classifier::Model> simpleModel,
+                           algorithmFPType *prob, services::Error &error)
 {
     algorithmFPType one = 1.0;
     services::SharedPtr<NumericTable> xTable;
@@ -209,36 +262,37 @@ inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::
                 startRow, nRows, &x);
         xTable = services::SharedPtr<NumericTable>(new HomogenNumericTableCPU<algorithmFPType, cpu> (x, nFeatures, nRows));
     }
-    services::SharedPtr<NumericTable> yTable (new HomogenNumericTableCPU<algorithmFPType, cpu> (y, 1, nRows));
+    services::SharedPtr<NumericTable> yTable (new HomogenNumericTableCPU<algorithmFPType, cpu> (prob, 1, nRows));
 
     services::SharedPtr<classifier::prediction::Result> yRes(new classifier::prediction::Result());
-    if (!xTable || !yTable || !yRes) { error.setId(services::ErrorMemoryAllocationFailed); return; }
-    yRes->set(classifier::prediction::prediction, yTable);
-    for (size_t i = 1, imodel = 0; i < nClasses; i++)
+    if (!xTable || !yTable || !yRes) { error.setId(services::ErrorMemoryAllocationFailed); }
+    else
     {
-        for (size_t j = 0; j < i; j++, imodel++)
-        {
-            /* Compute prediction of the "simple" classifier for pair of labels (i, j) */
-
-            simplePrediction->input.set(classifier::prediction::data, xTable);
-            simplePrediction->input.set(classifier::prediction::model, simpleModels[imodel]);
+        yRes->set(classifier::prediction::prediction, yTable);
 
-            simplePrediction->setResult(yRes);
-            simplePrediction->compute();
-            if (simplePrediction->getErrors()->size() != 0)
-            { error.setId(services::ErrorMultiClassFailedToComputeTwoClassPrediction); return; }
+        /* Compute prediction of the "simple" classifier for pair of labels (i, j) */
+        simplePrediction->input.set(classifier::prediction::data, xTable);
+        simplePrediction->input.set(classifier::prediction::model, simpleModel);
 
+        simplePrediction->setResult(yRes);
+        simplePrediction->compute();
+        if (simplePrediction->getErrors()->size() != 0)
+        {
+            error.setId(services::ErrorMultiClassFailedToComputeTwoClassPrediction);
+        }
+        else
+        {
             /* Use sigmoid to calculate probabilities */
-            vExp<cpu>(nRows, y, y);
-            algorithmFPType *rProbPtr = rProb;
-            for (size_t k = 0; k < nRows; k++, rProbPtr += nClasses * nClasses)
+            vExp<cpu>(nRows, prob, prob);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < nRows; k++)
             {
-                algorithmFPType p = one / (one + y[k]);
-                rProbPtr[i * nClasses + j] = one - p;
-                rProbPtr[j * nClasses + i] = p;
+                prob[k] = one / (one + prob[k]);
             }
         }
     }
+
     if (mtX->getDataLayout() == NumericTableIface::csrArray)
     {
         static_cast<CSRBlockMicroTable<algorithmFPType, readOnly, cpu> *>(mtX)->release();
@@ -251,43 +305,41 @@ inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::
 
 template<typename algorithmFPType, CpuType cpu>
 inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, algorithmFPType, cpu>::
-    computeQ(size_t nClasses, const algorithmFPType *rProb, algorithmFPType *Q)
+    computeQ(size_t nClasses, const algorithmFPType *rProb, const algorithmFPType *rProbT, algorithmFPType *Q)
 {
     algorithmFPType zero = 0.0;
     for (size_t i = 0; i < nClasses; i++)
     {
-        Q[i * nClasses + i] = zero;
-        for (size_t j = 0; j < i; j++)
-        {
-            algorithmFPType rProbJI = rProb[j * nClasses + i];
-            Q[i * nClasses + i] +=  rProbJI * rProbJI;
-            Q[i * nClasses + j]  = -rProb[i * nClasses + j] * rProbJI;
-            Q[j * nClasses + i]  = Q[i * nClasses + j];
-        }
-        for (size_t j = i + 1; j < nClasses; j++)
+        const algorithmFPType *rProbI  = rProb  + i * nClasses;
+        const algorithmFPType *rProbTI = rProbT + i * nClasses;
+        algorithmFPType *QI = Q + i * nClasses;
+        algorithmFPType Qii = zero;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nClasses; j++)
         {
-            algorithmFPType rProbJI = rProb[j * nClasses + i];
-            Q[i * nClasses + i] +=  rProbJI * rProbJI;
+            Qii  += rProbTI[j] * rProbTI[j];
+            QI[j] = -rProbI[j] * rProbTI[j];
         }
+        QI[i] = Qii;
     }
 }
 
 template<typename algorithmFPType, CpuType cpu>
 inline algorithmFPType MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, algorithmFPType, cpu>::
-    computeObjFunc(size_t nClasses, algorithmFPType *p, algorithmFPType *rProb)
+    computeObjFunc(size_t nClasses, const algorithmFPType *p, const algorithmFPType *rProb, const algorithmFPType *rProbT)
 {
     algorithmFPType objFunc = 0.0;
     for (size_t i = 0; i < nClasses; i++)
     {
-        algorithmFPType diff;
-        for (size_t j = 0; j < i; j++)
-        {
-            diff = rProb[i * nClasses + j] * p[i] + rProb[j * nClasses + i] * p[j];
-            objFunc += diff * diff;
-        }
-        for (size_t j = i + 1; j < nClasses; j++)
+        const algorithmFPType *rProbI  = rProb  + i * nClasses;
+        const algorithmFPType *rProbTI = rProbT + i * nClasses;
+        algorithmFPType pi = p[i];
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nClasses; j++)
         {
-            diff = rProb[i * nClasses + j] * p[i] + rProb[j * nClasses + i] * p[j];
+            algorithmFPType diff = rProbI[j] * pi + rProbTI[j] * p[j];
             objFunc += diff * diff;
         }
     }
@@ -305,15 +357,21 @@ inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::
     /* Calculate Q*p */
     for (size_t i = 0; i < nClasses; i++)
     {
-        Qp[i] = zero;
+        const algorithmFPType *QI = Q + i * nClasses;
+        algorithmFPType QpI = zero;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
         for (size_t j = 0; j < nClasses; j++)
         {
-            Qp[i] += Q[i * nClasses + j] * p[j];
+            QpI += QI[j] * p[j];
         }
+        Qp[i] = QpI;
     }
 
     /* Calculate p'*Q*p */
     algorithmFPType pQp = zero;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
     for (size_t j = 0; j < nClasses; j++)
     {
         pQp += p[j] * Qp[j];
@@ -321,6 +379,8 @@ inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::
 
     /* Update probabilities p */
     algorithmFPType sumP = zero;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
     for (size_t j = 0; j < nClasses; j++)
     {
         p[j] = (pQp - Qp[j] + Q[j * nClasses + j] * p[j]) / Q[j * nClasses + j];
@@ -329,13 +389,14 @@ inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::
 
     /* Normalize probabilities */
     algorithmFPType invSumP = one / sumP;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
     for (size_t j = 0; j < nClasses; j++)
     {
         p[j] *= invSumP;
     }
 }
 
-
 } // namespace internal
 } // namespace prediction
 } // namespace multi_class_classifier
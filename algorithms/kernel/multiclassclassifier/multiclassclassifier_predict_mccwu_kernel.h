@@ -64,12 +64,12 @@ size_t getMultiClassClassifierPredictBlockSize()
 template<typename algorithmFPType, CpuType cpu>
 struct MultiClassClassifierTls
 {
-    MultiClassClassifierTls(size_t nClasses, size_t nRowsInBlock, const NumericTable *xTable, NumericTable *rTable,
+    MultiClassClassifierTls(size_t nClasses, const NumericTable *xTable, NumericTable *rTable,
                             services::SharedPtr<classifier::prediction::Batch> simplePrediction) :
-        mtR(rTable),
+        mtX(NULL), mtR(rTable),
         simplePrediction(simplePrediction->clone())
     {
-        size_t bufferSize = nRowsInBlock * nClasses * nClasses + nClasses * nClasses + 2 * nClasses + nRowsInBlock;
+        size_t bufferSize = 3 * nClasses * nClasses + 2 * nClasses;
         buffer = (algorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(algorithmFPType));
         if (!buffer) { error.setId(services::ErrorMemoryAllocationFailed); return; }
         if (xTable->getDataLayout() == NumericTableIface::csrArray)
@@ -104,26 +104,26 @@ struct MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAg
                  const daal::algorithms::Parameter *par);
 
 protected:
-    /* Get multiclass classification results for a block of input observations */
-    inline void getBlockOfRowsOfResults(size_t nFeatures, size_t startRow, size_t nRows, size_t nClasses,
-                                        MicroTable *mtX, FeatureMicroTable<int, writeOnly, cpu> &mtR,
-                                        services::SharedPtr<classifier::prediction::Batch> simplePrediction,
-                                        services::SharedPtr<classifier::Model> *simpleModels,
-                                        size_t nIter, double eps, algorithmFPType *buffer,
-                                        services::Error &error);
-
-    /** Get 2-class classification probabilities for a block of observations */
-    inline void get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows, size_t nClasses,
-                                       MicroTable *mtX, algorithmFPType *y,
+    /* Get multiclass classification results for a block of input observations
+       from the 2-class probabilities of the observations */
+    inline void getBlockOfRowsOfResults(size_t startRow, size_t nRows, size_t nClasses,
+                                        const algorithmFPType *pairProb, size_t pairProbStride,
+                                        FeatureMicroTable<int, writeOnly, cpu> &mtR,
+                                        size_t nIter, double eps, algorithmFPType *buffer);
+
+    /** Get 2-class classification probabilities of one "simple" classifier for a block of observations */
+    inline void get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows,
+                                       MicroTable *mtX,
                                        services::SharedPtr<classifier::prediction::Batch> simplePrediction,
-                                       services::SharedPtr<classifier::Model> *simpleModels,
-                                       algorithmFPType *rProb, services::Error &error);
+                                       services::SharedPtr<classifier::Model> simpleModel,
+                                       algorithmFPType *prob, services::Error &error);
 
     /** Compute matrix Q from the 2-class parobabilities */
-    inline void computeQ(size_t nClasses, const algorithmFPType *rProb, algorithmFPType *Q);
+    inline void computeQ(size_t nClasses, const algorithmFPType *rProb, const algorithmFPType *rProbT, algorithmFPType *Q);
 
     /** Calculate objective function of the Algorithm 2 from [1] */
-    inline algorithmFPType computeObjFunc(size_t nClasses, algorithmFPType *p, algorithmFPType *rProb);
+    inline algorithmFPType computeObjFunc(size_t nClasses, const algorithmFPType *p,
+                                          const algorithmFPType *rProb, const algorithmFPType *rProbT);
 
     /** Update multi-class probability estimates */
     inline void updateProbabilities(size_t nClasses, const algorithmFPType *Q,
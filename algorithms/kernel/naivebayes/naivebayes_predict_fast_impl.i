@@ -90,24 +90,15 @@ void NaiveBayesPredictKernel<interm, method, cpu>::compute(const NumericTable *a
     ntAuxTable->getBlockOfRows( 0, c, readOnly, auxTableBlock );
     interm *aux_table = auxTableBlock.getBlockPtr();
 
-    size_t blockSizeDeafult = 128;
+    /* Rows of the data and of the scores of the classes of a block fit into the cache */
+    size_t blockSizeDefault = daal::threader_get_block_size<interm>(n, p + c);
 
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks * blockSizeDeafult != n);
+    daal::tls<interm *> mkl_buff( [ = ]()-> interm* { return service_calloc<interm, cpu>(blockSizeDefault * c); } );
 
-    daal::tls<interm *> mkl_buff( [ = ]()-> interm* { return service_calloc<interm, cpu>(blockSizeDeafult * c); } );
-
-    daal::threader_for( nBlocks, nBlocks, [ =, &mkl_buff ](int k)
+    daal::threader_for_row_blocks( n, blockSizeDefault, daal::autoPartitioner, [ =, &mkl_buff ](size_t j0, size_t jn)
     {
         interm *buff =  mkl_buff.local();
 
-        size_t jn = blockSizeDeafult;
-        if( k == nBlocks - 1 )
-        {
-            jn = n - k * blockSizeDeafult;
-        }
-        size_t j0 = k * blockSizeDeafult;
-
         BlockDescriptor<int>    classesBlock;
         ntClass->getBlockOfRows( j0, jn, writeOnly, classesBlock );
         int *classes = classesBlock.getBlockPtr();
@@ -0,0 +1,75 @@
+/* file: nearest_neighbors_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of nearest neighbors search algorithm container.
+//--
+*/
+
+#ifndef __NEAREST_NEIGHBORS_BATCH_CONTAINER_H__
+#define __NEAREST_NEIGHBORS_BATCH_CONTAINER_H__
+
+#include "nearest_neighbors.h"
+#include "nearest_neighbors_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace nearest_neighbors
+{
+
+/**
+ *  \brief Initialize list of nearest neighbors search kernels with implementations for supported architectures
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::NearestNeighborsKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Result *result = static_cast<Result *>(_res);
+    Input *input = static_cast<Input *>(_in);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *queryTable     = input->get(queryData).get();
+    NumericTable *referenceTable = input->get(referenceData).get();
+    NumericTable *indicesTable   = result->get(indices).get();
+    NumericTable *distancesTable = result->get(distances).get();
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::NearestNeighborsKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       queryTable, referenceTable, indicesTable, distancesTable, par);
+}
+
+} // namespace nearest_neighbors
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,370 @@
+/* file: nearest_neighbors_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the nearest neighbors search
+//--
+*/
+
+#include "service_micro_table.h"
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_defines.h"
+#include "service_distance_tiles.h"
+#include "threading.h"
+#include "daal_atomic_int.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace nearest_neighbors
+{
+namespace internal
+{
+
+const size_t queryBlockSizeDefault     = 128;   /* Number of query vectors processed by one task */
+const size_t referenceBlockSizeDefault = 256;   /* Number of reference vectors in a tile */
+
+/**
+ *  \brief Computes sums and inversed norms of the feature vectors used in the distance computation.
+ *         For the correlation distance the norms of the centered feature vectors are computed.
+ *         The feature vectors are read from the table by blocks. Returns false if a block is not available
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+bool computeRowStatistics(const NumericTable *table, size_t n, size_t p, algorithmFPType *sum, algorithmFPType *normInv)
+{
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType one  = (algorithmFPType)1.0;
+    const algorithmFPType invDim = one / (algorithmFPType)p;
+    const size_t blockSize = referenceBlockSizeDefault;
+    const size_t nBlocks = n / blockSize + (n % blockSize > 0 ? 1 : 0);
+
+    daal::services::Atomic<int> isBlockAvailable(1);
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        size_t i0 = iBlock * blockSize;
+        size_t ni = (i0 + blockSize < n ? blockSize : n - i0);
+
+        BlockDescriptor<algorithmFPType> block;
+        const_cast<NumericTable *>(table)->getBlockOfRows(i0, ni, readOnly, block);
+        const algorithmFPType *x = block.getBlockPtr();
+        if (!x)
+        {
+            const_cast<NumericTable *>(table)->releaseBlockOfRows(block);
+            isBlockAvailable.set(0);
+            return;
+        }
+
+        for (size_t i = 0; i < ni; i++)
+        {
+            const algorithmFPType *xi = x + i * p;
+            algorithmFPType s  = zero;
+            algorithmFPType s2 = zero;
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < p; k++)
+            {
+                s  += xi[k];
+                s2 += xi[k] * xi[k];
+            }
+            if (method == correlationDense)
+            {
+                sum[i0 + i] = s;
+                s2 -= s * s * invDim;
+            }
+            normInv[i0 + i] = (s2 != zero ? one / sSqrt<cpu>(s2) : zero);
+        }
+
+        const_cast<NumericTable *>(table)->releaseBlockOfRows(block);
+    } );
+    return (isBlockAvailable.get() != 0);
+}
+
+/**
+ *  \brief Compares the neighbors by distance, the neighbor with the smaller index goes first on ties
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline bool isCloser(algorithmFPType d1, int i1, algorithmFPType d2, int i2)
+{
+    return (d1 < d2 || (d1 == d2 && i1 < i2));
+}
+
+/**
+ *  \brief Restores the max-heap property of the neighbors starting from the given position
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void siftDown(algorithmFPType *dist, int *idx, size_t size, size_t pos)
+{
+    for (;;)
+    {
+        size_t largest = pos;
+        size_t left  = 2 * pos + 1;
+        size_t right = left + 1;
+        if (left  < size && isCloser<algorithmFPType, cpu>(dist[largest], idx[largest], dist[left],  idx[left]))  { largest = left;  }
+        if (right < size && isCloser<algorithmFPType, cpu>(dist[largest], idx[largest], dist[right], idx[right])) { largest = right; }
+        if (largest == pos) { return; }
+
+        algorithmFPType d = dist[pos]; dist[pos] = dist[largest]; dist[largest] = d;
+        int i = idx[pos]; idx[pos] = idx[largest]; idx[largest] = i;
+        pos = largest;
+    }
+}
+
+/**
+ *  \brief Adds the candidate to the max-heap of at most k nearest neighbors
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void pushNeighbor(algorithmFPType *dist, int *idx, size_t &size, size_t k, algorithmFPType d, int i)
+{
+    if (size < k)
+    {
+        size_t pos = size++;
+        while (pos > 0)
+        {
+            size_t parent = (pos - 1) / 2;
+            if (!isCloser<algorithmFPType, cpu>(dist[parent], idx[parent], d, i)) { break; }
+            dist[pos] = dist[parent];
+            idx[pos]  = idx[parent];
+            pos = parent;
+        }
+        dist[pos] = d;
+        idx[pos]  = i;
+    }
+    else if (isCloser<algorithmFPType, cpu>(d, i, dist[0], idx[0]))
+    {
+        dist[0] = d;
+        idx[0]  = i;
+        siftDown<algorithmFPType, cpu>(dist, idx, size, 0);
+    }
+}
+
+/**
+ *  \brief Sorts the max-heap of the neighbors in ascending order of distances
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void sortNeighbors(algorithmFPType *dist, int *idx, size_t size)
+{
+    for (size_t last = size; last > 1; last--)
+    {
+        algorithmFPType d = dist[0]; dist[0] = dist[last - 1]; dist[last - 1] = d;
+        int i = idx[0]; idx[0] = idx[last - 1]; idx[last - 1] = i;
+        siftDown<algorithmFPType, cpu>(dist, idx, last - 1, 0);
+    }
+}
+
+/**
+ *  \brief Kernel for the nearest neighbors search.
+ *         The query vectors are processed in parallel by blocks. For every block of query vectors
+ *         the reference vectors are streamed by tiles and the distances of the tile are merged into
+ *         the per-query heaps of k nearest neighbors
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void NearestNeighborsKernel<algorithmFPType, method, cpu>::compute(const NumericTable *queryTable, const NumericTable *referenceTable,
+                                                                   NumericTable *indicesTable, NumericTable *distancesTable,
+                                                                   const Parameter *par)
+{
+    const size_t nq = queryTable->getNumberOfRows();
+    const size_t nr = referenceTable->getNumberOfRows();
+    const size_t p  = queryTable->getNumberOfColumns();
+    const size_t k  = par->k;
+
+    const algorithmFPType one = (algorithmFPType)1.0;
+    const algorithmFPType invDim = one / (algorithmFPType)p;
+
+    algorithmFPType *qNormInv = (algorithmFPType *)daal::services::daal_malloc(nq * sizeof(algorithmFPType));
+    algorithmFPType *rNormInv = (algorithmFPType *)daal::services::daal_malloc(nr * sizeof(algorithmFPType));
+    algorithmFPType *qSum = (algorithmFPType *)daal::services::daal_malloc(nq * sizeof(algorithmFPType));
+    algorithmFPType *rSum = (algorithmFPType *)daal::services::daal_malloc(nr * sizeof(algorithmFPType));
+    if (!qNormInv || !rNormInv || !qSum || !rSum)
+    {
+        daal::services::daal_free(qNormInv);
+        daal::services::daal_free(rNormInv);
+        daal::services::daal_free(qSum);
+        daal::services::daal_free(rSum);
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    if (!computeRowStatistics<algorithmFPType, method, cpu>(queryTable, nq, p, qSum, qNormInv) ||
+        !computeRowStatistics<algorithmFPType, method, cpu>(referenceTable, nr, p, rSum, rNormInv))
+    {
+        daal::services::daal_free(qNormInv);
+        daal::services::daal_free(rNormInv);
+        daal::services::daal_free(qSum);
+        daal::services::daal_free(rSum);
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    const size_t qBlockSize = queryBlockSizeDefault;
+    const size_t rBlockSize = referenceBlockSizeDefault;
+    const size_t nQueryBlocks = nq / qBlockSize + (nq % qBlockSize > 0 ? 1 : 0);
+
+    struct task_buffers
+    {
+        algorithmFPType *tile;
+        algorithmFPType *heapDistances;
+        int *heapIndices;
+        size_t *heapSizes;
+    };
+
+    daal::tls<task_buffers *> tls( [=]()-> task_buffers *
+    {
+        task_buffers *t = new task_buffers();
+        t->tile          = (algorithmFPType *)daal::services::daal_malloc(qBlockSize * rBlockSize * sizeof(algorithmFPType));
+        t->heapDistances = (algorithmFPType *)daal::services::daal_malloc(qBlockSize * k * sizeof(algorithmFPType));
+        t->heapIndices   = (int *)daal::services::daal_malloc(qBlockSize * k * sizeof(int));
+        t->heapSizes     = (size_t *)daal::services::daal_malloc(qBlockSize * sizeof(size_t));
+        return t;
+    } );
+
+    /* The flag is cleared by the tasks in parallel, so it is atomic */
+    daal::services::Atomic<int> isMemoryAllocated(1);
+
+    /* The query block is read once by the task, the reference vectors are read by tiles */
+    daal::threader_for(nQueryBlocks, nQueryBlocks, [&](int iBlock)
+    {
+        task_buffers *t = tls.local();
+        if (!t->tile || !t->heapDistances || !t->heapIndices || !t->heapSizes) { isMemoryAllocated.set(0); return; }
+
+        size_t q0  = iBlock * qBlockSize;
+        size_t nqb = (q0 + qBlockSize < nq ? qBlockSize : nq - q0);
+
+        BlockDescriptor<algorithmFPType> queryBlock;
+        const_cast<NumericTable *>(queryTable)->getBlockOfRows(q0, nqb, readOnly, queryBlock);
+        const algorithmFPType *q = queryBlock.getBlockPtr();
+        if (!q)
+        {
+            const_cast<NumericTable *>(queryTable)->releaseBlockOfRows(queryBlock);
+            isMemoryAllocated.set(0);
+            return;
+        }
+
+        for (size_t i = 0; i < nqb; i++)
+        {
+            t->heapSizes[i] = 0;
+        }
+
+        bool isTileAvailable = true;
+        for (size_t r0 = 0; r0 < nr; r0 += rBlockSize)
+        {
+            size_t nrb = (r0 + rBlockSize < nr ? rBlockSize : nr - r0);
+
+            BlockDescriptor<algorithmFPType> referenceBlock;
+            const_cast<NumericTable *>(referenceTable)->getBlockOfRows(r0, nrb, readOnly, referenceBlock);
+            const algorithmFPType *r = referenceBlock.getBlockPtr();
+            if (!r)
+            {
+                const_cast<NumericTable *>(referenceTable)->releaseBlockOfRows(referenceBlock);
+                isTileAvailable = false;
+                break;
+            }
+
+            daal::algorithms::internal::computeDotProductsTile<algorithmFPType, cpu>(q, nqb, r, nrb, p, t->tile);
+            const_cast<NumericTable *>(referenceTable)->releaseBlockOfRows(referenceBlock);
+
+            for (size_t i = 0; i < nqb; i++)
+            {
+                algorithmFPType *tileRow = t->tile + i * nrb;
+                const algorithmFPType qInv = qNormInv[q0 + i];
+                if (method == correlationDense)
+                {
+                    const algorithmFPType qs = qSum[q0 + i] * invDim;
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nrb; j++)
+                    {
+                        tileRow[j] = one - (tileRow[j] - qs * rSum[r0 + j]) * qInv * rNormInv[r0 + j];
+                    }
+                }
+                else
+                {
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nrb; j++)
+                    {
+                        tileRow[j] = one - tileRow[j] * qInv * rNormInv[r0 + j];
+                    }
+                }
+
+                algorithmFPType *heapDistances = t->heapDistances + i * k;
+                int *heapIndices = t->heapIndices + i * k;
+                for (size_t j = 0; j < nrb; j++)
+                {
+                    pushNeighbor<algorithmFPType, cpu>(heapDistances, heapIndices, t->heapSizes[i], k, tileRow[j], (int)(r0 + j));
+                }
+            }
+        }
+
+        const_cast<NumericTable *>(queryTable)->releaseBlockOfRows(queryBlock);
+        if (!isTileAvailable) { isMemoryAllocated.set(0); return; }
+
+        BlockDescriptor<int> indicesBlock;
+        BlockDescriptor<algorithmFPType> distancesBlock;
+        indicesTable->getBlockOfRows(q0, nqb, writeOnly, indicesBlock);
+        distancesTable->getBlockOfRows(q0, nqb, writeOnly, distancesBlock);
+        int *indicesArray = indicesBlock.getBlockPtr();
+        algorithmFPType *distancesArray = distancesBlock.getBlockPtr();
+        if (!indicesArray || !distancesArray)
+        {
+            indicesTable->releaseBlockOfRows(indicesBlock);
+            distancesTable->releaseBlockOfRows(distancesBlock);
+            isMemoryAllocated.set(0);
+            return;
+        }
+
+        for (size_t i = 0; i < nqb; i++)
+        {
+            algorithmFPType *heapDistances = t->heapDistances + i * k;
+            int *heapIndices = t->heapIndices + i * k;
+            sortNeighbors<algorithmFPType, cpu>(heapDistances, heapIndices, t->heapSizes[i]);
+            for (size_t j = 0; j < k; j++)
+            {
+                indicesArray[i * k + j]   = heapIndices[j];
+                distancesArray[i * k + j] = heapDistances[j];
+            }
+        }
+
+        indicesTable->releaseBlockOfRows(indicesBlock);
+        distancesTable->releaseBlockOfRows(distancesBlock);
+    } );
+
+    tls.reduce( [=](task_buffers *t)-> void
+    {
+        daal::services::daal_free(t->tile);
+        daal::services::daal_free(t->heapDistances);
+        daal::services::daal_free(t->heapIndices);
+        daal::services::daal_free(t->heapSizes);
+        delete t;
+    } );
+
+    daal::services::daal_free(qNormInv);
+    daal::services::daal_free(rNormInv);
+    daal::services::daal_free(qSum);
+    daal::services::daal_free(rSum);
+
+    if (!isMemoryAllocated.get()) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+} // namespace internal
+
+} // namespace nearest_neighbors
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,58 @@
+/* file: nearest_neighbors_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that searches the nearest neighbors.
+//--
+*/
+
+#ifndef __NEAREST_NEIGHBORS_KERNEL_H__
+#define __NEAREST_NEIGHBORS_KERNEL_H__
+
+#include "nearest_neighbors.h"
+#include "kernel.h"
+#include "numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace nearest_neighbors
+{
+namespace internal
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+class NearestNeighborsKernel : public Kernel
+{
+public:
+    void compute(const NumericTable *queryTable, const NumericTable *referenceTable, NumericTable *indicesTable,
+                 NumericTable *distancesTable, const Parameter *par);
+};
+
+} // namespace internal
+
+} // namespace nearest_neighbors
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
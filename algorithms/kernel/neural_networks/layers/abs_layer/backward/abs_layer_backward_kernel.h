@@ -58,8 +58,6 @@ public:
                  abs::backward::Result *result);
 
 private:
-    const size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<Tensor> inputTable,
                              SharedPtr<Tensor> forwardOutputTable,
                              size_t nProcessedRows, size_t nRowsInCurrentBlock,
@@ -57,8 +57,6 @@ public:
     void compute(const logistic::backward::Input *input, logistic::backward::Result *result);
 
 private:
-    size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<Tensor> inputTable,
                              SharedPtr<Tensor> forwardOutputTable,
                              size_t nProcessedRows, size_t nRowsInCurrentBlock,
@@ -56,8 +56,6 @@ public:
     void compute(const logistic::forward::Input *input, logistic::forward::Result *result);
 
 private:
-    size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<Tensor> inputTable,
                              size_t nProcessedRows, size_t nRowsInCurrentBlock,
                              SharedPtr<Tensor> resultTable);
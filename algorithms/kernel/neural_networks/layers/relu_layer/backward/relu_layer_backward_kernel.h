@@ -55,8 +55,6 @@ public:
     void compute(const relu::backward::Input *input, relu::backward::Result *result);
 
 private:
-    const size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<Tensor> inputTable,
                              SharedPtr<Tensor> forwardOutputTable,
                              size_t nProcessedRows, size_t nRowsInCurrentBlock,
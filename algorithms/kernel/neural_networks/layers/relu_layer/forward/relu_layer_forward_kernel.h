@@ -54,8 +54,6 @@ public:
     void compute(const relu::forward::Input *input, relu::forward::Result *result);
 
 private:
-    const size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<Tensor> inputTable,
                              size_t nProcessedRows, size_t nRowsInCurrentBlock,
                              SharedPtr<Tensor> resultTable);
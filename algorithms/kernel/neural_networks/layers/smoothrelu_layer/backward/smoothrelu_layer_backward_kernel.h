@@ -57,8 +57,6 @@ public:
     void compute(const smoothrelu::backward::Input *input, smoothrelu::backward::Result *result);
 
 private:
-    const size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<Tensor> inputTable,
                              SharedPtr<Tensor> backwardOutputTable,
                              size_t nProcessedRows, size_t nRowsInCurrentBlock,
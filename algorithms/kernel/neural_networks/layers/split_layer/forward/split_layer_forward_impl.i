@@ -59,18 +59,13 @@ void SplitKernel<algorithmFPType, method, cpu>::compute(const split::forward::In
 
         size_t nInputRows = dims[0];
 
-        size_t nBlocks = nInputRows / _nRowsInBlock;
-        nBlocks += (nBlocks * _nRowsInBlock != nInputRows);
+        const size_t nValuesInRow = (nInputRows ? inputTable->getSize() / nInputRows : 0);
+        const size_t nRowsInBlock = daal::threader_get_block_size<algorithmFPType>(nInputRows, nValuesInRow);
 
-        daal::threader_for(nBlocks, nBlocks, [ = ](int block)
+        daal::threader_for_row_blocks(nInputRows, nRowsInBlock, daal::autoPartitioner,
+                                      [ = ](size_t iStartRow, size_t nRowsToProcess)
         {
-            size_t nRowsToProcess = _nRowsInBlock;
-            if( block == nBlocks - 1 )
-            {
-                nRowsToProcess = nInputRows - block * _nRowsInBlock;
-            }
-
-            processBlock(inputTable, block * _nRowsInBlock, nRowsToProcess, resultTable);
+            processBlock(inputTable, iStartRow, nRowsToProcess, resultTable);
         } );
     }
 }
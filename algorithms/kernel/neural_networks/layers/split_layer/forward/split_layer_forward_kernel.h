@@ -55,8 +55,6 @@ public:
                  split::forward::Result *result);
 
 private:
-    const size_t _nRowsInBlock = 5000;
-
     inline void processBlock(SharedPtr<Tensor> inputTable,
                              size_t nProcessedRows, size_t nRowsInCurrentBlock,
                              SharedPtr<Tensor> resultTable);
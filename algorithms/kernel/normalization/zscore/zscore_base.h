@@ -25,6 +25,7 @@
 #include "normalization/zscore.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "csr_numeric_table.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -66,8 +67,42 @@ public:
 protected:
     const size_t _nRowsInBlock = 5000;
 
+    /**
+     *  \brief Computes means and sums of squared differences from the means of the input data
+     *         in one parallel pass over the blocks of data.
+     *         The columns of structure-of-arrays tables are processed without conversion to row-major layout,
+     *         CSR tables are processed without conversion to the dense layout
+     *
+     *  \param  inputTable[in]          Numeric table containing input data
+     *  \param  nInputRows[in]          Number of rows in input table
+     *  \param  nInputColumns[in]       Number of columns in input table
+     *  \param  isMeanKnown[in]         Flag that indicates whether the means are provided in meanArray
+     *  \param  meanArray[in,out]       Array of mean values
+     *  \param  sumSquaresArray[out]    Array of sums of squared differences from the means
+     */
+    void computeMeansAndSumSquares(SharedPtr<NumericTable> inputTable, size_t nInputRows, size_t nInputColumns, bool isMeanKnown,
+                                   algorithmFPType *meanArray, algorithmFPType *sumSquaresArray);
+
 private:
 
+    /**
+     *  \brief Computes the means and the sums of squared differences from the means of the columns
+     *         for the block of rows of the CSR table using only the non-zero values
+     *
+     *  \param  inputTable[in]          Numeric table containing input data in the CSR layout
+     *  \param  nProcessedRows[in]      Number of processed rows
+     *  \param  nRowsInCurrentBlock[in] Number of rows to process
+     *  \param  nInputColumns[in]       Number of columns in input table
+     *  \param  isMeanKnown[in]         Flag that indicates whether the means are provided in meanArray
+     *  \param  meanArray[in]           Array of mean values, used if isMeanKnown is true
+     *  \param  blockMean[out]          Means of the columns in the block
+     *  \param  blockSumSquares[out]    Sums of squared differences from blockMean in the block
+     *  \param  nBlockNonZeros[out]     Numbers of non-zero values of the columns in the block
+     */
+    void computeSparseBlockMoments(SharedPtr<NumericTable> inputTable, size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                   size_t nInputColumns, bool isMeanKnown, const algorithmFPType *meanArray,
+                                   algorithmFPType *blockMean, algorithmFPType *blockSumSquares, algorithmFPType *nBlockNonZeros);
+
     /**
      *  \brief Checks for inplace normalization
      *
@@ -92,6 +127,37 @@ private:
     inline void copyDataBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
                               SharedPtr<NumericTable> resultTable);
 
+    /**
+     *  \brief Normalizes data from input table by blocks of rows or, for structure-of-arrays tables, by blocks of columns.
+     *         The blocks are processed in parallel
+     *
+     *  \param  inputTable[in]               Numeric table containing input data
+     *  \param  nInputRows[in]               Number of rows in input table
+     *  \param  nInputColumns[in]            Number of columns in input table
+     *  \param  nBlocks[in]                  Number of full blocks of data
+     *  \param  nRowsInLastBlock[in]         Number of rows in the last block of data
+     *  \param  resultTable[out]             Numeric table containing normalization results
+     *  \param  meanArray[in]                Array of mean values
+     *  \param  standardDeviationInverse[in] Array of inversed values of standard deviations
+     */
+    inline void normalizeData(SharedPtr<NumericTable> inputTable, size_t nInputRows, size_t nInputColumns, size_t nBlocks,
+                              size_t nRowsInLastBlock, SharedPtr<NumericTable> resultTable, algorithmFPType *meanArray,
+                              algorithmFPType *standardDeviationInverse);
+
+    /**
+     *  \brief Normalizes a block of values of one column of structure-of-arrays table
+     *
+     *  \param  inputTable[in]               Numeric table containing input data
+     *  \param  column[in]                   Index of the column
+     *  \param  nProcessedRows[in]           Number of processed rows
+     *  \param  nRowsInCurrentBlock[in]      Number of rows to process
+     *  \param  resultTable[out]             Numeric table containing normalization results
+     *  \param  mean[in]                     Mean value of the column
+     *  \param  standardDeviationInverse[in] Inversed value of standard deviation of the column
+     */
+    inline void normalizeColumnInBlock(SharedPtr<NumericTable> inputTable, size_t column, size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                       SharedPtr<NumericTable> resultTable, algorithmFPType mean, algorithmFPType standardDeviationInverse);
+
     /**
      *  \brief Normalizes data from input table by blocks
      *
@@ -105,6 +171,22 @@ private:
      */
     inline void normalizeDataInBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
                                      SharedPtr<NumericTable> resultTable, algorithmFPType *meanArray, algorithmFPType *standardDeviationInverse);
+
+    /**
+     *  \brief Normalizes the block of rows of the CSR table into the dense result table.
+     *         The zero values are normalized by filling the rows, then the non-zero values are added
+     *
+     *  \param  inputTable[in]               Numeric table containing input data in the CSR layout
+     *  \param  nInputColumns[in]            Number of columns in input table
+     *  \param  nProcessedRows[in]           Number of processed rows
+     *  \param  nRowsInCurrentBlock[in]      Number of rows to process
+     *  \param  resultTable[out]             Numeric table containing normalization results
+     *  \param  meanArray[in]                Array of mean values
+     *  \param  standardDeviationInverse[in] Array of inversed values of standard deviations
+     */
+    inline void normalizeSparseDataInBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows,
+                                           size_t nRowsInCurrentBlock, SharedPtr<NumericTable> resultTable,
+                                           algorithmFPType *meanArray, algorithmFPType *standardDeviationInverse);
 };
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -25,6 +25,7 @@
 #include "zscore_base.h"
 #include "zscore_dense_default_kernel.h"
 #include "zscore_dense_sum_kernel.h"
+#include "zscore_dense_fused_kernel.h"
 
 namespace daal
 {
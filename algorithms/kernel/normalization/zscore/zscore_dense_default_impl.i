@@ -54,7 +54,7 @@ void ZScoreKernel<algorithmFPType, defaultDense, cpu>::
 
     parameter->moments->input.set(low_order_moments::data, inputTable);
     parameter->moments->compute();
-    if(parameter->moments->getErrors()->size() != 0) {this->_errors->add(ErrorMeanAndStandardDeviationComputing);}
+    if(parameter->moments->getErrors()->size() != 0) { this->_errors->add(ErrorMeanAndStandardDeviationComputing); return; }
 
     meanTable = parameter->moments->getResult()->get(low_order_moments::mean);
     standardDeviationTable = parameter->moments->getResult()->get(low_order_moments::standardDeviation);
@@ -74,7 +74,6 @@ void ZScoreKernel<algorithmFPType, defaultDense, cpu>::
     {
         if(varianceArray[i] <= zero)
         {
-            daal_free(standardDeviationInverse);
             standardDeviationTable->releaseBlockOfRows(standardDeviationBlock);
             varianceTable->releaseBlockOfRows(varianceBlock);
             meanTable->releaseBlockOfRows(meanBlock);
@@ -0,0 +1,105 @@
+/* file: zscore_dense_fused_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of fusedDense method for zscore normalization algorithm
+//--
+*/
+
+#ifndef __ZSCORE_DENSE_FUSED_IMPL_I__
+#define __ZSCORE_DENSE_FUSED_IMPL_I__
+
+#include "service_micro_table.h"
+#include "service_math.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+void ZScoreKernel<algorithmFPType, fusedDense, cpu>::
+    computeInternal(SharedPtr<NumericTable> inputTable, size_t nInputRows, size_t nInputColumns, size_t nBlocks, size_t nRowsInLastBlock,
+            daal::algorithms::Parameter *par, algorithmFPType **meanArray, algorithmFPType *standardDeviationInverse)
+{
+    *meanArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
+    if (!*meanArray)
+    {
+        this->_errors->add(ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    algorithmFPType *sumSquaresArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
+    if (!sumSquaresArray)
+    {
+        daal_free(*meanArray);
+        this->_errors->add(ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    this->computeMeansAndSumSquares(inputTable, nInputRows, nInputColumns, false, *meanArray, sumSquaresArray);
+    if(this->_errors->size() != 0)
+    {
+        daal_free(*meanArray);
+        daal_free(sumSquaresArray);
+        return;
+    }
+
+    algorithmFPType value = sSqrt<cpu>((algorithmFPType)nInputRows - one);
+    vSqrt<cpu>(nInputColumns, sumSquaresArray, sumSquaresArray);
+
+    for(size_t i = 0; i < nInputColumns; i++)
+    {
+        if(sumSquaresArray[i] <= zero)
+        {
+            daal_free(*meanArray);
+            daal_free(sumSquaresArray);
+
+            SharedPtr<Error> e(new Error(ErrorNullVariance));
+            e->addIntDetail(Column, (int)i);
+            this->_errors->add(e);
+            return;
+        }
+        standardDeviationInverse[i] = value / sumSquaresArray[i];
+    }
+
+    daal_free(sumSquaresArray);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void ZScoreKernel<algorithmFPType, fusedDense, cpu>::releaseData(algorithmFPType *meanArray)
+{
+    daal_free(meanArray);
+}
+
+} // namespace daal::internal
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -51,19 +51,13 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     SharedPtr<NumericTable> sumTable = inputTable->basicStatistics.get(NumericTableIface::sum);
     if(sumTable.get() == 0)
     {
-        daal_free(standardDeviationInverse);
         this->_errors->add(services::ErrorPrecomputedSumNotAvailable);
         return;
     }
 
-    BlockDescriptor<algorithmFPType> sumBlock;
-    sumTable->getBlockOfRows(0, 1, readOnly, sumBlock);
-    algorithmFPType *sumArray = sumBlock.getBlockPtr();
-
     *meanArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
-    if (!meanArray)
+    if (!*meanArray)
     {
-        daal_free(standardDeviationInverse);
         this->_errors->add(ErrorMemoryAllocationFailed);
         return;
     }
@@ -71,28 +65,30 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     standardDeviationArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
     if (!standardDeviationArray)
     {
-        daal_free(standardDeviationInverse);
         daal_free(*meanArray);
-        sumTable->releaseBlockOfRows(sumBlock);
         this->_errors->add(ErrorMemoryAllocationFailed);
         return;
     }
 
+    BlockDescriptor<algorithmFPType> sumBlock;
+    sumTable->getBlockOfRows(0, 1, readOnly, sumBlock);
+    algorithmFPType *sumArray = sumBlock.getBlockPtr();
+
     algorithmFPType rowsInverseValue = one / (algorithmFPType)nInputRows;
-    algorithmFPType inverseValue = one / ((algorithmFPType)nInputRows - one);
 
     for(size_t i = 0; i < nInputColumns; i++)
     {
         (*meanArray)[i] = sumArray[i] * rowsInverseValue;
     }
 
-    for(size_t block = 0; block < nBlocks; block++)
-    {
-        getSumSquaresCentered(inputTable, nInputColumns, block * this->_nRowsInBlock, this->_nRowsInBlock, standardDeviationArray, *meanArray);
-    }
-    if(nRowsInLastBlock > 0)
+    sumTable->releaseBlockOfRows(sumBlock);
+
+    this->computeMeansAndSumSquares(inputTable, nInputRows, nInputColumns, true, *meanArray, standardDeviationArray);
+    if(this->_errors->size() != 0)
     {
-        getSumSquaresCentered(inputTable, nInputColumns, nBlocks * this->_nRowsInBlock, nRowsInLastBlock, standardDeviationArray, *meanArray);
+        daal_free(*meanArray);
+        daal_free(standardDeviationArray);
+        return;
     }
 
     algorithmFPType value = sSqrt<cpu>((algorithmFPType)nInputRows - one);
@@ -102,10 +98,8 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     {
         if(standardDeviationArray[i] <= zero)
         {
-            daal_free(standardDeviationInverse);
             daal_free(*meanArray);
             daal_free(standardDeviationArray);
-            sumTable->releaseBlockOfRows(sumBlock);
 
             SharedPtr<Error> e(new Error(ErrorNullVariance));
             e->addIntDetail(Column, (int)i);
@@ -115,31 +109,9 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
         standardDeviationInverse[i] = value / standardDeviationArray[i];
     }
 
-    sumTable->releaseBlockOfRows(sumBlock);
     daal_free(standardDeviationArray);
 }
 
-template<typename algorithmFPType, CpuType cpu>
-void ZScoreKernel<algorithmFPType, sumDense, cpu>::
-    getSumSquaresCentered(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                          algorithmFPType *standardDeviationArray, algorithmFPType *meanArray)
-{
-    BlockDescriptor<algorithmFPType> inputBlock;
-    inputTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, readOnly, inputBlock);
-    algorithmFPType *inputArray = inputBlock.getBlockPtr();
-
-    for(size_t i = 0; i < nInputColumns; i++)
-    {
-        standardDeviationArray[i] = zero;
-        for(size_t j = 0; j < nRowsInCurrentBlock; j++)
-        {
-            standardDeviationArray[i] += (inputArray[i * nInputColumns + j] - meanArray[i]) * (inputArray[i * nInputColumns + j] -
-                                                                                               meanArray[i]);
-        }
-    }
-    inputTable->releaseBlockOfRows(inputBlock);
-}
-
 template<typename algorithmFPType, CpuType cpu>
 void ZScoreKernel<algorithmFPType, sumDense, cpu>::releaseData(algorithmFPType *meanArray)
 {
@@ -68,19 +68,6 @@ public:
     void computeInternal(SharedPtr<NumericTable> inputTable, size_t nInputRows, size_t nInputColumns, size_t nBlocks, size_t nRowsInLastBlock,
                  daal::algorithms::Parameter *par, algorithmFPType **meanArray, algorithmFPType *standardDeviationInverse);
 
-    /**
-     *  \brief Gets sum of squared differences from the means
-     *
-     *  \param  inputTable[in]             Numeric table containing input data
-     *  \param  nInputColumns[in]          Number of columns in input table
-     *  \param  nProcessedRows[in]         Number of already processed rows
-     *  \param  nRowsInCurrentBlock[in]    Number of rows to process
-     *  \param  standardDeviationArray[in] Array containing standard deviations of input data
-     *  \param  meanArray[in]              Array containing means of input data
-     */
-    void getSumSquaresCentered(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                               algorithmFPType *standardDeviationArray, algorithmFPType *meanArray);
-
     /**
     *  \brief Frees allocated arrays
     *  \param  meanArray[in]   Array containing means of input data
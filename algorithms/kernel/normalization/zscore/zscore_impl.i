@@ -23,9 +23,13 @@
 #define __ZSCORE_IMPL_I__
 
 #include "zscore_base.h"
+#include "service_memory.h"
+#include "service_defines.h"
+#include "threading.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
+using namespace daal::services::internal;
 
 namespace daal
 {
@@ -38,6 +42,30 @@ namespace zscore
 namespace internal
 {
 
+/**
+ *  \brief Merges the moments of the block of observations into the accumulated moments of the column
+ *
+ *  \param  nObservations[in,out]   Number of accumulated observations
+ *  \param  mean[in,out]            Accumulated mean
+ *  \param  sumSquares[in,out]      Accumulated sum of squared differences from the mean
+ *  \param  nBlockObservations[in]  Number of observations in the block
+ *  \param  blockMean[in]           Mean of the block
+ *  \param  blockSumSquares[in]     Sum of squared differences from the mean of the block
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void mergeMoments(algorithmFPType &nObservations, algorithmFPType &mean, algorithmFPType &sumSquares,
+                         algorithmFPType nBlockObservations, algorithmFPType blockMean, algorithmFPType blockSumSquares)
+{
+    if(nBlockObservations == (algorithmFPType)0) { return; }
+
+    algorithmFPType n     = nObservations + nBlockObservations;
+    algorithmFPType delta = blockMean - mean;
+
+    mean       += delta * nBlockObservations / n;
+    sumSquares += blockSumSquares + delta * delta * nObservations * nBlockObservations / n;
+    nObservations = n;
+}
+
 template<typename algorithmFPType, CpuType cpu>
 void ZScoreKernelBase<algorithmFPType, cpu>::compute(const Input *input, Result *result, daal::algorithms::Parameter *parameter)
 {
@@ -63,24 +91,269 @@ void ZScoreKernelBase<algorithmFPType, cpu>::compute(const Input *input, Result
     if (!standardDeviationInverse) { this->_errors->add(ErrorMemoryAllocationFailed); return; }
 
     computeInternal(inputTable, nInputRows, nInputColumns, nBlocks, nRowsInLastBlock, parameter, &meanArray, standardDeviationInverse);
-
-    for(size_t block = 0; block < nBlocks; block++)
-    {
-        normalizeDataInBlock(inputTable, nInputColumns, block * _nRowsInBlock, _nRowsInBlock, resultTable, meanArray,
-                             standardDeviationInverse);
-    }
-    if(nRowsInLastBlock > 0)
+    if(this->_errors->size() != 0)
     {
-        normalizeDataInBlock(inputTable, nInputColumns, nBlocks * _nRowsInBlock, nRowsInLastBlock, resultTable, meanArray,
-                             standardDeviationInverse);
+        daal_free(standardDeviationInverse);
+        return;
     }
 
+    normalizeData(inputTable, nInputRows, nInputColumns, nBlocks, nRowsInLastBlock, resultTable, meanArray, standardDeviationInverse);
+
     resultTable->setNormalizationFlag(NumericTableIface::standardScoreNormalized);
 
     daal_free(standardDeviationInverse);
     releaseData(meanArray);
 };
 
+template<typename algorithmFPType, CpuType cpu>
+void ZScoreKernelBase<algorithmFPType, cpu>::computeMeansAndSumSquares(SharedPtr<NumericTable> inputTable, size_t nInputRows,
+                                                                       size_t nInputColumns, bool isMeanKnown, algorithmFPType *meanArray,
+                                                                       algorithmFPType *sumSquaresArray)
+{
+    const algorithmFPType zero = 0.0;
+    const algorithmFPType one  = 1.0;
+
+    const bool isSOA = (inputTable->getDataLayout() == NumericTableIface::soa);
+    const bool isCSR = (inputTable->getDataLayout() == NumericTableIface::csrArray);
+    const size_t nRowsInBlock = _nRowsInBlock;
+    const size_t nRowBlocks = nInputRows / nRowsInBlock + (nInputRows % nRowsInBlock > 0 ? 1 : 0);
+    const size_t nTasks = (isSOA ? nRowBlocks * nInputColumns : nRowBlocks);
+
+    /* Each partial result accumulates the number of observations, the means and the sums of squares of all columns
+       and keeps the buffers for the moments of the current block of rows.
+       For CSR tables the buffers are followed by the numbers of non-zero values of the columns in the block */
+    const size_t nMoments = (isCSR ? 6 : 5);
+    daal::partial_tls<algorithmFPType *> partialMoments( [=]()-> algorithmFPType *
+    {
+        return service_calloc<algorithmFPType, cpu>(nMoments * nInputColumns);
+    } );
+
+    bool isMemoryAllocated = true;
+
+    partialMoments.for_blocks( nTasks, [&](int iTask, algorithmFPType *moments)
+    {
+        if(!moments) { isMemoryAllocated = false; return; }
+
+        algorithmFPType *nObservations   = moments;
+        algorithmFPType *mean            = moments + nInputColumns;
+        algorithmFPType *sumSquares      = moments + 2 * nInputColumns;
+        algorithmFPType *blockMean       = moments + 3 * nInputColumns;
+        algorithmFPType *blockSumSquares = moments + 4 * nInputColumns;
+
+        size_t iBlock = (isSOA ? iTask % nRowBlocks : iTask);
+        size_t nProcessedRows = iBlock * nRowsInBlock;
+        size_t nRowsInCurrentBlock = (nInputRows - nProcessedRows < nRowsInBlock ? nInputRows - nProcessedRows : nRowsInBlock);
+        algorithmFPType invN = one / (algorithmFPType)nRowsInCurrentBlock;
+
+        if(isSOA)
+        {
+            size_t column = iTask / nRowBlocks;
+
+            BlockDescriptor<algorithmFPType> columnBlock;
+            inputTable->getBlockOfColumnValues(column, nProcessedRows, nRowsInCurrentBlock, readOnly, columnBlock);
+            algorithmFPType *columnArray = columnBlock.getBlockPtr();
+
+            algorithmFPType columnMean = (isMeanKnown ? meanArray[column] : zero);
+            if(!isMeanKnown)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+                {
+                    columnMean += columnArray[i];
+                }
+                columnMean *= invN;
+            }
+
+            algorithmFPType columnSumSquares = zero;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+            {
+                algorithmFPType diff = columnArray[i] - columnMean;
+                columnSumSquares += diff * diff;
+            }
+
+            inputTable->releaseBlockOfColumnValues(columnBlock);
+
+            if(isMeanKnown)
+            {
+                sumSquares[column] += columnSumSquares;
+            }
+            else
+            {
+                mergeMoments<algorithmFPType, cpu>(nObservations[column], mean[column], sumSquares[column],
+                                                   (algorithmFPType)nRowsInCurrentBlock, columnMean, columnSumSquares);
+            }
+            return;
+        }
+
+        if(isCSR)
+        {
+            computeSparseBlockMoments(inputTable, nProcessedRows, nRowsInCurrentBlock, nInputColumns, isMeanKnown, meanArray,
+                                      blockMean, blockSumSquares, moments + 5 * nInputColumns);
+        }
+        else
+        {
+            BlockDescriptor<algorithmFPType> inputBlock;
+            inputTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, readOnly, inputBlock);
+            algorithmFPType *inputArray = inputBlock.getBlockPtr();
+
+            if(isMeanKnown)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nInputColumns; j++)
+                {
+                    blockMean[j] = meanArray[j];
+                }
+            }
+            else
+            {
+                service_memset<algorithmFPType, cpu>(blockMean, zero, nInputColumns);
+                for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+                {
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for(size_t j = 0; j < nInputColumns; j++)
+                    {
+                        blockMean[j] += inputArray[i * nInputColumns + j];
+                    }
+                }
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nInputColumns; j++)
+                {
+                    blockMean[j] *= invN;
+                }
+            }
+
+            service_memset<algorithmFPType, cpu>(blockSumSquares, zero, nInputColumns);
+            for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nInputColumns; j++)
+                {
+                    algorithmFPType diff = inputArray[i * nInputColumns + j] - blockMean[j];
+                    blockSumSquares[j] += diff * diff;
+                }
+            }
+
+            inputTable->releaseBlockOfRows(inputBlock);
+        }
+
+        if(isMeanKnown)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nInputColumns; j++)
+            {
+                sumSquares[j] += blockSumSquares[j];
+            }
+        }
+        else
+        {
+            for(size_t j = 0; j < nInputColumns; j++)
+            {
+                mergeMoments<algorithmFPType, cpu>(nObservations[j], mean[j], sumSquares[j],
+                                                   (algorithmFPType)nRowsInCurrentBlock, blockMean[j], blockSumSquares[j]);
+            }
+        }
+    } );
+
+    /* Merge the moments accumulated by the partial results */
+    algorithmFPType *moments = partialMoments.merge( [&](algorithmFPType *dst, algorithmFPType *src)-> void
+    {
+        for(size_t j = 0; j < nInputColumns; j++)
+        {
+            if(isMeanKnown)
+            {
+                dst[2 * nInputColumns + j] += src[2 * nInputColumns + j];
+            }
+            else
+            {
+                mergeMoments<algorithmFPType, cpu>(dst[j], dst[nInputColumns + j], dst[2 * nInputColumns + j],
+                                                   src[j], src[nInputColumns + j], src[2 * nInputColumns + j]);
+            }
+        }
+    } );
+
+    if(!isMeanKnown)
+    {
+        service_memset<algorithmFPType, cpu>(meanArray, zero, nInputColumns);
+    }
+    service_memset<algorithmFPType, cpu>(sumSquaresArray, zero, nInputColumns);
+
+    if(moments)
+    {
+        for(size_t j = 0; j < nInputColumns; j++)
+        {
+            if(!isMeanKnown)
+            {
+                meanArray[j] = moments[nInputColumns + j];
+            }
+            sumSquaresArray[j] = moments[2 * nInputColumns + j];
+        }
+    }
+
+    partialMoments.reduce( [&](algorithmFPType *moments)-> void
+    {
+        daal_free(moments);
+    } );
+
+    if(!isMemoryAllocated)
+    {
+        this->_errors->add(ErrorMemoryAllocationFailed);
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeData(SharedPtr<NumericTable> inputTable, size_t nInputRows, size_t nInputColumns,
+                                                                  size_t nBlocks, size_t nRowsInLastBlock, SharedPtr<NumericTable> resultTable,
+                                                                  algorithmFPType *meanArray, algorithmFPType *standardDeviationInverse)
+{
+    const size_t nRowsInBlock = _nRowsInBlock;
+    const size_t nRowBlocks = nBlocks + (nRowsInLastBlock > 0 ? 1 : 0);
+
+    const bool isSOA = (inputTable->getDataLayout() == NumericTableIface::soa &&
+                        resultTable->getDataLayout() == NumericTableIface::soa);
+
+    const bool isCSR = (inputTable->getDataLayout() == NumericTableIface::csrArray && inputTable.get() != resultTable.get());
+
+    if(isSOA)
+    {
+        const size_t nTasks = nRowBlocks * nInputColumns;
+        daal::threader_for( nTasks, nTasks, [&](int iTask)
+        {
+            size_t column = iTask / nRowBlocks;
+            size_t iBlock = iTask % nRowBlocks;
+            size_t nRowsInCurrentBlock = (iBlock < nBlocks ? nRowsInBlock : nRowsInLastBlock);
+
+            normalizeColumnInBlock(inputTable, column, iBlock * nRowsInBlock, nRowsInCurrentBlock, resultTable,
+                                   meanArray[column], standardDeviationInverse[column]);
+        } );
+    }
+    else
+    {
+        daal::threader_for( nRowBlocks, nRowBlocks, [&](int iBlock)
+        {
+            size_t nRowsInCurrentBlock = ((size_t)iBlock < nBlocks ? nRowsInBlock : nRowsInLastBlock);
+
+            if(isCSR)
+            {
+                normalizeSparseDataInBlock(inputTable, nInputColumns, iBlock * nRowsInBlock, nRowsInCurrentBlock, resultTable,
+                                           meanArray, standardDeviationInverse);
+            }
+            else
+            {
+                normalizeDataInBlock(inputTable, nInputColumns, iBlock * nRowsInBlock, nRowsInCurrentBlock, resultTable,
+                                     meanArray, standardDeviationInverse);
+            }
+        } );
+    }
+}
+
 template<typename algorithmFPType, CpuType cpu>
 inline void ZScoreKernelBase<algorithmFPType, cpu>::checkForInplace(SharedPtr<NumericTable> inputTable, SharedPtr<NumericTable> resultTable,
                                                                     size_t nInputColumns, size_t nBlocks, size_t nRowsInLastBlock)
@@ -125,30 +398,174 @@ inline void ZScoreKernelBase<algorithmFPType, cpu>::copyDataBlock(SharedPtr<Nume
     resultTable->releaseBlockOfRows(resultBlock);
 }
 
+template<typename algorithmFPType, CpuType cpu>
+inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeColumnInBlock(SharedPtr<NumericTable> inputTable, size_t column,
+                                                                           size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                                                           SharedPtr<NumericTable> resultTable, algorithmFPType mean,
+                                                                           algorithmFPType standardDeviationInverse)
+{
+    const bool isInplace = (inputTable.get() == resultTable.get());
+
+    BlockDescriptor<algorithmFPType> inputBlock;
+    inputTable->getBlockOfColumnValues(column, nProcessedRows, nRowsInCurrentBlock, (isInplace ? readWrite : readOnly), inputBlock);
+    algorithmFPType *inputArray = inputBlock.getBlockPtr();
+
+    BlockDescriptor<algorithmFPType> resultBlock;
+    algorithmFPType *resultArray = inputArray;
+    if(!isInplace)
+    {
+        resultTable->getBlockOfColumnValues(column, nProcessedRows, nRowsInCurrentBlock, writeOnly, resultBlock);
+        resultArray = resultBlock.getBlockPtr();
+    }
+
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+    {
+        resultArray[i] = (inputArray[i] - mean) * standardDeviationInverse;
+    }
+
+    if(!isInplace)
+    {
+        resultTable->releaseBlockOfColumnValues(resultBlock);
+    }
+    inputTable->releaseBlockOfColumnValues(inputBlock);
+}
+
 template<typename algorithmFPType, CpuType cpu>
 inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeDataInBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns,
                                                                          size_t nProcessedRows, size_t nRowsInCurrentBlock,
                                                                          SharedPtr<NumericTable> resultTable, algorithmFPType *meanArray,
                                                                          algorithmFPType *standardDeviationInverse)
 {
+    const bool isInplace = (inputTable.get() == resultTable.get());
+
     BlockDescriptor<algorithmFPType> inputBlock;
-    inputTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, readOnly, inputBlock);
+    inputTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, (isInplace ? readWrite : readOnly), inputBlock);
     algorithmFPType *inputArray = inputBlock.getBlockPtr();
 
     BlockDescriptor<algorithmFPType> resultBlock;
-    resultTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, writeOnly, resultBlock);
-    algorithmFPType *resultArray = resultBlock.getBlockPtr();
+    algorithmFPType *resultArray = inputArray;
+    if(!isInplace)
+    {
+        resultTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, writeOnly, resultBlock);
+        resultArray = resultBlock.getBlockPtr();
+    }
 
     for(size_t j = 0; j < nRowsInCurrentBlock; j++)
     {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
         for(size_t i = 0; i < nInputColumns; i++)
         {
             resultArray[j * nInputColumns + i] = ( inputArray[j * nInputColumns + i] - meanArray[i] ) * standardDeviationInverse[i];
         }
     }
 
+    if(!isInplace)
+    {
+        resultTable->releaseBlockOfRows(resultBlock);
+    }
     inputTable->releaseBlockOfRows(inputBlock);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void ZScoreKernelBase<algorithmFPType, cpu>::computeSparseBlockMoments(SharedPtr<NumericTable> inputTable, size_t nProcessedRows,
+                                                                       size_t nRowsInCurrentBlock, size_t nInputColumns, bool isMeanKnown,
+                                                                       const algorithmFPType *meanArray, algorithmFPType *blockMean,
+                                                                       algorithmFPType *blockSumSquares, algorithmFPType *nBlockNonZeros)
+{
+    const algorithmFPType zero = 0.0;
+    const algorithmFPType one  = 1.0;
+
+    CSRNumericTableIface *csrTable = dynamic_cast<CSRNumericTableIface *>(inputTable.get());
+    CSRBlockDescriptor<algorithmFPType> inputBlock;
+    csrTable->getSparseBlock(nProcessedRows, nRowsInCurrentBlock, readOnly, inputBlock);
+    const algorithmFPType *values = inputBlock.getBlockValuesPtr();
+    const size_t *colIndices = inputBlock.getBlockColumnIndicesPtr();
+    const size_t nValues = inputBlock.getDataSize();
+
+    service_memset<algorithmFPType, cpu>(nBlockNonZeros, zero, nInputColumns);
+    if(isMeanKnown)
+    {
+        for(size_t k = 0; k < nValues; k++)
+        {
+            nBlockNonZeros[colIndices[k] - 1] += one;
+        }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nInputColumns; j++)
+        {
+            blockMean[j] = meanArray[j];
+        }
+    }
+    else
+    {
+        service_memset<algorithmFPType, cpu>(blockMean, zero, nInputColumns);
+        for(size_t k = 0; k < nValues; k++)
+        {
+            blockMean[colIndices[k] - 1] += values[k];
+            nBlockNonZeros[colIndices[k] - 1] += one;
+        }
+        const algorithmFPType invN = one / (algorithmFPType)nRowsInCurrentBlock;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nInputColumns; j++)
+        {
+            blockMean[j] *= invN;
+        }
+    }
+
+    /* Each of the zero values of the column differs from the mean by the mean itself */
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for(size_t j = 0; j < nInputColumns; j++)
+    {
+        blockSumSquares[j] = ((algorithmFPType)nRowsInCurrentBlock - nBlockNonZeros[j]) * blockMean[j] * blockMean[j];
+    }
+    for(size_t k = 0; k < nValues; k++)
+    {
+        algorithmFPType diff = values[k] - blockMean[colIndices[k] - 1];
+        blockSumSquares[colIndices[k] - 1] += diff * diff;
+    }
+
+    csrTable->releaseSparseBlock(inputBlock);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeSparseDataInBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns,
+                                                                               size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                                                               SharedPtr<NumericTable> resultTable, algorithmFPType *meanArray,
+                                                                               algorithmFPType *standardDeviationInverse)
+{
+    CSRNumericTableIface *csrTable = dynamic_cast<CSRNumericTableIface *>(inputTable.get());
+    CSRBlockDescriptor<algorithmFPType> inputBlock;
+    csrTable->getSparseBlock(nProcessedRows, nRowsInCurrentBlock, readOnly, inputBlock);
+    const algorithmFPType *values = inputBlock.getBlockValuesPtr();
+    const size_t *colIndices = inputBlock.getBlockColumnIndicesPtr();
+    const size_t *rowOffsets = inputBlock.getBlockRowIndicesPtr();
+
+    BlockDescriptor<algorithmFPType> resultBlock;
+    resultTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, writeOnly, resultBlock);
+    algorithmFPType *resultArray = resultBlock.getBlockPtr();
+
+    for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+    {
+        algorithmFPType *resultRow = resultArray + i * nInputColumns;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nInputColumns; j++)
+        {
+            resultRow[j] = -meanArray[j] * standardDeviationInverse[j];
+        }
+        for(size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+        {
+            resultRow[colIndices[k] - 1] += values[k] * standardDeviationInverse[colIndices[k] - 1];
+        }
+    }
+
     resultTable->releaseBlockOfRows(resultBlock);
+    csrTable->releaseSparseBlock(inputBlock);
 }
 
 } // namespace daal::internal
@@ -107,6 +107,36 @@ inline void CrossEntropyKernel<algorithmFPType, method, cpu>::compute(
         }
         gradientMt.release();
     }
+    if(parameter->resultsToCompute & objective_function::hessianVectorProduct)
+    {
+        SharedPtr<NumericTable> hessianVectorProductTable = result->get(objective_function::resultCollection,
+                                                                        objective_function::hessianVectorProductIdx);
+
+        BlockMicroTable<algorithmFPType, writeOnly, cpu> hessianVectorProductMt( hessianVectorProductTable.get() );
+        algorithmFPType *hessianVectorProduct;
+        hessianVectorProductMt.getBlockOfRows( 0, nRows, &hessianVectorProduct );
+
+        SharedPtr<NumericTable> hessianVectorTable = result->get(objective_function::resultCollection,
+                                                                 objective_function::hessianVectorIdx);
+        BlockMicroTable<algorithmFPType, readOnly, cpu> hessianVectorMt( hessianVectorTable.get() );
+        algorithmFPType *hessianVector;
+        hessianVectorMt.getBlockOfRows( 0, nRows, &hessianVector );
+
+        /* The hessian is diagonal, only the probabilities of the ground truth classes contribute to it */
+        algorithmFPType invN = 1.0 / nRows;
+        for(size_t i = 0; i < nRows; i++)
+        {
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                hessianVectorProduct[i * nFeatures + j] = 0.0;
+            }
+            size_t k = i * nFeatures + groundTruthArray[i];
+            algorithmFPType p = sMax<algorithmFPType, cpu>(probabilitiesArray[k], minValFpType);
+            hessianVectorProduct[k] = invN * hessianVector[k] / (p * p);
+        }
+        hessianVectorMt.release();
+        hessianVectorProductMt.release();
+    }
     groundTruthMt.release();
     probabilitiesMt.release();
 }
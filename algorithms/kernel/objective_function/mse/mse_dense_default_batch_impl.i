@@ -24,6 +24,7 @@
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
 #include "service_blas.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -98,6 +99,23 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(
         }
     }
 
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> *mtHessianVectorProduct = NULL;
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtHessianVector(result->get(objective_function::resultCollection,
+                                                                                objective_function::hessianVectorIdx).get());
+    algorithmFPType *hessianVectorProduct = NULL, *hessianVector = NULL;
+    bool hessianVectorProductFlag = ((parameter->resultsToCompute & objective_function::hessianVectorProduct) != 0) ? true : false;
+    if (hessianVectorProductFlag)
+    {
+        mtHessianVectorProduct = new BlockMicroTable<algorithmFPType, writeOnly, cpu>(result->get(objective_function::resultCollection,
+                                                                                                  objective_function::hessianVectorProductIdx).get());
+        mtHessianVectorProduct->getBlockOfRows(0, 1, &hessianVectorProduct);
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            hessianVectorProduct[j] = zero;
+        }
+        mtHessianVector.getBlockOfRows(0, 1, &hessianVector);
+    }
+
     NumericTable *indices = parameter->batchIndices.get();
     size_t batchSize = 0;
     if(indices != NULL)
@@ -106,9 +124,62 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(
     }
 
     BlockMicroTable<algorithmFPType, readOnly, cpu> mtDependentVariables(input->get(dependentVariables).get());
-    if(batchSize != 0)
+    if(input->get(mse::data)->getDataLayout() == NumericTableIface::csrArray)
     {
-        size_t blockSizeDefault = 512; // max number of data rows in processed block
+        /* The observations in the CSR layout are processed without conversion to the dense layout */
+        CSRBlockMicroTable<algorithmFPType, readOnly, cpu> mtSparseData(input->get(mse::data).get());
+        algorithmFPType *values;
+        size_t *colIndices, *rowOffsets;
+        if(batchSize != 0)
+        {
+            int *indicesArray = NULL;
+            BlockMicroTable<int, readOnly, cpu> mtIndices(indices);
+            mtIndices.getBlockOfRows(0, 1, &indicesArray);
+            for(size_t idx = 0; idx < batchSize; idx++)
+            {
+                size_t index = indicesArray[idx];
+                mtSparseData.getSparseBlock(index, 1, &values, &colIndices, &rowOffsets);
+                mtDependentVariables.getBlockOfRows(index, 1, &dependentVariablesArray);
+
+                computeSparseMSE(1, nFeatures, valueFlag, hessianFlag, gradientFlag, hessianVectorProductFlag,
+                                 values, colIndices, rowOffsets, theta, theta0, dependentVariablesArray, hessianVector,
+                                 value, gradient, hessian, hessianVectorProduct);
+
+                mtSparseData.release();
+                mtDependentVariables.release();
+            }
+            mtIndices.release();
+        }
+        else
+        {
+            batchSize = mtData.getFullNumberOfRows();
+            mtSparseData.getSparseBlock(0, batchSize, &values, &colIndices, &rowOffsets);
+            mtDependentVariables.getBlockOfRows(0, batchSize, &dependentVariablesArray);
+
+            computeSparseMSE(batchSize, nFeatures, valueFlag, hessianFlag, gradientFlag, hessianVectorProductFlag,
+                             values, colIndices, rowOffsets, theta, theta0, dependentVariablesArray, hessianVector,
+                             value, gradient, hessian, hessianVectorProduct);
+
+            mtSparseData.release();
+            mtDependentVariables.release();
+        }
+
+        if (hessianFlag)
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                for (size_t j = 1; j < i; j++)
+                {
+                    hessian[j * nFeatures + i] = hessian[i * nFeatures + j];
+                }
+                hessian[i * nFeatures] = hessian[i];
+            }
+        }
+    }
+    else if(batchSize != 0)
+    {
+        /* Max number of data rows in processed block, sized to fit the cache */
+        size_t blockSizeDefault = daal::threader_get_block_size<algorithmFPType>(batchSize, nTheta + 2, 0);
         size_t blockSize = blockSizeDefault;
         size_t nBlocks = batchSize / blockSizeDefault;
         nBlocks += (nBlocks * blockSizeDefault != batchSize);
@@ -150,6 +221,10 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(
 
             computeMSE(blockSize,  nTheta, valueFlag, hessianFlag, gradientFlag, blockData, theta, theta0,
                        blockDependentVariables, value, gradient, hessian, xMultTheta);
+            if (hessianVectorProductFlag)
+            {
+                computeHessianVectorProduct(blockSize, nTheta, blockData, hessianVector, hessianVectorProduct);
+            }
         }
         mtIndices.release();
         daal_free(memory);
@@ -166,6 +241,10 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(
 
         computeMSE(batchSize, nTheta, valueFlag, hessianFlag, gradientFlag, data, theta, theta0,
                    dependentVariablesArray, value, gradient, hessian, xMultTheta);
+        if (hessianVectorProductFlag)
+        {
+            computeHessianVectorProduct(batchSize, nTheta, data, hessianVector, hessianVectorProduct);
+        }
 
         mtData.release();
         mtDependentVariables.release();
@@ -183,6 +262,14 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(
         }
     }
 
+    if (hessianVectorProductFlag)
+    {
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            hessianVectorProduct[j] *= batchSizeInv;
+        }
+    }
+
     if (valueFlag) {value[0] /= (algorithmFPType)(2 * batchSize);}
     if (hessianFlag)
     {
@@ -208,6 +295,12 @@ inline void MSEKernel<algorithmFPType, method, cpu>::compute(
         mtGradient->release();
         delete mtGradient;
     }
+    if (hessianVectorProductFlag)
+    {
+        mtHessianVectorProduct->release();
+        delete mtHessianVectorProduct;
+        mtHessianVector.release();
+    }
     return;
 }
 
@@ -286,6 +379,113 @@ inline void MSEKernel<algorithmFPType, method, cpu>::computeMSE(
     }
 }
 
+/**
+ *  \brief Adds the product of the hessian of the block of observations and the given vector
+ *         to the hessian-vector product without forming the hessian:
+ *         H * v = sum over i of (v[0] + x[i] * v[1..p]) * (1, x[i])
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+inline void MSEKernel<algorithmFPType, method, cpu>::computeHessianVectorProduct(
+    size_t blockSize, size_t nTheta,
+    const algorithmFPType *data,
+    const algorithmFPType *hessianVector,
+    algorithmFPType *hessianVectorProduct)
+{
+    const algorithmFPType *v = hessianVector + 1;
+    algorithmFPType *hv = hessianVectorProduct + 1;
+    for(size_t i = 0; i < blockSize; i++)
+    {
+        const algorithmFPType *x = data + i * nTheta;
+        algorithmFPType xMultV = hessianVector[0];
+        for(size_t j = 0; j < nTheta; j++)
+        {
+            xMultV += x[j] * v[j];
+        }
+
+        hessianVectorProduct[0] += xMultV;
+        for(size_t j = 0; j < nTheta; j++)
+        {
+            hv[j] += xMultV * x[j];
+        }
+    }
+}
+
+/**
+ *  \brief Adds the terms of the observations stored in the CSR layout to the value, the gradient,
+ *         the lower triangle and the first row of the hessian and the hessian-vector product.
+ *         Only the non-zero values of the observations are visited
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+inline void MSEKernel<algorithmFPType, method, cpu>::computeSparseMSE(
+    size_t nRows, size_t nFeatures, bool valueFlag, bool hessianFlag, bool gradientFlag, bool hessianVectorProductFlag,
+    const algorithmFPType *values, const size_t *colIndices, const size_t *rowOffsets,
+    const algorithmFPType *theta,
+    const algorithmFPType *theta0,
+    const algorithmFPType *dependentVariablesArray,
+    const algorithmFPType *hessianVector,
+    algorithmFPType *value,
+    algorithmFPType *gradient,
+    algorithmFPType *hessian,
+    algorithmFPType *hessianVectorProduct)
+{
+    for(size_t i = 0; i < nRows; i++)
+    {
+        const size_t begin = rowOffsets[i] - 1;
+        const size_t end   = rowOffsets[i + 1] - 1;
+
+        if (gradientFlag || valueFlag)
+        {
+            algorithmFPType residual = theta0[0] - dependentVariablesArray[i];
+            for(size_t k = begin; k < end; k++)
+            {
+                residual += values[k] * theta[colIndices[k] - 1];
+            }
+
+            if (gradientFlag)
+            {
+                gradient[0] += residual;
+                for(size_t k = begin; k < end; k++)
+                {
+                    gradient[colIndices[k]] += residual * values[k];
+                }
+            }
+            if (valueFlag)
+            {
+                value[0] += residual * residual;
+            }
+        }
+
+        if (hessianFlag)
+        {
+            for(size_t k = begin; k < end; k++)
+            {
+                const size_t col = colIndices[k];
+                hessian[col] += values[k];
+                for(size_t l = begin; l <= k; l++)
+                {
+                    const size_t row = colIndices[l];
+                    if (row > col) { hessian[row * nFeatures + col] += values[k] * values[l]; }
+                    else           { hessian[col * nFeatures + row] += values[k] * values[l]; }
+                }
+            }
+        }
+
+        if (hessianVectorProductFlag)
+        {
+            algorithmFPType xMultV = hessianVector[0];
+            for(size_t k = begin; k < end; k++)
+            {
+                xMultV += values[k] * hessianVector[colIndices[k]];
+            }
+            hessianVectorProduct[0] += xMultV;
+            for(size_t k = begin; k < end; k++)
+            {
+                hessianVectorProduct[colIndices[k]] += xMultV * values[k];
+            }
+        }
+    }
+}
+
 } // namespace daal::internal
 
 } // namespace mse
@@ -60,6 +60,24 @@ private:
     algorithmFPType *gradient,
     algorithmFPType *hessian,
     algorithmFPType *x_th);
+
+    void computeHessianVectorProduct(
+    size_t blockSize, size_t nTheta,
+    const algorithmFPType *data,
+    const algorithmFPType *hessianVector,
+    algorithmFPType *hessianVectorProduct);
+
+    void computeSparseMSE(
+    size_t nRows, size_t nFeatures, bool valueFlag, bool hessianFlag, bool gradientFlag, bool hessianVectorProductFlag,
+    const algorithmFPType *values, const size_t *colIndices, const size_t *rowOffsets,
+    const algorithmFPType *theta,
+    const algorithmFPType *theta0,
+    const algorithmFPType *dependentVariablesArray,
+    const algorithmFPType *hessianVector,
+    algorithmFPType *value,
+    algorithmFPType *gradient,
+    algorithmFPType *hessian,
+    algorithmFPType *hessianVectorProduct);
 };
 
 } // namespace daal::internal
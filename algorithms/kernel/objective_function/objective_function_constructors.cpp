@@ -64,7 +64,7 @@ Parameter::Parameter(size_t numberOfTerms, services::SharedPtr<data_management::
 
 Parameter::Parameter(const Parameter &other) :
     numberOfTerms(other.numberOfTerms),
-    objective_function::Parameter(other.resultsToCompute),
+    objective_function::Parameter(other),
     batchIndices(other.batchIndices) {};
 
 }
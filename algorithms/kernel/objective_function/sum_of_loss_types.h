@@ -212,7 +212,8 @@ public:
         size_t nFeatures = algInput->get(probabilities)->getNumberOfColumns();
         size_t nRows = algInput->get(probabilities)->getNumberOfRows();
 
-        SharedPtr<DataCollection> collection = SharedPtr<DataCollection>(new DataCollection(3));
+        SharedPtr<DataCollection> collection = SharedPtr<DataCollection>(new DataCollection(5));
+        (*collection)[(int)objective_function::hessianVectorIdx] = getHessianVector();
 
         if(algParameter->resultsToCompute & objective_function::gradient)
         {
@@ -224,6 +225,11 @@ public:
             (*collection)[(int)objective_function::valueIdx] =
                 SharedPtr<SerializationIface>(new HomogenNumericTable<algorithmFPType>(1, 1, NumericTable::doAllocate, 0));
         }
+        if(algParameter->resultsToCompute & objective_function::hessianVectorProduct)
+        {
+            (*collection)[(int)objective_function::hessianVectorProductIdx] =
+                SharedPtr<SerializationIface>(new HomogenNumericTable<algorithmFPType>(nFeatures, nRows, NumericTable::doAllocate, 0));
+        }
 
         Argument::set(objective_function::resultCollection, staticPointerCast<DataCollection, SerializationIface>(collection));
     }
@@ -260,6 +266,15 @@ public:
             error = checkTable(get(objective_function::resultCollection, objective_function::gradientIdx), "gradient", nRows, nFeatures);
             if(error->id() != NoErrorMessageFound) { this->_errors->add(error); return; }
         }
+        if(algParameter->resultsToCompute & objective_function::hessianVectorProduct)
+        {
+            error = checkHessianVector(staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(getHessianVector()),
+                                       nRows, nFeatures);
+            if(error->id() != NoErrorMessageFound) { this->_errors->add(error); return; }
+            error = checkTable(get(objective_function::resultCollection, objective_function::hessianVectorProductIdx),
+                               "hessianVectorProduct", nRows, nFeatures);
+            if(error->id() != NoErrorMessageFound) { this->_errors->add(error); return; }
+        }
         if(algParameter->resultsToCompute & objective_function::hessian)
         {
             error->setId(services::ErrorNullOutputNumericTable);
@@ -0,0 +1,380 @@
+/* file: profiler.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the profiler of the library.
+//--
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <tbb/spin_mutex.h>
+#if defined(__GNUC__)
+    #include <cxxabi.h>
+#endif
+
+#include "daal_profiler.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+
+const size_t maxStatistics = 4096;              /* Maximal number of the statistics records */
+const size_t statisticsHashSize = 2 * maxStatistics;
+
+static const char *eventTypeNames[] =
+{
+    "compute",
+    "finalizeCompute",
+    "kernel",
+    "dataConversion",
+    "blas",
+    "lapack",
+    "memory"
+};
+
+static const char *cpuNames[] =
+{
+    "sse2",
+    "ssse3",
+    "sse42",
+    "avx",
+    "avx2",
+    "avx512_mic",
+    "avx512"
+};
+
+const int nCpuNames = sizeof(cpuNames) / sizeof(cpuNames[0]);
+
+/* Statistics record with the name of the operation used as the key */
+struct StatisticsRecord
+{
+    ProfilerStatistics statistics;
+    const char *key;        /* Name passed to Profiler::addEvent() */
+    char *demangledName;    /* Readable name of the algorithm container, NULL for other operations */
+};
+
+struct ProfilerState
+{
+    ProfilerCallback *callback;
+    std::chrono::steady_clock::time_point origin;
+    size_t nThreads;
+    size_t nRecords;
+    StatisticsRecord records[maxStatistics];
+    int hash[statisticsHashSize];   /* Indices of the records plus one, 0 for the empty slots */
+    tbb::spin_mutex mutex;
+};
+
+static ProfilerState state;
+
+/* Names of the operations created by Profiler::getMethodName() */
+struct MethodNames
+{
+    struct Node
+    {
+        Node *next;
+        char name[1];
+    };
+
+    Node *head;
+    tbb::spin_mutex mutex;
+
+    ~MethodNames()
+    {
+        while (head)
+        {
+            Node *next = head->next;
+            free(head);
+            head = next;
+        }
+    }
+};
+
+static MethodNames methodNames;
+
+static thread_local size_t threadId = 0;
+static thread_local bool isInCallback = false;
+
+static size_t hashKey(ProfilerEventType type, const char *name, int cpu)
+{
+    size_t h = 2166136261u;
+    for (const char *c = name; *c; c++)
+    {
+        h = (h ^ (unsigned char)(*c)) * 16777619u;
+    }
+    h = (h ^ (size_t)type) * 16777619u;
+    h = (h ^ (size_t)(cpu + 1)) * 16777619u;
+    return h;
+}
+
+static bool isSameKey(const StatisticsRecord &r, ProfilerEventType type, const char *name, int cpu)
+{
+    return (r.statistics.type == type && r.statistics.cpu == cpu && (r.key == name || strcmp(r.key, name) == 0));
+}
+
+/* Returns the readable name of the algorithm container from the name of its type */
+static char *demangle(const char *name)
+{
+#if defined(__GNUC__)
+    int status = 0;
+    char *demangledName = abi::__cxa_demangle(name, NULL, NULL, &status);
+    if (status == 0) { return demangledName; }
+    free(demangledName);
+#endif
+    return NULL;
+}
+
+/* Returns the statistics record of the operation. Must be called under the lock */
+static StatisticsRecord *findRecord(ProfilerEventType type, const char *name, int cpu)
+{
+    size_t slot = hashKey(type, name, cpu) % statisticsHashSize;
+    while (state.hash[slot] != 0)
+    {
+        StatisticsRecord &r = state.records[state.hash[slot] - 1];
+        if (isSameKey(r, type, name, cpu)) { return &r; }
+        slot = (slot + 1) % statisticsHashSize;
+    }
+
+    if (state.nRecords == maxStatistics) { return NULL; }
+
+    StatisticsRecord &r = state.records[state.nRecords];
+    state.hash[slot] = (int)(++state.nRecords);
+
+    r.key = name;
+    r.demangledName = ((type == profilerAlgorithmCompute || type == profilerAlgorithmFinalizeCompute) ? demangle(name) : NULL);
+    r.statistics.type = type;
+    r.statistics.name = (r.demangledName ? r.demangledName : name);
+    r.statistics.cpu = cpu;
+    r.statistics.count = 0;
+    r.statistics.size = 0;
+    r.statistics.totalTime = 0;
+    r.statistics.minTime = 0;
+    r.statistics.maxTime = 0;
+    return &r;
+}
+
+static void writeString(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (const char *c = s; *c; c++)
+    {
+        if (*c == '"' || *c == '\\') { fputc('\\', f); }
+        fputc(*c, f);
+    }
+    fputc('"', f);
+}
+
+} // namespace internal
+
+using namespace internal;
+
+volatile bool Profiler::_isActive = false;
+
+void Profiler::enable()
+{
+    tbb::spin_mutex::scoped_lock lock(state.mutex);
+    state.origin = std::chrono::steady_clock::now();
+#if defined(DAAL_PROFILER)
+    _isActive = true;
+#endif
+}
+
+void Profiler::disable()
+{
+    _isActive = false;
+}
+
+bool Profiler::isEnabled()
+{
+    return _isActive;
+}
+
+void Profiler::reset()
+{
+    tbb::spin_mutex::scoped_lock lock(state.mutex);
+    for (size_t i = 0; i < state.nRecords; i++)
+    {
+        free(state.records[i].demangledName);
+    }
+    state.nRecords = 0;
+    memset(state.hash, 0, sizeof(state.hash));
+}
+
+void Profiler::setCallback(ProfilerCallback *callback)
+{
+    tbb::spin_mutex::scoped_lock lock(state.mutex);
+    state.callback = callback;
+}
+
+size_t Profiler::getNumberOfStatistics()
+{
+    tbb::spin_mutex::scoped_lock lock(state.mutex);
+    return state.nRecords;
+}
+
+bool Profiler::getStatistics(size_t index, ProfilerStatistics &statistics)
+{
+    tbb::spin_mutex::scoped_lock lock(state.mutex);
+    if (index >= state.nRecords) { return false; }
+    statistics = state.records[index].statistics;
+    return true;
+}
+
+unsigned long long Profiler::getTime()
+{
+    return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - state.origin).count();
+}
+
+const char *Profiler::getMethodName(const char *typeName, const char *methodName)
+{
+    char *demangledName = demangle(typeName);
+    const char *className = (demangledName ? demangledName : typeName);
+    size_t length = strlen(className) + strlen(methodName) + 2;
+
+    MethodNames::Node *node = (MethodNames::Node *)malloc(sizeof(MethodNames::Node) + length);
+    if (!node)
+    {
+        free(demangledName);
+        return methodName;
+    }
+    snprintf(node->name, length + 1, "%s::%s", className, methodName);
+    free(demangledName);
+
+    tbb::spin_mutex::scoped_lock lock(methodNames.mutex);
+    node->next = methodNames.head;
+    methodNames.head = node;
+    return node->name;
+}
+
+void Profiler::addEvent(ProfilerEventType type, const char *name, int cpu, unsigned long long start, size_t size)
+{
+    unsigned long long end = getTime();
+    if (isInCallback) { return; }
+
+    tbb::spin_mutex::scoped_lock lock(state.mutex);
+    if (threadId == 0) { threadId = ++state.nThreads; }
+
+    StatisticsRecord *r = findRecord(type, name, cpu);
+    if (!r) { return; }
+
+    unsigned long long time = (end > start ? end - start : 0);
+    ProfilerStatistics &s = r->statistics;
+    s.minTime = (s.count == 0 || time < s.minTime ? time : s.minTime);
+    s.maxTime = (time > s.maxTime ? time : s.maxTime);
+    s.totalTime += time;
+    s.size += size;
+    s.count++;
+
+    if (state.callback)
+    {
+        ProfilerEvent event;
+        event.type = type;
+        event.name = s.name;
+        event.cpu = cpu;
+        event.threadId = threadId;
+        event.size = size;
+        event.start = start;
+        event.time = time;
+
+        isInCallback = true;
+        state.callback->onEvent(event);
+        isInCallback = false;
+    }
+}
+
+bool Profiler::writeJSON(const char *fileName)
+{
+    FILE *f = fopen(fileName, "w");
+    if (!f) { return false; }
+
+    tbb::spin_mutex::scoped_lock lock(state.mutex);
+    fprintf(f, "{\n\"statistics\": [");
+    for (size_t i = 0; i < state.nRecords; i++)
+    {
+        const ProfilerStatistics &s = state.records[i].statistics;
+        fprintf(f, "%s\n{\"type\": \"%s\", \"name\": ", (i > 0 ? "," : ""), eventTypeNames[s.type]);
+        writeString(f, s.name);
+        if (s.cpu >= 0 && s.cpu < nCpuNames)
+        {
+            fprintf(f, ", \"cpu\": \"%s\"", cpuNames[s.cpu]);
+        }
+        fprintf(f, ", \"count\": %lu, \"size\": %lu, \"totalTime\": %llu, \"minTime\": %llu, \"maxTime\": %llu}",
+                (unsigned long)s.count, (unsigned long)s.size, s.totalTime, s.minTime, s.maxTime);
+    }
+    fprintf(f, "\n],\n\"timeUnit\": \"ns\"\n}\n");
+
+    return (fclose(f) == 0);
+}
+
+ChromeTraceWriter::ChromeTraceWriter(size_t capacity) : _events(NULL), _capacity(capacity), _size(0), _bufferSize(0)
+{
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+    free(_events);
+}
+
+void ChromeTraceWriter::onEvent(const ProfilerEvent &event)
+{
+    if (_size == _bufferSize)
+    {
+        if (_bufferSize == _capacity) { return; }
+        size_t bufferSize = (_bufferSize > 0 ? 2 * _bufferSize : 1024);
+        bufferSize = (bufferSize < _capacity ? bufferSize : _capacity);
+        ProfilerEvent *events = (ProfilerEvent *)realloc(_events, bufferSize * sizeof(ProfilerEvent));
+        if (!events) { return; }
+        _events = events;
+        _bufferSize = bufferSize;
+    }
+    _events[_size++] = event;
+}
+
+bool ChromeTraceWriter::write(const char *fileName) const
+{
+    FILE *f = fopen(fileName, "w");
+    if (!f) { return false; }
+
+    fprintf(f, "{\n\"traceEvents\": [");
+    for (size_t i = 0; i < _size; i++)
+    {
+        const ProfilerEvent &e = _events[i];
+        fprintf(f, "%s\n{\"name\": ", (i > 0 ? "," : ""));
+        writeString(f, e.name);
+        fprintf(f, ", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %lu, \"ts\": %.3f, \"dur\": %.3f",
+                eventTypeNames[e.type], (unsigned long)e.threadId, (double)e.start / 1000.0, (double)e.time / 1000.0);
+        fprintf(f, ", \"args\": {\"size\": %lu", (unsigned long)e.size);
+        if (e.cpu >= 0 && e.cpu < nCpuNames)
+        {
+            fprintf(f, ", \"cpu\": \"%s\"", cpuNames[e.cpu]);
+        }
+        fprintf(f, "}}");
+    }
+    fprintf(f, "\n],\n\"displayTimeUnit\": \"ns\"\n}\n");
+
+    return (fclose(f) == 0);
+}
+
+} // namespace services
+} // namespace daal
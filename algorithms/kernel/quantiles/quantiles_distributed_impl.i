@@ -0,0 +1,107 @@
+/* file: quantiles_distributed_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Quantiles computation algorithm implementation in the distributed processing mode
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_IMPL__
+#define __QUANTILES_DISTRIBUTED_IMPL__
+
+#include "quantiles_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(data_management::DataCollection *partialResultsCollection,
+    NumericTable *meansTable, NumericTable *weightsTable, NumericTable *minimumTable, NumericTable *maximumTable, const Parameter *par)
+{
+    typedef TDigest<algorithmFPType, cpu> Digest;
+
+    const size_t nFeatures   = meansTable->getNumberOfRows();
+    const size_t capacity    = par->getMaxNumberOfCentroids();
+    const double compression = (double)par->compression;
+    const size_t nPartials   = partialResultsCollection->size();
+
+    SketchTables<algorithmFPType, readWrite, cpu> tables(meansTable, weightsTable, minimumTable, maximumTable);
+    if(!tables.isValid)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* Buffers of the merge of two sketches */
+    daal::tls<algorithmFPType *> buffers( [=]() -> algorithmFPType *
+    {
+        return daal::services::internal::service_calloc<algorithmFPType, cpu>(4 * capacity);
+    } );
+
+    bool isValid = true;
+    for(size_t i = 0; i < nPartials && isValid; i++)
+    {
+        PartialResult *partialResult = static_cast<PartialResult *>((*partialResultsCollection)[i].get());
+
+        SketchTables<algorithmFPType, readOnly, cpu> partialTables(partialResult->get(partialCentroidMeans).get(),
+                                                                   partialResult->get(partialCentroidWeights).get(),
+                                                                   partialResult->get(partialMinimum).get(),
+                                                                   partialResult->get(partialMaximum).get());
+        if(!partialTables.isValid) { isValid = false; break; }
+
+        /* The sketches of the features are merged in parallel */
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+        {
+            algorithmFPType *buffer = buffers.local();
+            if(!buffer) { return; }
+
+            const algorithmFPType *srcWeights = partialTables.weights + j * capacity;
+            Digest::add(tables.means + j * capacity, tables.weights + j * capacity, tables.minimum[j], tables.maximum[j],
+                        partialTables.means + j * capacity, srcWeights, Digest::getSize(srcWeights, capacity),
+                        partialTables.minimum[j], partialTables.maximum[j], compression, capacity, buffer, buffer + 2 * capacity);
+        } );
+
+        buffers.reduce( [&](algorithmFPType *buffer)
+        {
+            if(!buffer) { isValid = false; }
+        } );
+    }
+
+    buffers.reduce( [](algorithmFPType *buffer)
+    {
+        daal::services::daal_free(buffer);
+    } );
+
+    if(!isValid) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -28,6 +28,7 @@
 #include "service_memory.h"
 #include "service_math.h"
 #include "service_stat.h"
+#include "quantiles_selection_aux.i"
 
 using namespace daal::internal;
 
@@ -39,6 +40,12 @@ namespace quantiles
 {
 namespace internal
 {
+/* The quantiles are computed by the selection of the order statistics instead of the sort of the features
+   for at least minVectorsForSelection observations and at most maxOrdersForSelection quantile orders,
+   every value is compared with the intervals of all the order statistics of its feature */
+const size_t minVectorsForSelection = 65536;
+const size_t maxOrdersForSelection  = 16;
+
 template<Method method, typename AlgorithmFPType, CpuType cpu>
 void QuantilesKernel<method, AlgorithmFPType, cpu>::compute(const NumericTable *a, NumericTable *r, const Parameter *par)
 {
@@ -82,12 +89,29 @@ void QuantilesKernel<method, AlgorithmFPType, cpu>::compute(const NumericTable *
         return;
     }
 
-    int errorcode = Statistics<AlgorithmFPType, cpu>::xQuantiles(data, nFeatures, nVectors, nQuantileOrders, quantileOrders, quants);
+    if(nVectors < minVectorsForSelection || nQuantileOrders > maxOrdersForSelection)
+    {
+        int errorcode = Statistics<AlgorithmFPType, cpu>::xQuantiles(data, nFeatures, nVectors, nQuantileOrders, quantileOrders, quants);
 
-    if(errorcode)
+        if(errorcode)
+        {
+            if(errorcode == __DAAL_VSL_SS_ERROR_BAD_QUANT_ORDER) { this->_errors->add(services::ErrorQuantileOrderValueIsInvalid); }
+            else { this->_errors->add(services::ErrorQuantilesInternal); }
+        }
+    }
+    else
     {
-        if(errorcode == __DAAL_VSL_SS_ERROR_BAD_QUANT_ORDER) { this->_errors->add(services::ErrorQuantileOrderValueIsInvalid); }
-        else { this->_errors->add(services::ErrorQuantilesInternal); }
+        bool isOrderValid = true;
+        for(size_t k = 0; k < nQuantileOrders; k++)
+        {
+            isOrderValid = isOrderValid && quantileOrders[k] >= (AlgorithmFPType)0 && quantileOrders[k] <= (AlgorithmFPType)1;
+        }
+
+        if(!isOrderValid) { this->_errors->add(services::ErrorQuantileOrderValueIsInvalid); }
+        else if(!MultiSelection<AlgorithmFPType, cpu>::compute(data, nFeatures, nVectors, nQuantileOrders, quantileOrders, quants))
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
     }
 
     aMicroTable.release();
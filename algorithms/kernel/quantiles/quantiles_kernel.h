@@ -26,6 +26,8 @@
 
 #include "numeric_table.h"
 #include "quantiles_batch.h"
+#include "quantiles_online.h"
+#include "quantiles_distributed.h"
 
 #include "service_defines.h"
 #include "service_micro_table.h"
@@ -48,6 +50,24 @@ struct QuantilesKernel : public Kernel
     void compute(const NumericTable *a, NumericTable *r, const Parameter *par);
 };
 
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    void compute(const NumericTable *dataTable, NumericTable *meansTable, NumericTable *weightsTable,
+                 NumericTable *minimumTable, NumericTable *maximumTable, const Parameter *par);
+    void finalizeCompute(NumericTable *meansTable, NumericTable *weightsTable, NumericTable *minimumTable,
+                         NumericTable *maximumTable, NumericTable *r, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public QuantilesOnlineKernel<method, algorithmFPType, cpu>
+{
+    virtual ~QuantilesDistributedKernel() {}
+    void compute(data_management::DataCollection *partialResultsCollection, NumericTable *meansTable, NumericTable *weightsTable,
+                 NumericTable *minimumTable, NumericTable *maximumTable, const Parameter *par);
+};
+
 } // namespace daal::algorithms::quantiles::internal
 
 } // namespace daal::algorithms::quantiles
@@ -0,0 +1,212 @@
+/* file: quantiles_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Quantiles computation algorithm implementation in the online processing mode
+//--
+*/
+
+#ifndef __QUANTILES_ONLINE_IMPL__
+#define __QUANTILES_ONLINE_IMPL__
+
+#include "service_micro_table.h"
+#include "service_memory.h"
+#include "threading.h"
+#include "quantiles_sketch_aux.i"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+/* Tables of the sketches of the partial result */
+template<typename algorithmFPType, ReadWriteMode mode, CpuType cpu>
+struct SketchTables
+{
+    SketchTables(NumericTable *meansTable, NumericTable *weightsTable, NumericTable *minimumTable, NumericTable *maximumTable) :
+        meansMicroTable(meansTable), weightsMicroTable(weightsTable), minimumMicroTable(minimumTable), maximumMicroTable(maximumTable)
+    {
+        const size_t nFeatures = meansTable->getNumberOfRows();
+        isValid = (meansMicroTable  .getBlockOfRows(0, nFeatures, &means)   == nFeatures &&
+                   weightsMicroTable.getBlockOfRows(0, nFeatures, &weights) == nFeatures &&
+                   minimumMicroTable.getBlockOfRows(0, nFeatures, &minimum) == nFeatures &&
+                   maximumMicroTable.getBlockOfRows(0, nFeatures, &maximum) == nFeatures);
+    }
+
+    ~SketchTables()
+    {
+        meansMicroTable.release();
+        weightsMicroTable.release();
+        minimumMicroTable.release();
+        maximumMicroTable.release();
+    }
+
+    BlockMicroTable<algorithmFPType, mode, cpu> meansMicroTable;
+    BlockMicroTable<algorithmFPType, mode, cpu> weightsMicroTable;
+    BlockMicroTable<algorithmFPType, mode, cpu> minimumMicroTable;
+    BlockMicroTable<algorithmFPType, mode, cpu> maximumMicroTable;
+
+    algorithmFPType *means;
+    algorithmFPType *weights;
+    algorithmFPType *minimum;
+    algorithmFPType *maximum;
+    bool isValid;
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable *dataTable, NumericTable *meansTable,
+    NumericTable *weightsTable, NumericTable *minimumTable, NumericTable *maximumTable, const Parameter *par)
+{
+    typedef Sketches<algorithmFPType, cpu> SketchesType;
+
+    const size_t nFeatures   = dataTable->getNumberOfColumns();
+    const size_t nVectors    = dataTable->getNumberOfRows();
+    const size_t capacity    = par->getMaxNumberOfCentroids();
+    const double compression = (double)par->compression;
+
+    BlockMicroTable<algorithmFPType, readOnly, cpu> dataMicroTable(const_cast<NumericTable *>(dataTable));
+    algorithmFPType *data;
+    if(dataMicroTable.getBlockOfRows(0, nVectors, &data) != nVectors)
+    {
+        dataMicroTable.release();
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    SketchTables<algorithmFPType, readWrite, cpu> tables(meansTable, weightsTable, minimumTable, maximumTable);
+    if(!tables.isValid)
+    {
+        dataMicroTable.release();
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* The values of the block are sorted and merged into the sketch at once,
+       so the block is a few times larger than the sketch */
+    const size_t minBlockSize = 4 * capacity;
+    const size_t maxBlockSize = (minBlockSize > 4096 ? minBlockSize : 4096);
+    const size_t blockSize = daal::threader_get_block_size<algorithmFPType>(nVectors, nFeatures, daal::threaderBlocksPerThread,
+                                                                            minBlockSize, maxBlockSize);
+
+    daal::partial_tls<SketchesType *> partialSketches( [=]() -> SketchesType *
+    {
+        return new SketchesType(nFeatures, capacity, blockSize, compression);
+    } );
+
+    partialSketches.for_row_blocks(nVectors, blockSize, [&](size_t iStartRow, size_t nRowsInBlock, SketchesType *local)
+    {
+        if(!local->isValid) { return; }
+        local->addBlock(data, iStartRow, nRowsInBlock);
+    } );
+
+    /* The partial sketches that failed to allocate their buffers are found after the parallel loop */
+    bool isValid = true;
+    partialSketches.reduce( [&](SketchesType *local)
+    {
+        if(!local->isValid) { isValid = false; }
+    } );
+
+    if(isValid)
+    {
+        SketchesType *sketches = partialSketches.merge( [](SketchesType *dst, SketchesType *src)
+        {
+            dst->merge(*src);
+        } );
+        if(sketches) { sketches->addTo(tables.means, tables.weights, tables.minimum, tables.maximum); }
+    }
+    else
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+
+    partialSketches.reduce( [](SketchesType *local)
+    {
+        delete local;
+    } );
+
+    dataMicroTable.release();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(NumericTable *meansTable, NumericTable *weightsTable,
+    NumericTable *minimumTable, NumericTable *maximumTable, NumericTable *r, const Parameter *par)
+{
+    const size_t nFeatures       = meansTable->getNumberOfRows();
+    const size_t capacity        = meansTable->getNumberOfColumns();
+    const size_t nQuantileOrders = r->getNumberOfColumns();
+
+    SketchTables<algorithmFPType, readOnly, cpu> tables(meansTable, weightsTable, minimumTable, maximumTable);
+    BlockMicroTable<algorithmFPType, readOnly, cpu> quantileOrdersMicroTable(const_cast<NumericTable *>(par->quantileOrders.get()));
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> rMicroTable(r);
+
+    algorithmFPType *quantileOrders, *quants;
+    if(!tables.isValid ||
+       quantileOrdersMicroTable.getBlockOfRows(0, 1, &quantileOrders) != 1 ||
+       rMicroTable.getBlockOfRows(0, nFeatures, &quants) != nFeatures)
+    {
+        quantileOrdersMicroTable.release();
+        rMicroTable.release();
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    bool isOrderValid = true;
+    for(size_t k = 0; k < nQuantileOrders; k++)
+    {
+        isOrderValid = isOrderValid && quantileOrders[k] >= (algorithmFPType)0 && quantileOrders[k] <= (algorithmFPType)1;
+    }
+
+    if(isOrderValid)
+    {
+        const algorithmFPType *means = tables.means, *weights = tables.weights;
+        const algorithmFPType *minimum = tables.minimum, *maximum = tables.maximum;
+        daal::threader_for(nFeatures, nFeatures, [=](size_t j)
+        {
+            const algorithmFPType *featureWeights = weights + j * capacity;
+            const size_t n = TDigest<algorithmFPType, cpu>::getSize(featureWeights, capacity);
+            for(size_t k = 0; k < nQuantileOrders; k++)
+            {
+                quants[j * nQuantileOrders + k] = TDigest<algorithmFPType, cpu>::quantile(means + j * capacity, featureWeights, n,
+                                                      minimum[j], maximum[j], (double)quantileOrders[k]);
+            }
+        } );
+    }
+    else
+    {
+        this->_errors->add(services::ErrorQuantileOrderValueIsInvalid);
+    }
+
+    quantileOrdersMicroTable.release();
+    rMicroTable.release();
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,669 @@
+/* file: quantiles_selection_aux.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Exact quantiles of large data sets by the parallel multi-selection.
+//
+//  The order statistics needed for the quantiles of all the features are selected together.
+//  The keys of the values are the unsigned integers in the order of the values. For every order
+//  statistic the interval [lo, hi] of the keys that contains it is taken from a sample of the feature.
+//  The intervals of a feature are ordered as the ranks, so one pass over the data finds the intervals
+//  of every key by the number of the bounds below it, counts in parallel over the blocks of rows the keys below the intervals
+//  and gathers the values inside the intervals. The order statistics are selected from the gathered values
+//  in parallel.
+//
+//  An interval missed by the sample is extended to all the keys on its side. Then every pass over the data
+//  counts the keys below the intervals and the histograms of the keys inside the intervals, and the intervals
+//  are narrowed to the bins with the order statistics until they contain few values.
+//
+//  The data is read once in most cases and only the values of the intervals are kept, the size of an interval
+//  is about 4 n / sqrt(s) for the sample of s values.
+//--
+*/
+
+#ifndef __QUANTILES_SELECTION_AUX_I__
+#define __QUANTILES_SELECTION_AUX_I__
+
+#include <math.h>
+#include "service_memory.h"
+#include "service_stat.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+struct MultiSelection
+{
+    typedef daal::internal::vec::VecStatKernels<algorithmFPType, cpu> StatKernels;
+    typedef typename StatKernels::KeyType KeyType;
+
+    static const size_t nBins          = 256;   /* Number of the bins of the histogram of an interval */
+    static const size_t minSampleSize  = 8192;  /* Minimal number of the values of a feature in the sample */
+    static const size_t sampleFraction = 16;    /* The sample of a feature keeps every sampleFraction-th value */
+    static const size_t minCandidates  = 4096;  /* Number of the values of an interval that are always gathered */
+
+    /* Order statistic of a feature */
+    struct Target
+    {
+        size_t feature;
+        size_t rank;            /* The order statistic is the value of the rank in the sorted feature */
+        KeyType lo;             /* The key of the order statistic is in [lo, hi] */
+        KeyType hi;
+        size_t shift;           /* The bin of the key in [lo, hi] is (key - lo) >> shift */
+        size_t nBelow;          /* Number of the values with the keys less than lo */
+        size_t nCandidates;     /* Number of the values with the keys in [lo, hi] */
+        bool isReady;           /* The interval is final */
+        bool isKnown;           /* The value is known without the gathering */
+        algorithmFPType value;
+    };
+
+    /* Values of the intervals gathered by a thread */
+    struct Candidates
+    {
+        algorithmFPType **values;
+        size_t *sizes;
+        size_t *capacities;
+        size_t *counts;         /* Counts of the keys below the intervals, if any */
+        bool isValid;
+    };
+
+    /* Computes the quantiles of the nOrders orders of the p features of the n rows of the data.
+       The quantiles of the feature j are quants[j * nOrders], ..., quants[j * nOrders + nOrders - 1].
+       Returns false if the memory is not allocated */
+    static bool compute(const algorithmFPType *data, size_t p, size_t n, size_t nOrders, const algorithmFPType *orders,
+                        algorithmFPType *quants)
+    {
+        /* The ranks of the order statistics are the same for all the features */
+        size_t *ranks = (size_t *)daal::services::daal_malloc(2 * nOrders * sizeof(size_t));
+        if(!ranks) { return false; }
+        size_t nRanks = 0;
+        for(size_t k = 0; k < nOrders; k++)
+        {
+            size_t index;
+            double fraction;
+            getPosition(n, orders[k], index, fraction);
+            nRanks = addRank(ranks, nRanks, index);
+            if(fraction > 0.0) { nRanks = addRank(ranks, nRanks, index + 1); }
+        }
+
+        const size_t nTargets = p * nRanks;
+        Target *targets = (Target *)daal::services::daal_malloc(nTargets * sizeof(Target));
+        if(!targets) { daal::services::daal_free(ranks); return false; }
+
+        bool isValid = initializeTargets(data, p, n, ranks, nRanks, targets);
+        if(isValid) { isValid = selectInSampleIntervals(data, p, n, nRanks, targets); }
+
+        size_t maxCandidates = n * p / (32 * nTargets);
+        if(maxCandidates < minCandidates) { maxCandidates = minCandidates; }
+
+        bool isNarrowed = false;
+        while(isValid && !isNarrowed)
+        {
+            isValid = narrowIntervals(data, p, n, targets, nTargets, maxCandidates, isNarrowed);
+        }
+
+        if(isValid) { isValid = selectCandidates(data, p, n, targets, nTargets); }
+
+        if(isValid)
+        {
+            for(size_t j = 0; j < p; j++)
+            {
+                const Target *featureTargets = targets + j * nRanks;
+                for(size_t k = 0; k < nOrders; k++)
+                {
+                    size_t index;
+                    double fraction;
+                    getPosition(n, orders[k], index, fraction);
+
+                    const algorithmFPType value = featureTargets[findRank(ranks, nRanks, index)].value;
+                    algorithmFPType next = value;
+                    if(fraction > 0.0) { next = featureTargets[findRank(ranks, nRanks, index + 1)].value; }
+                    quants[j * nOrders + k] = value + (algorithmFPType)fraction * (next - value);
+                }
+            }
+        }
+
+        daal::services::daal_free(targets);
+        daal::services::daal_free(ranks);
+        return isValid;
+    }
+
+protected:
+    /* The quantile of order b is x(index) + fraction * (x(index + 1) - x(index)), (n - 1) * b = index + fraction */
+    static void getPosition(size_t n, algorithmFPType order, size_t &index, double &fraction)
+    {
+        const double position = (double)(n - 1) * (double)order;
+        index = (size_t)position;
+        fraction = position - (double)index;
+        if(index >= n - 1) { index = n - 1; fraction = 0.0; }
+    }
+
+    /* Inserts the rank into the sorted array of the distinct ranks */
+    static size_t addRank(size_t *ranks, size_t nRanks, size_t rank)
+    {
+        size_t i = nRanks;
+        for(; i > 0 && ranks[i - 1] >= rank; i--)
+        {
+            if(ranks[i - 1] == rank) { return nRanks; }
+        }
+        for(size_t k = nRanks; k > i; k--)
+        {
+            ranks[k] = ranks[k - 1];
+        }
+        ranks[i] = rank;
+        return nRanks + 1;
+    }
+
+    static size_t findRank(const size_t *ranks, size_t nRanks, size_t rank)
+    {
+        size_t i = 0;
+        while(i + 1 < nRanks && ranks[i] != rank) { i++; }
+        return i;
+    }
+
+    static size_t getShift(KeyType lo, KeyType hi)
+    {
+        size_t shift = 0;
+        while(((hi - lo) >> shift) >= (KeyType)nBins) { shift++; }
+        return shift;
+    }
+
+    /* Sets the intervals of the order statistics from the strided samples of the features */
+    static bool initializeTargets(const algorithmFPType *data, size_t p, size_t n, const size_t *ranks, size_t nRanks,
+                                  Target *targets)
+    {
+        size_t s = n / sampleFraction;
+        s = (s > minSampleSize ? s : minSampleSize);
+        s = (s < n ? s : n);
+        const double halfWidth = 2.0 * sqrt((double)s) + 1.0;
+        const KeyType maxKey = ~(KeyType)0;
+
+        daal::tls<KeyType *> sampleBuffer( [=]()-> KeyType *
+        {
+            return (KeyType *)daal::services::daal_malloc(2 * s * sizeof(KeyType));
+        } );
+
+        daal::threader_for( (int)p, (int)p, [&](int iFeature)
+        {
+            KeyType *keys = sampleBuffer.local();
+            if(!keys) { return; }
+
+            const size_t j = (size_t)iFeature;
+            for(size_t k = 0; k < s; k++)
+            {
+                keys[k] = StatKernels::toKey(data[(k * n / s) * p + j]);
+            }
+            const KeyType *sample = StatKernels::radixSort(keys, keys + s, s);
+
+            for(size_t r = 0; r < nRanks; r++)
+            {
+                Target &t = targets[j * nRanks + r];
+                t.feature = j;
+                t.rank = ranks[r];
+                t.nBelow = 0;
+                t.nCandidates = n;
+                t.isReady = false;
+                t.isKnown = false;
+                t.value = 0;
+
+                const double center = (double)ranks[r] * (double)(s - 1) / (double)(n > 1 ? n - 1 : 1);
+                t.lo = (center - halfWidth <= 0.0         ? 0      : sample[(size_t)(center - halfWidth)]);
+                t.hi = (center + halfWidth >= (double)(s - 1) ? maxKey : sample[(size_t)(center + halfWidth) + 1]);
+                t.shift = getShift(t.lo, t.hi);
+            }
+        } );
+
+        bool isValid = true;
+        sampleBuffer.reduce( [&](KeyType *keys)
+        {
+            if(!keys) { isValid = false; }
+            daal::services::daal_free(keys);
+        } );
+        return isValid;
+    }
+
+    /* Counts the keys below the sample intervals and gathers the values of the intervals in one pass over the data.
+       The order statistics inside their intervals are selected, the intervals of the others are extended
+       to all the keys on the side of the order statistic */
+    static bool selectInSampleIntervals(const algorithmFPType *data, size_t p, size_t n, size_t nRanks, Target *targets)
+    {
+        const size_t nTargets = p * nRanks;
+        const size_t nCounts  = p * (nRanks + 1);
+
+        /* The bounds of the intervals of the feature j are lo[j * nRanks + r] and hi[j * nRanks + r],
+           both do not decrease in r as the ranks */
+        KeyType *lo = (KeyType *)daal::services::daal_malloc(2 * nTargets * sizeof(KeyType));
+        if(!lo) { return false; }
+        KeyType *hi = lo + nTargets;
+        for(size_t t = 0; t < nTargets; t++)
+        {
+            lo[t] = targets[t].lo;
+            hi[t] = targets[t].hi;
+        }
+
+        daal::tls<Candidates *> localCandidates( [=]()-> Candidates *
+        {
+            return createCandidates(nTargets, nCounts);
+        } );
+
+        bool isValid = true;
+        const size_t blockSize = daal::threader_get_block_size<algorithmFPType>(n, p);
+        daal::threader_for_row_blocks(n, blockSize, daal::autoPartitioner, [&](size_t iStartRow, size_t nRowsInBlock)
+        {
+            Candidates *local = localCandidates.local();
+            if(!local->isValid) { return; }
+
+            for(size_t i = iStartRow; i < iStartRow + nRowsInBlock; i++)
+            {
+                const algorithmFPType *row = data + i * p;
+                for(size_t j = 0; j < p; j++)
+                {
+                    const KeyType key = StatKernels::toKey(row[j]);
+                    const KeyType *featureLo = lo + j * nRanks;
+                    const KeyType *featureHi = hi + j * nRanks;
+
+                    /* The key is inside the intervals first, ..., last - 1 and below the intervals last, ..., nRanks - 1.
+                       The intervals are few, so they are counted without the branches */
+                    size_t first = 0, last = 0;
+                    for(size_t r = 0; r < nRanks; r++)
+                    {
+                        first += (featureHi[r] < key);
+                        last  += (featureLo[r] <= key);
+                    }
+                    for(size_t r = first; r < last; r++)
+                    {
+                        if(!append(local, j * nRanks + r, row[j])) { local->isValid = false; return; }
+                    }
+                    local->counts[j * (nRanks + 1) + last]++;
+                }
+            }
+        } );
+
+        /* The keys below the interval r of the feature j are counted in counts[j * (nRanks + 1) + r'] for r' <= r */
+        size_t *counts = daal::services::internal::service_calloc<size_t, cpu>(nCounts + 2 * nTargets + 1);
+        services::Collection<Candidates *> locals;
+        localCandidates.reduce( [&](Candidates *local)
+        {
+            locals.push_back(local);
+            if(!counts || !local->isValid) { isValid = false; return; }
+            for(size_t i = 0; i < nCounts; i++)
+            {
+                counts[i] += local->counts[i];
+            }
+        } );
+        if(!counts) { isValid = false; }
+
+        if(isValid)
+        {
+            size_t *nCandidates = counts + nCounts;
+            size_t *offsets = nCandidates + nTargets;
+            offsets[0] = 0;
+            for(size_t t = 0; t < nTargets; t++)
+            {
+                for(size_t l = 0; l < locals.size(); l++)
+                {
+                    nCandidates[t] += locals[l]->sizes[t];
+                }
+
+                Target &target = targets[t];
+                const size_t j = t / nRanks;
+                const size_t *featureCounts = counts + j * (nRanks + 1);
+                size_t nBelow = 0;
+                for(size_t r = 0; r <= t - j * nRanks; r++)
+                {
+                    nBelow += featureCounts[r];
+                }
+
+                target.nBelow = nBelow;
+                target.nCandidates = nCandidates[t];
+                target.isReady = (target.rank >= nBelow && target.rank < nBelow + nCandidates[t]);
+                if(!target.isReady)
+                {
+                    /* The sample missed the order statistic */
+                    if(target.rank < nBelow) { target.hi = target.lo - 1; target.lo = 0; }
+                    else                     { target.lo = target.hi + 1; target.hi = ~(KeyType)0; }
+                    target.shift = getShift(target.lo, target.hi);
+                }
+                offsets[t + 1] = offsets[t] + (target.isReady ? nCandidates[t] : 0);
+            }
+
+            algorithmFPType *candidates = (algorithmFPType *)daal::services::daal_malloc((offsets[nTargets] ? offsets[nTargets] : 1) *
+                                                                                          sizeof(algorithmFPType));
+            if(!candidates) { isValid = false; }
+
+            if(isValid)
+            {
+                daal::threader_for( (int)nTargets, (int)nTargets, [&](int iTarget)
+                {
+                    const size_t t = (size_t)iTarget;
+                    Target &target = targets[t];
+                    if(!target.isReady) { return; }
+
+                    algorithmFPType *x = candidates + offsets[t];
+                    size_t cursor = 0;
+                    for(size_t l = 0; l < locals.size(); l++)
+                    {
+                        copyCandidates(locals[l], t, x, target.nCandidates, cursor);
+                    }
+
+                    const size_t k = target.rank - target.nBelow;
+                    StatKernels::select(x, 0, target.nCandidates, k);
+                    target.value = x[k];
+                    target.isKnown = true;
+                } );
+            }
+            daal::services::daal_free(candidates);
+        }
+
+        for(size_t l = 0; l < locals.size(); l++)
+        {
+            releaseCandidates(locals[l], nTargets);
+        }
+        daal::services::daal_free(counts);
+        daal::services::daal_free(lo);
+        return isValid;
+    }
+
+    /* Counts the keys of the intervals of the active order statistics in one pass over the data
+       and narrows the intervals. isNarrowed is set to true if all the intervals are final */
+    static bool narrowIntervals(const algorithmFPType *data, size_t p, size_t n, Target *targets, size_t nTargets,
+                                size_t maxCandidates, bool &isNarrowed)
+    {
+        /* The active order statistics of the feature j are active[featureStart[j]], ..., active[featureStart[j + 1] - 1] */
+        size_t *active = (size_t *)daal::services::daal_malloc((nTargets + p + 1) * sizeof(size_t));
+        if(!active) { return false; }
+        size_t *featureStart = active + nTargets;
+
+        size_t nActive = 0;
+        for(size_t j = 0, i = 0; j < p; j++)
+        {
+            featureStart[j] = nActive;
+            for(; i < nTargets && targets[i].feature == j; i++)
+            {
+                if(!targets[i].isReady) { active[nActive++] = i; }
+            }
+        }
+        featureStart[p] = nActive;
+
+        isNarrowed = (nActive == 0);
+        if(isNarrowed) { daal::services::daal_free(active); return true; }
+
+        /* The counts of the active order statistic a are the number of the keys below the interval,
+           counts[a * (nBins + 1)], and the histogram of the interval */
+        const size_t nCounts = nActive * (nBins + 1);
+        size_t *counts = daal::services::internal::service_calloc<size_t, cpu>(nCounts);
+        if(!counts) { daal::services::daal_free(active); return false; }
+
+        daal::tls<size_t *> localCounts( [=]()-> size_t *
+        {
+            return daal::services::internal::service_calloc<size_t, cpu>(nCounts);
+        } );
+
+        bool isValid = true;
+        const size_t blockSize = daal::threader_get_block_size<algorithmFPType>(n, p);
+        daal::threader_for_row_blocks(n, blockSize, daal::autoPartitioner, [&](size_t iStartRow, size_t nRowsInBlock)
+        {
+            size_t *local = localCounts.local();
+            if(!local) { return; }
+
+            for(size_t i = iStartRow; i < iStartRow + nRowsInBlock; i++)
+            {
+                const algorithmFPType *row = data + i * p;
+                for(size_t j = 0; j < p; j++)
+                {
+                    if(featureStart[j] == featureStart[j + 1]) { continue; }
+
+                    const KeyType key = StatKernels::toKey(row[j]);
+                    for(size_t a = featureStart[j]; a < featureStart[j + 1]; a++)
+                    {
+                        const Target &t = targets[active[a]];
+                        size_t *c = local + a * (nBins + 1);
+                        if(key < t.lo)       { c[0]++; }
+                        else if(key <= t.hi) { c[1 + ((key - t.lo) >> t.shift)]++; }
+                    }
+                }
+            }
+        } );
+
+        localCounts.reduce( [&](size_t *local)
+        {
+            if(!local) { isValid = false; return; }
+            for(size_t i = 0; i < nCounts; i++)
+            {
+                counts[i] += local[i];
+            }
+            daal::services::daal_free(local);
+        } );
+
+        if(isValid)
+        {
+            const KeyType maxKey = ~(KeyType)0;
+            for(size_t a = 0; a < nActive; a++)
+            {
+                Target &t = targets[active[a]];
+                const size_t *c = counts + a * (nBins + 1);
+
+                size_t nInside = 0;
+                for(size_t b = 0; b < nBins; b++)
+                {
+                    nInside += c[1 + b];
+                }
+
+                if(t.rank < c[0])
+                {
+                    /* The sample missed the order statistic, it is below the interval */
+                    t.hi = t.lo - 1;
+                    t.lo = 0;
+                }
+                else if(t.rank >= c[0] + nInside)
+                {
+                    t.lo = t.hi + 1;
+                    t.hi = maxKey;
+                }
+                else
+                {
+                    size_t nBelow = c[0];
+                    size_t b = 0;
+                    for(; t.rank >= nBelow + c[1 + b]; b++)
+                    {
+                        nBelow += c[1 + b];
+                    }
+
+                    const KeyType binLo = t.lo + ((KeyType)b << t.shift);
+                    const KeyType binWidth = (t.shift < 8 * sizeof(KeyType) ? ((KeyType)1 << t.shift) - 1 : maxKey);
+                    t.hi = binLo + (t.hi - binLo < binWidth ? t.hi - binLo : binWidth);
+                    t.lo = binLo;
+                    t.nBelow = nBelow;
+                    t.nCandidates = c[1 + b];
+
+                    /* All the values of the interval of one key are equal */
+                    t.isKnown = (t.lo == t.hi);
+                    if(t.isKnown) { t.value = StatKernels::fromKey(t.lo); }
+                    t.isReady = (t.isKnown || t.nCandidates <= maxCandidates);
+                }
+                t.shift = getShift(t.lo, t.hi);
+            }
+        }
+
+        daal::services::daal_free(counts);
+        daal::services::daal_free(active);
+        return isValid;
+    }
+
+    /* Gathers the values of the final intervals in one pass over the data and selects the order statistics */
+    static bool selectCandidates(const algorithmFPType *data, size_t p, size_t n, Target *targets, size_t nTargets)
+    {
+        /* The gathered order statistics of the feature j are gathered[featureStart[j]], ..., gathered[featureStart[j + 1] - 1] */
+        size_t *gathered = (size_t *)daal::services::daal_malloc((2 * nTargets + p + 2) * sizeof(size_t));
+        if(!gathered) { return false; }
+        size_t *featureStart = gathered + nTargets;
+        size_t *offsets = featureStart + p + 1;
+
+        size_t nGathered = 0;
+        offsets[0] = 0;
+        for(size_t j = 0, i = 0; j < p; j++)
+        {
+            featureStart[j] = nGathered;
+            for(; i < nTargets && targets[i].feature == j; i++)
+            {
+                if(targets[i].isKnown) { continue; }
+                gathered[nGathered] = i;
+                offsets[nGathered + 1] = offsets[nGathered] + targets[i].nCandidates;
+                nGathered++;
+            }
+        }
+        featureStart[p] = nGathered;
+
+        if(nGathered == 0) { daal::services::daal_free(gathered); return true; }
+
+        algorithmFPType *candidates = (algorithmFPType *)daal::services::daal_malloc(offsets[nGathered] * sizeof(algorithmFPType));
+        size_t *cursors = daal::services::internal::service_calloc<size_t, cpu>(nGathered);
+        if(!candidates || !cursors)
+        {
+            daal::services::daal_free(candidates);
+            daal::services::daal_free(cursors);
+            daal::services::daal_free(gathered);
+            return false;
+        }
+
+        daal::tls<Candidates *> localCandidates( [=]()-> Candidates *
+        {
+            return createCandidates(nGathered, 0);
+        } );
+
+        bool isValid = true;
+        const size_t blockSize = daal::threader_get_block_size<algorithmFPType>(n, p);
+        daal::threader_for_row_blocks(n, blockSize, daal::autoPartitioner, [&](size_t iStartRow, size_t nRowsInBlock)
+        {
+            Candidates *local = localCandidates.local();
+            if(!local->isValid) { return; }
+
+            for(size_t i = iStartRow; i < iStartRow + nRowsInBlock; i++)
+            {
+                const algorithmFPType *row = data + i * p;
+                for(size_t j = 0; j < p; j++)
+                {
+                    if(featureStart[j] == featureStart[j + 1]) { continue; }
+
+                    const KeyType key = StatKernels::toKey(row[j]);
+                    for(size_t g = featureStart[j]; g < featureStart[j + 1]; g++)
+                    {
+                        const Target &t = targets[gathered[g]];
+                        if(key < t.lo || key > t.hi) { continue; }
+                        if(!append(local, g, row[j])) { local->isValid = false; return; }
+                    }
+                }
+            }
+        } );
+
+        localCandidates.reduce( [&](Candidates *local)
+        {
+            if(!local->isValid) { isValid = false; }
+            else
+            {
+                for(size_t g = 0; g < nGathered; g++)
+                {
+                    copyCandidates(local, g, candidates + offsets[g], offsets[g + 1] - offsets[g], cursors[g]);
+                }
+            }
+            releaseCandidates(local, nGathered);
+        } );
+
+        if(isValid)
+        {
+            daal::threader_for( (int)nGathered, (int)nGathered, [&](int g)
+            {
+                Target &t = targets[gathered[g]];
+                algorithmFPType *x = candidates + offsets[g];
+                const size_t k = t.rank - t.nBelow;
+                StatKernels::select(x, 0, t.nCandidates, k);
+                t.value = x[k];
+            } );
+        }
+
+        daal::services::daal_free(candidates);
+        daal::services::daal_free(cursors);
+        daal::services::daal_free(gathered);
+        return isValid;
+    }
+
+    /* Allocates the empty lists of the values of nLists intervals and nCounts counts */
+    static Candidates *createCandidates(size_t nLists, size_t nCounts)
+    {
+        Candidates *local = new Candidates;
+        local->values     = daal::services::internal::service_calloc<algorithmFPType *, cpu>(nLists);
+        local->sizes      = daal::services::internal::service_calloc<size_t, cpu>(nLists);
+        local->capacities = daal::services::internal::service_calloc<size_t, cpu>(nLists);
+        local->counts     = (nCounts ? daal::services::internal::service_calloc<size_t, cpu>(nCounts) : 0);
+        local->isValid = (local->values && local->sizes && local->capacities && (local->counts || !nCounts));
+        return local;
+    }
+
+    static void releaseCandidates(Candidates *local, size_t nLists)
+    {
+        for(size_t i = 0; local->values && i < nLists; i++)
+        {
+            daal::services::daal_free(local->values[i]);
+        }
+        daal::services::daal_free(local->values);
+        daal::services::daal_free(local->sizes);
+        daal::services::daal_free(local->capacities);
+        daal::services::daal_free(local->counts);
+        delete local;
+    }
+
+    static bool append(Candidates *local, size_t g, algorithmFPType value)
+    {
+        if(local->sizes[g] == local->capacities[g])
+        {
+            const size_t capacity = (local->capacities[g] ? 2 * local->capacities[g] : 16);
+            algorithmFPType *values = (algorithmFPType *)daal::services::daal_malloc(capacity * sizeof(algorithmFPType));
+            if(!values) { return false; }
+            for(size_t i = 0; i < local->sizes[g]; i++)
+            {
+                values[i] = local->values[g][i];
+            }
+            daal::services::daal_free(local->values[g]);
+            local->values[g] = values;
+            local->capacities[g] = capacity;
+        }
+        local->values[g][local->sizes[g]++] = value;
+        return true;
+    }
+
+    static void copyCandidates(const Candidates *local, size_t g, algorithmFPType *dst, size_t nCandidates, size_t &cursor)
+    {
+        for(size_t i = 0; i < local->sizes[g] && cursor < nCandidates; i++)
+        {
+            dst[cursor++] = local->values[g][i];
+        }
+    }
+};
+
+} // namespace daal::algorithms::quantiles::internal
+} // namespace daal::algorithms::quantiles
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,312 @@
+/* file: quantiles_sketch_aux.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Sketches of the features for the quantiles in the online and distributed processing modes.
+//
+//  The sketch of a feature is the merging t-digest of Dunning and Ertl: at most 2 * compression centroids
+//  (mean, weight) ordered by the means. The values and the centroids are added to the sketch by the merge
+//  of the sorted sequences followed by the compression that joins the neighbour centroids while the centroid
+//  spans at most one unit of the scale k(q) = compression / (2 pi) * asin(2 q - 1) of the rank q of the data.
+//  So the centroids are small at the tails and the sketches of the parts of the data are merged
+//  the same way as the values are added.
+//
+//  The quantile is interpolated linearly between the centers of the centroids, the minimum at the rank 0
+//  and the maximum at the rank n - 1.
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_AUX_I__
+#define __QUANTILES_SKETCH_AUX_I__
+
+#include <math.h>
+#include "service_memory.h"
+#include "service_stat.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+struct TDigest
+{
+    typedef daal::internal::vec::VecStatKernels<algorithmFPType, cpu> StatKernels;
+    typedef typename StatKernels::KeyType KeyType;
+
+    /* Returns the number of the centroids of the sketch, the unused centroids have zero weights */
+    static size_t getSize(const algorithmFPType *weights, size_t capacity)
+    {
+        size_t n = 0;
+        while(n < capacity && weights[n] > (algorithmFPType)0) { n++; }
+        return n;
+    }
+
+    /* Adds the sketch of n2 centroids ordered by the means with the minimum and the maximum to the sketch
+       of at most capacity centroids. If weights2 is NULL, the weights of the centroids are 1.
+       The buffers keep capacity + n2 centroids */
+    static void add(algorithmFPType *means1, algorithmFPType *weights1, algorithmFPType &minimum1, algorithmFPType &maximum1,
+                    const algorithmFPType *means2, const algorithmFPType *weights2, size_t n2,
+                    algorithmFPType minimum2, algorithmFPType maximum2,
+                    double compression, size_t capacity, algorithmFPType *bufferMeans, algorithmFPType *bufferWeights)
+    {
+        if(n2 == 0) { return; }
+
+        const size_t n1 = getSize(weights1, capacity);
+        minimum1 = (n1 == 0 || minimum2 < minimum1 ? minimum2 : minimum1);
+        maximum1 = (n1 == 0 || maximum2 > maximum1 ? maximum2 : maximum1);
+
+        size_t i1 = 0, i2 = 0, n = 0;
+        while(i1 < n1 || i2 < n2)
+        {
+            if(i2 == n2 || (i1 < n1 && means1[i1] <= means2[i2]))
+            {
+                bufferMeans[n] = means1[i1];
+                bufferWeights[n++] = weights1[i1++];
+            }
+            else
+            {
+                bufferMeans[n] = means2[i2];
+                bufferWeights[n++] = (weights2 ? weights2[i2] : (algorithmFPType)1);
+                i2++;
+            }
+        }
+
+        n = compress(bufferMeans, bufferWeights, n, compression, capacity);
+
+        for(size_t i = 0; i < n; i++)
+        {
+            means1[i] = bufferMeans[i];
+            weights1[i] = bufferWeights[i];
+        }
+        for(size_t i = n; i < n1; i++)
+        {
+            means1[i] = 0;
+            weights1[i] = 0;
+        }
+    }
+
+    /* Joins the neighbour centroids of the n centroids ordered by the means in place.
+       Returns the number of the centroids, at most capacity */
+    static size_t compress(algorithmFPType *means, algorithmFPType *weights, size_t n, double compression, size_t capacity)
+    {
+        if(n == 0) { return 0; }
+
+        double totalWeight = 0.0;
+        for(size_t i = 0; i < n; i++)
+        {
+            totalWeight += weights[i];
+        }
+
+        const double normalizer = compression / (2.0 * pi);
+        double weightSoFar = 0.0;
+        double weightLimit = totalWeight * getRank(getScale(0.0, normalizer) + 1.0, normalizer);
+
+        double mean = means[0], weight = weights[0];
+        size_t nOut = 0;
+        for(size_t i = 1; i < n; i++)
+        {
+            const double w = weights[i];
+            if(weightSoFar + weight + w <= weightLimit || nOut + 1 >= capacity)
+            {
+                weight += w;
+                mean += (means[i] - mean) * w / weight;
+            }
+            else
+            {
+                means[nOut] = (algorithmFPType)mean;
+                weights[nOut] = (algorithmFPType)weight;
+                nOut++;
+
+                weightSoFar += weight;
+                weightLimit = totalWeight * getRank(getScale(weightSoFar / totalWeight, normalizer) + 1.0, normalizer);
+                mean = means[i];
+                weight = w;
+            }
+        }
+        means[nOut] = (algorithmFPType)mean;
+        weights[nOut] = (algorithmFPType)weight;
+        return nOut + 1;
+    }
+
+    /* Returns the quantile of the order of the sketch of n centroids */
+    static algorithmFPType quantile(const algorithmFPType *means, const algorithmFPType *weights, size_t n,
+                                    algorithmFPType minimum, algorithmFPType maximum, double order)
+    {
+        if(n == 0) { return 0; }
+
+        double totalWeight = 0.0;
+        for(size_t i = 0; i < n; i++)
+        {
+            totalWeight += weights[i];
+        }
+
+        const double rank = order * (totalWeight - 1.0);
+        double previousRank = 0.0, previousValue = minimum;
+        double weightSoFar = 0.0;
+        for(size_t i = 0; i < n; i++)
+        {
+            const double centerRank = weightSoFar + 0.5 * ((double)weights[i] - 1.0);
+            if(rank <= centerRank) { return interpolate(previousRank, previousValue, centerRank, means[i], rank); }
+
+            previousRank = centerRank;
+            previousValue = means[i];
+            weightSoFar += weights[i];
+        }
+        return interpolate(previousRank, previousValue, totalWeight - 1.0, maximum, rank);
+    }
+
+protected:
+    static const double pi;
+
+    /* Scale function k(q) */
+    static double getScale(double q, double normalizer)
+    {
+        double x = 2.0 * q - 1.0;
+        x = (x < -1.0 ? -1.0 : (x > 1.0 ? 1.0 : x));
+        return normalizer * asin(x);
+    }
+
+    /* Inverse of the scale function */
+    static double getRank(double k, double normalizer)
+    {
+        const double x = k / normalizer;
+        if(x >= 0.5 * pi) { return 1.0; }
+        return 0.5 * (sin(x) + 1.0);
+    }
+
+    static algorithmFPType interpolate(double x0, double y0, double x1, double y1, double x)
+    {
+        if(x1 <= x0) { return (algorithmFPType)y1; }
+        return (algorithmFPType)(y0 + (y1 - y0) * (x - x0) / (x1 - x0));
+    }
+};
+
+template<typename algorithmFPType, CpuType cpu>
+const double TDigest<algorithmFPType, cpu>::pi = 3.14159265358979323846;
+
+/* Sketches of the p features accumulated by the blocks of rows of the data */
+template<typename algorithmFPType, CpuType cpu>
+class Sketches
+{
+public:
+    typedef TDigest<algorithmFPType, cpu> Digest;
+    typedef typename Digest::KeyType KeyType;
+
+    Sketches(size_t p, size_t capacity, size_t blockSize, double compression) :
+        _p(p), _capacity(capacity), _blockSize(blockSize), _compression(compression)
+    {
+        const size_t bufferSize = capacity + (blockSize > capacity ? blockSize : capacity);
+        means         = daal::services::internal::service_calloc<algorithmFPType, cpu>(p * capacity);
+        weights       = daal::services::internal::service_calloc<algorithmFPType, cpu>(p * capacity);
+        minimum       = daal::services::internal::service_calloc<algorithmFPType, cpu>(p);
+        maximum       = daal::services::internal::service_calloc<algorithmFPType, cpu>(p);
+        _values       = (algorithmFPType *)daal::services::daal_malloc(blockSize * sizeof(algorithmFPType));
+        _keys         = (KeyType *)daal::services::daal_malloc(2 * blockSize * sizeof(KeyType));
+        _bufferMeans   = (algorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(algorithmFPType));
+        _bufferWeights = (algorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(algorithmFPType));
+        isValid = (means && weights && minimum && maximum && _values && _keys && _bufferMeans && _bufferWeights);
+    }
+
+    ~Sketches()
+    {
+        daal::services::daal_free(means);
+        daal::services::daal_free(weights);
+        daal::services::daal_free(minimum);
+        daal::services::daal_free(maximum);
+        daal::services::daal_free(_values);
+        daal::services::daal_free(_keys);
+        daal::services::daal_free(_bufferMeans);
+        daal::services::daal_free(_bufferWeights);
+    }
+
+    /* Adds the nRows rows of the data starting from iStartRow, nRows is at most blockSize */
+    void addBlock(const algorithmFPType *data, size_t iStartRow, size_t nRows)
+    {
+        const algorithmFPType *block = data + iStartRow * _p;
+        for(size_t j = 0; j < _p; j++)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                _keys[i] = Digest::StatKernels::toKey(block[i * _p + j]);
+            }
+            const KeyType *sorted = Digest::StatKernels::radixSort(_keys, _keys + _blockSize, nRows);
+            for(size_t i = 0; i < nRows; i++)
+            {
+                _values[i] = Digest::StatKernels::fromKey(sorted[i]);
+            }
+
+            Digest::add(means + j * _capacity, weights + j * _capacity, minimum[j], maximum[j],
+                        _values, 0, nRows, _values[0], _values[nRows - 1], _compression, _capacity, _bufferMeans, _bufferWeights);
+        }
+    }
+
+    /* Adds the sketches of other to these sketches */
+    void merge(const Sketches &other)
+    {
+        for(size_t j = 0; j < _p; j++)
+        {
+            other.addTo(j, means + j * _capacity, weights + j * _capacity, minimum[j], maximum[j], _bufferMeans, _bufferWeights);
+        }
+    }
+
+    /* Adds the sketch of the feature j to the sketch of the same capacity. The buffers keep 2 * capacity centroids */
+    void addTo(size_t j, algorithmFPType *dstMeans, algorithmFPType *dstWeights, algorithmFPType &dstMinimum, algorithmFPType &dstMaximum,
+               algorithmFPType *bufferMeans, algorithmFPType *bufferWeights) const
+    {
+        const algorithmFPType *srcWeights = weights + j * _capacity;
+        Digest::add(dstMeans, dstWeights, dstMinimum, dstMaximum, means + j * _capacity, srcWeights, Digest::getSize(srcWeights, _capacity),
+                    minimum[j], maximum[j], _compression, _capacity, bufferMeans, bufferWeights);
+    }
+
+    /* Adds the sketches of the p features to the sketches in the arrays of the same layout */
+    void addTo(algorithmFPType *dstMeans, algorithmFPType *dstWeights, algorithmFPType *dstMinimum, algorithmFPType *dstMaximum)
+    {
+        for(size_t j = 0; j < _p; j++)
+        {
+            addTo(j, dstMeans + j * _capacity, dstWeights + j * _capacity, dstMinimum[j], dstMaximum[j], _bufferMeans, _bufferWeights);
+        }
+    }
+
+    algorithmFPType *means;     /* Means of the centroids, _capacity per feature */
+    algorithmFPType *weights;   /* Weights of the centroids, _capacity per feature */
+    algorithmFPType *minimum;
+    algorithmFPType *maximum;
+    bool isValid;
+
+protected:
+    size_t _p;
+    size_t _capacity;
+    size_t _blockSize;
+    double _compression;
+    algorithmFPType *_values;
+    KeyType *_keys;
+    algorithmFPType *_bufferMeans;
+    algorithmFPType *_bufferWeights;
+};
+
+} // namespace daal::algorithms::quantiles::internal
+} // namespace daal::algorithms::quantiles
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
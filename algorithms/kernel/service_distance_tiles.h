@@ -0,0 +1,151 @@
+/* file: service_distance_tiles.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Tiles of dot products of feature vectors used in the computation of distances.
+//--
+*/
+
+#ifndef __SERVICE_DISTANCE_TILES_H__
+#define __SERVICE_DISTANCE_TILES_H__
+
+#include "service_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+
+const size_t tileFeatureBlockSize = 256;   /* Number of features of the rows of a tile kept in the cache */
+
+/**
+ *  \brief Computes the tile of dot products res[ii * nj + jj] = <xi[ii], xj[jj]>
+ *         of the ni x p and nj x p blocks of feature vectors stored by rows.
+ *         The tile is computed in the calling thread, because it is called from the parallel loops
+ *         of the algorithms. The features are processed by blocks of tileFeatureBlockSize, so the parts
+ *         of the rows used by the block stay in the cache
+ *
+ *  \param xi[in]   First block of feature vectors
+ *  \param ni[in]   Number of feature vectors in the first block
+ *  \param xj[in]   Second block of feature vectors
+ *  \param nj[in]   Number of feature vectors in the second block
+ *  \param p[in]    Number of features
+ *  \param res[out] Tile of ni x nj dot products
+ */
+template<typename algorithmFPType, CpuType cpu>
+void computeDotProductsTile(const algorithmFPType *xi, size_t ni, const algorithmFPType *xj, size_t nj, size_t p,
+                            algorithmFPType *res)
+{
+    for (size_t k = 0; k < ni * nj; k++)
+    {
+        res[k] = (algorithmFPType)0.0;
+    }
+
+    for (size_t k0 = 0; k0 < p; k0 += tileFeatureBlockSize)
+    {
+        const size_t k1 = (k0 + tileFeatureBlockSize < p ? k0 + tileFeatureBlockSize : p);
+        for (size_t ii = 0; ii < ni; ii++)
+        {
+            const algorithmFPType *xii = xi + ii * p;
+            algorithmFPType *resii = res + ii * nj;
+
+            /* Four rows of xj share the loads of the row of xi */
+            size_t jj = 0;
+            for (; jj + 4 <= nj; jj += 4)
+            {
+                const algorithmFPType *xj0 = xj + jj * p;
+                const algorithmFPType *xj1 = xj0 + p;
+                const algorithmFPType *xj2 = xj1 + p;
+                const algorithmFPType *xj3 = xj2 + p;
+                algorithmFPType sum0 = (algorithmFPType)0.0;
+                algorithmFPType sum1 = (algorithmFPType)0.0;
+                algorithmFPType sum2 = (algorithmFPType)0.0;
+                algorithmFPType sum3 = (algorithmFPType)0.0;
+                for (size_t k = k0; k < k1; k++)
+                {
+                    sum0 += xii[k] * xj0[k];
+                    sum1 += xii[k] * xj1[k];
+                    sum2 += xii[k] * xj2[k];
+                    sum3 += xii[k] * xj3[k];
+                }
+                resii[jj]     += sum0;
+                resii[jj + 1] += sum1;
+                resii[jj + 2] += sum2;
+                resii[jj + 3] += sum3;
+            }
+            for (; jj < nj; jj++)
+            {
+                const algorithmFPType *xjj = xj + jj * p;
+                algorithmFPType sum = (algorithmFPType)0.0;
+                for (size_t k = k0; k < k1; k++)
+                {
+                    sum += xii[k] * xjj[k];
+                }
+                resii[jj] += sum;
+            }
+        }
+    }
+}
+
+/**
+ *  \brief Computes the tile of dot products res[ii * nj + jj] = <x[i0 + ii], x[j0 + jj]> of the feature vectors
+ *         stored in the CSR layout with one-based indices. On the diagonal tile only jj < ii are computed.
+ *         The row x[i0 + ii] is scattered into the dense vector xi of p zeros that is cleared after use,
+ *         so the cost of the tile is proportional to the number of non-zero values in its rows
+ */
+template<typename algorithmFPType, CpuType cpu>
+void computeSparseDotProductsTile(const algorithmFPType *values, const size_t *colIndices, const size_t *rowOffsets,
+                                  size_t i0, size_t ni, size_t j0, size_t nj, algorithmFPType *xi, algorithmFPType *res)
+{
+    const bool isDiagonal = (i0 == j0);
+    for (size_t ii = 0; ii < ni; ii++)
+    {
+        const size_t iBegin = rowOffsets[i0 + ii] - 1;
+        const size_t iEnd   = rowOffsets[i0 + ii + 1] - 1;
+        for (size_t k = iBegin; k < iEnd; k++)
+        {
+            xi[colIndices[k] - 1] += values[k];
+        }
+
+        size_t njInRow = (isDiagonal ? ii : nj);
+        for (size_t jj = 0; jj < njInRow; jj++)
+        {
+            const size_t jBegin = rowOffsets[j0 + jj] - 1;
+            const size_t jEnd   = rowOffsets[j0 + jj + 1] - 1;
+            algorithmFPType sum = (algorithmFPType)0.0;
+            for (size_t k = jBegin; k < jEnd; k++)
+            {
+                sum += values[k] * xi[colIndices[k] - 1];
+            }
+            res[ii * nj + jj] = sum;
+        }
+
+        for (size_t k = iBegin; k < iEnd; k++)
+        {
+            xi[colIndices[k] - 1] = (algorithmFPType)0.0;
+        }
+    }
+}
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -29,6 +29,7 @@
 #include "service_utils.h"
 #include "service_data_utils.h"
 #include "service_memory.h"
+#include "service_sort.h"
 #include "stump_train_kernel.h"
 
 namespace daal
@@ -42,117 +43,95 @@ namespace training
 namespace internal
 {
 
+template <Method method, typename algorithmFPtype, CpuType cpu>
+StumpTrainKernel<method, algorithmFPtype, cpu>::~StumpTrainKernel()
+{
+    daal::services::daal_free(_presortedIndex);
+}
+
 /**
- *  \brief Quick sort function that sorts array x and rearranges arrays w,z
- *         accordingly
+ *  \brief Prepares the indices of observations sorted by the values of the features
+ *         of the training data set. The indices are reused if the same data set was
+ *         used in the previous call of the kernel
  *
- *  \param n[in] Length of input arrays
- *  \param x     Array that is used as "key" when sorted
- *  \param w     Array that is used as "value" when sorted
- *  \param z     Array that is used as "value" when sorted
+ *  \param x[in]           Input data set
+ *  \param nVectors[in]    Number of observations
+ *  \param nFeatures[in]   Number of features
+ *  \return false if the indices could not be allocated
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
-void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w,
-                                                                 algorithmFPtype *z )
+bool StumpTrainKernel<method, algorithmFPtype, cpu>::getPresortedIndex(const NumericTable *x, size_t nVectors,
+                                                                       size_t nFeatures)
 {
-    int i, ir, j, k, jstack = -1, l = 0;
-    algorithmFPtype a, b, c, tmp;
-    const int M = 7, NSTACK = 128;
-    algorithmFPtype istack[NSTACK];
+    if (_presortedIndex && x == _presortedTable && nVectors == _presortedNVectors && nFeatures == _presortedNFeatures)
+    {
+        return true;
+    }
+
+    daal::services::daal_free(_presortedIndex);
+    _presortedIndex = NULL;
+    _presortedTable = NULL;
 
-    ir = n - 1;
+    if (nVectors > (size_t)daal::data_feature_utils::internal::MaxVal<int, cpu>::get()) { return false; }
 
-    for(;;)
+    _presortedIndex = (int *) daal::services::daal_malloc(nVectors * nFeatures * sizeof(int));
+    if (!_presortedIndex) { return false; }
+
+    /* Identity permutation is replaced by the sorted one on the first use of the feature */
+    for (size_t k = 0; k < nFeatures; k++)
     {
-        if(ir - l < M)
+        int *index = _presortedIndex + k * nVectors;
+        for (size_t i = 0; i < nVectors; i++)
         {
-            for(j = l + 1; j <= ir; j++)
-            {
-                a = x[j];
-                b = w[j];
-                c = z[j];
+            index[i] = (int)i;
+        }
+    }
 
-                for(i = j - 1; i >= l; i--)
-                {
-                    if(x[i] <= a) { break; }
-                    x[i + 1] = x[i];
-                    w[i + 1] = w[i];
-                    z[i + 1] = z[i];
-                }
+    _presortedTable     = x;
+    _presortedNVectors  = nVectors;
+    _presortedNFeatures = nFeatures;
+    return true;
+}
 
-                x[i + 1] = a;
-                w[i + 1] = b;
-                z[i + 1] = c;
-            }
+/**
+ *  \brief Sorts indices of observations by the values of the feature
+ *
+ *  \param nVectors[in]  Number of observations
+ *  \param x[in]         Input data feature of size nVectors
+ *  \param index[out]    Indices of observations in the order of ascending values of x
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::presortFeature(size_t nVectors, const algorithmFPtype *x, int *index)
+{
+    algorithmFPtype *xx = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
+    if (!xx) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-            if(jstack < 0) { break; }
+    daal::services::daal_memcpy_s(xx, nVectors * sizeof(algorithmFPtype), x, nVectors * sizeof(algorithmFPtype));
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        index[i] = (int)i;
+    }
 
-            ir = istack[jstack--];
-            l = istack[jstack--];
-        }
-        else
-        {
-            k = (l + ir) >> 1;
-            daal::swap<algorithmFPtype, cpu>(x[k], x[l + 1]);
-            daal::swap<algorithmFPtype, cpu>(w[k], w[l + 1]);
-            daal::swap<algorithmFPtype, cpu>(z[k], z[l + 1]);
-            if(x[l] > x[ir])
-            {
-                daal::swap<algorithmFPtype, cpu>(x[l], x[ir]);
-                daal::swap<algorithmFPtype, cpu>(w[l], w[ir]);
-                daal::swap<algorithmFPtype, cpu>(z[l], z[ir]);
-            }
-            if(x[l + 1] > x[ir])
-            {
-                daal::swap<algorithmFPtype, cpu>(x[l + 1], x[ir]);
-                daal::swap<algorithmFPtype, cpu>(w[l + 1], w[ir]);
-                daal::swap<algorithmFPtype, cpu>(z[l + 1], z[ir]);
-            }
-            if(x[l] > x[l + 1])
-            {
-                daal::swap<algorithmFPtype, cpu>(x[l], x[l + 1]);
-                daal::swap<algorithmFPtype, cpu>(w[l], w[l + 1]);
-                daal::swap<algorithmFPtype, cpu>(z[l], z[l + 1]);
-            }
-            i = l + 1;
-            j = ir;
-            a = x[l + 1];
-            b = w[l + 1];
-            c = z[l + 1];
-            for(;;)
-            {
-                while(x[++i] < a);
-                while(x[--j] > a);
-                if(j < i) { break; }
-                daal::swap<algorithmFPtype, cpu>(x[i], x[j]);
-                daal::swap<algorithmFPtype, cpu>(w[i], w[j]);
-                daal::swap<algorithmFPtype, cpu>(z[i], z[j]);
-            }
-            x[l + 1] = x[j];
-            w[l + 1] = w[j];
-            z[l + 1] = z[j];
+    daal::algorithms::internal::qSort<algorithmFPtype, int, cpu>(nVectors, xx, index);
 
-            x[j] = a;
-            w[j] = b;
-            z[j] = c;
-            jstack += 2;
+    daal::services::daal_free(xx);
+}
 
-            if(ir - i + 1 >= j - l)
-            {
-                istack[jstack  ] = ir ;
-                istack[jstack - 1] = i  ;
-                ir = j - 1;
-            }
-            else
-            {
-                istack[jstack  ] = j - 1;
-                istack[jstack - 1] = l  ;
-                l = i;
-            }
-        }
+/**
+ *  \brief Checks that the indices order observations by ascending values of the feature
+ *
+ *  \param nVectors[in]  Number of observations
+ *  \param x[in]         Input data feature of size nVectors
+ *  \param index[in]     Indices of observations
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+bool StumpTrainKernel<method, algorithmFPtype, cpu>::isPresorted(size_t nVectors, const algorithmFPtype *x, const int *index)
+{
+    for (size_t k = 1; k < nVectors; k++)
+    {
+        if (x[index[k]] < x[index[k - 1]]) { return false; }
     }
-
-    return;
+    return true;
 }
 
 /**
@@ -181,7 +160,48 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size
                                                                             algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
                                                                             algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr)
 {
+    /* Allocate memory for storing intermediate data */
+    int *index = (int *) daal::services::daal_malloc(nVectors * sizeof(int));
+    if (!index)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    presortFeature(nVectors, x, index);
+    stumpRegressionPresorted(nVectors, x, index, w, z, sumW, sumM, sumS, minSPtr, splitPointPtr, lMeanPtr, rMeanPtr);
 
+    daal::services::daal_free(index);
+    return;
+}
+
+/**
+ *  \brief Fit the function f[j] by a weighted least-squares
+ *  regression of x to z with weigths w.
+ *  Process ordered or numerical feature which observations are already sorted
+ *
+ *  \param n[in]        Number of observations
+ *  \param x[in]        Input data feature of size n
+ *  \param index[in]    Indices of observations in the order of ascending values of x
+ *  \param w[in]        Array of weights of size n
+ *  \param z[in]        Array of weights of responses of size n
+ *  \param sumW[in]     Total sum of weights
+ *  \param sumM[in]     Total sum of weighted responses
+ *  \param sumS[in]     Total sum of weighted squares of responses
+ *  \param minSPtr[out]       Value of goal function obtained for the best split
+ *  \param splitPointPtr[out] Resulting split point
+ *  \param lMeanPtr[out]      "left" average of weighted responses
+ *                            for resulting split
+ *  \param rMeanPtr[out]      "right" average of weighted responses
+ *                            for resulting split
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionPresorted(size_t nVectors,
+                                                                              const algorithmFPtype *x, const int *index,
+                                                                              const algorithmFPtype *w, const algorithmFPtype *z,
+                                                                              algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+                                                                              algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
+                                                                              algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr)
+{
     const algorithmFPtype THR = 1e-10;
     const algorithmFPtype C05 = (algorithmFPtype)0.5;
     algorithmFPtype minS = *minSPtr;
@@ -199,23 +219,6 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size
     algorithmFPtype lc, rc;  /* goal functions of the left and right regions
                       (see (9.13) in [2]) */
 
-    algorithmFPtype *xx, *ww, *zz;
-
-    /* Allocate memory for storing intermediate data */
-    xx = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
-    ww = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
-    zz = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
-    if (!xx || !ww || !zz)
-    {
-        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
-    }
-
-    daal::services::daal_memcpy_s(ww, nVectors * sizeof(algorithmFPtype), w, nVectors * sizeof(algorithmFPtype));
-    daal::services::daal_memcpy_s(zz, nVectors * sizeof(algorithmFPtype), z, nVectors * sizeof(algorithmFPtype));
-    daal::services::daal_memcpy_s(xx, nVectors * sizeof(algorithmFPtype), x, nVectors * sizeof(algorithmFPtype));
-
-    StumpQSort(nVectors, xx, ww, zz);
-
     lw = 0.0;
     lM = 0.0;
     ls = 0.0;
@@ -228,20 +231,23 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size
     {
         /* Move points one-by-one from the right regoin into the left
            and choose the optimal split */
-        algorithmFPtype wz = ww[k] * zz[k];
-        algorithmFPtype wzz = wz * zz[k];
+        const int i = index[k];
+        const algorithmFPtype xCur  = x[i];
+        const algorithmFPtype xNext = x[index[k + 1]];
+        algorithmFPtype wz = w[i] * z[i];
+        algorithmFPtype wzz = wz * z[i];
 
-        lw += ww[k];
+        lw += w[i];
         lM += wz;
         ls += wzz;
-        rw -= ww[k];
+        rw -= w[i];
         rM -= wz;
         rs -= wzz;
 
-        if (xx[k] == xx[k + 1]) { continue; }
+        if (xCur == xNext) { continue; }
 
         /* Current split point */
-        curT = C05 * (xx[k] + xx[k + 1]);
+        curT = C05 * (xCur + xNext);
 
         /* Calculate weight; weighted mean and weighted sum of squares
            over points left to curT */
@@ -292,9 +298,6 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size
     *lMeanPtr = lMean;
     *rMeanPtr = rMean;
 
-    daal::services::daal_free(xx);
-    daal::services::daal_free(ww);
-    daal::services::daal_free(zz);
     return;
 }
 
@@ -489,6 +492,8 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n,
     algorithmFPtype sumW, sumM, sumS;
     computeSums(n, w, z, &sumW, &sumM, &sumS);
 
+    int *presortedIndex = (getPresortedIndex(x, n, dim) ? _presortedIndex : NULL);
+
     struct group_res
     {
         size_t groupSplitFeature;
@@ -531,8 +536,22 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n,
             BlockDescriptor<algorithmFPtype> block;
             x->getBlockOfColumnValues( k, (size_t)0, n, readOnly, block);
             x_data = block.getBlockPtr();
-            stumpRegressionOrdered(n, x_data, w, z, sumW, sumM, sumS,
-                                   &localMinS, &localSplitPoint, &localLMean, &localRMean);
+            if (presortedIndex)
+            {
+                /* Sort the feature again only if its values changed since the previous call */
+                int *index = presortedIndex + k * n;
+                if (!isPresorted(n, x_data, index))
+                {
+                    presortFeature(n, x_data, index);
+                }
+                stumpRegressionPresorted(n, x_data, index, w, z, sumW, sumM, sumS,
+                                         &localMinS, &localSplitPoint, &localLMean, &localRMean);
+            }
+            else
+            {
+                stumpRegressionOrdered(n, x_data, w, z, sumW, sumM, sumS,
+                                       &localMinS, &localSplitPoint, &localLMean, &localRMean);
+            }
             x->releaseBlockOfColumnValues( block );
         }
 
@@ -46,10 +46,18 @@ template <Method method, typename algorithmFPtype , CpuType cpu>
 class StumpTrainKernel : public Kernel
 {
 public:
+    StumpTrainKernel() : _presortedTable(NULL), _presortedNVectors(0), _presortedNFeatures(0), _presortedIndex(NULL) {}
+
+    ~StumpTrainKernel();
+
     void compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
 
 private:
-    void StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z );
+    bool getPresortedIndex(const NumericTable *x, size_t nVectors, size_t nFeatures);
+
+    void presortFeature(size_t nVectors, const algorithmFPtype *x, int *index);
+
+    bool isPresorted(size_t nVectors, const algorithmFPtype *x, const int *index);
 
     void stumpRegressionOrdered(size_t nVectors,
                                 algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z,
@@ -57,6 +65,12 @@ private:
                                 algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
                                 algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr);
 
+    void stumpRegressionPresorted(size_t nVectors,
+                                  const algorithmFPtype *x, const int *index, const algorithmFPtype *w, const algorithmFPtype *z,
+                                  algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+                                  algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
+                                  algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr);
+
     void stumpRegressionCategorical(size_t n, size_t nCategories,
                                     int *x, algorithmFPtype *w, algorithmFPtype *z,
                                     algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
@@ -70,6 +84,14 @@ private:
                            algorithmFPtype *z,
                            size_t *splitFeature, algorithmFPtype *splitPoint,
                            algorithmFPtype *leftValue, algorithmFPtype *rightValue);
+
+    /* Indices of observations sorted by the values of the ordered features of the training data set.
+       Boosting algorithms train the stump on the same data set with new weights many times, so the
+       indices are kept between the calls of compute() and are sorted again only if the data changes */
+    const NumericTable *_presortedTable;
+    size_t _presortedNVectors;
+    size_t _presortedNFeatures;
+    int *_presortedIndex;
 };
 
 } // namespace daal::algorithms::stump::training::internal
@@ -0,0 +1,87 @@
+/* file: thread_arena.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class that limits and places the threads used by the algorithms.
+//--
+*/
+
+#include "daal_thread_arena.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace services
+{
+
+ThreadArena::ThreadArena(size_t maxThreads)
+{
+    _arena = _daal_threader_arena_create((int)maxThreads, NULL, 0);
+}
+
+ThreadArena::ThreadArena(size_t maxThreads, const Collection<size_t> &cpus)
+{
+    _arena = _daal_threader_arena_create((int)maxThreads, (cpus.size() ? &cpus[0] : NULL), cpus.size());
+}
+
+ThreadArena::~ThreadArena()
+{
+    _daal_threader_arena_delete(_arena);
+}
+
+size_t ThreadArena::getMaxThreads() const
+{
+    return (size_t)_daal_threader_arena_get_max_threads(_arena);
+}
+
+void ThreadArena::setFirstTouch(bool firstTouch)
+{
+    _daal_threader_arena_set_first_touch(_arena, (int)firstTouch);
+}
+
+bool ThreadArena::getFirstTouch() const
+{
+    return (_daal_threader_arena_get_first_touch(_arena) != 0);
+}
+
+void ThreadArena::execute(ThreadArenaTask &task)
+{
+    daal::threader_arena_execute(_arena, [&]()
+    {
+        task.run();
+    } );
+}
+
+size_t ThreadArena::getNumberOfNumaNodes()
+{
+    return _daal_numa_get_number_of_nodes();
+}
+
+Collection<size_t> ThreadArena::getNumaNodeCpus(size_t node)
+{
+    size_t nCpus = _daal_numa_get_node_cpus(node, NULL, 0);
+    Collection<size_t> cpus(nCpus);
+    if(nCpus > 0)
+    {
+        _daal_numa_get_node_cpus(node, &cpus[0], nCpus);
+    }
+    return cpus;
+}
+
+} // namespace services
+} // namespace daal
@@ -25,8 +25,17 @@
 #include "env_detect.h"
 
 #if defined(__DO_TBB_LAYER__)
+    #define TBB_PREVIEW_LOCAL_OBSERVER 1
     #include <tbb/tbb.h>
     #include <tbb/spin_mutex.h>
+    #include <tbb/task_arena.h>
+    #include <tbb/task_scheduler_observer.h>
+#endif
+
+#if defined(__linux__)
+    #include <sched.h>
+    #include <stdio.h>
+    #include <unistd.h>
 #endif
 
 DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
@@ -79,6 +88,102 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
   #endif
 }
 
+#if defined(__DO_TBB_LAYER__)
+static int getCurrentMaxThreads();
+
+template<typename Body>
+static void _daal_parallel_for(int n, int grainSize, int partitioner, const Body &body)
+{
+    if(grainSize < 1) { grainSize = 1; }
+
+    if(partitioner == daal::staticPartitioner)
+    {
+        /* TBB 4.3 has no static_partitioner: the simple partitioner with the grain size of n/nThreads
+           splits the range into the parts of equal size, one or two parts per thread */
+        int nThreads = getCurrentMaxThreads();
+        int partSize = (n + nThreads - 1) / nThreads;
+        if(partSize > grainSize) { grainSize = partSize; }
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, grainSize), body, tbb::simple_partitioner());
+    }
+    else if(partitioner == daal::affinityPartitioner)
+    {
+        tbb::affinity_partitioner ap;
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, grainSize), body, ap);
+    }
+    else
+    {
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, grainSize), body, tbb::auto_partitioner());
+    }
+}
+#endif
+
+DAAL_EXPORT void _daal_threader_for_ex(int n, int grainSize, int partitioner, const void* a, daal::functype func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    _daal_parallel_for(n, grainSize, partitioner, [&](const tbb::blocked_range<int> &r)
+    {
+        int i;
+        for( i = r.begin(); i < r.end(); i++ )
+        {
+            func(i, a);
+        }
+    } );
+  #elif defined(__DO_SEQ_LAYER__)
+    int i;
+    for( i = 0; i < n; i++ )
+    {
+        func(i, a);
+    }
+  #endif
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_ex(int n, int grainSize, int partitioner, const void* a, daal::functype2 func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    _daal_parallel_for(n, grainSize, partitioner, [&](const tbb::blocked_range<int> &r)
+    {
+        func(r.begin(), r.end()-r.begin(), a);
+    } );
+  #elif defined(__DO_SEQ_LAYER__)
+    func(0, n, a);
+  #endif
+}
+
+/* Size of the cache of the processor core used when the operating system does not report it */
+static const size_t defaultCacheSize = 256 * 1024;
+
+/* Nonzero if the results of the parallel reductions do not depend on the number of the threads */
+static int reproducibleReductions = 0;
+
+DAAL_EXPORT void _daal_threader_set_reproducible(int reproducible)
+{
+    reproducibleReductions = (reproducible != 0);
+}
+
+DAAL_EXPORT int _daal_threader_get_reproducible()
+{
+    return reproducibleReductions;
+}
+
+DAAL_EXPORT size_t _daal_threader_get_cache_size()
+{
+    /* The blocks of the loops are the same on any processor in the reproducible mode */
+    if(reproducibleReductions) { return defaultCacheSize; }
+
+    static size_t cacheSize = 0;
+    if(cacheSize == 0)
+    {
+        size_t size = 0;
+  #if defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+        long l2Size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        if(l2Size > 0) { size = (size_t)l2Size; }
+  #endif
+        /* The half of the cache is left for the outputs and the buffers of the task */
+        cacheSize = (size ? size / 2 : defaultCacheSize);
+    }
+    return cacheSize;
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
   #if defined(__DO_TBB_LAYER__)
@@ -134,3 +239,248 @@ DAAL_EXPORT void _daal_reduce_tls(void* tlsPtr, void* a, daal::tls_reduce_functy
     func( tlsPtr, a );
   #endif
 }
+
+#if defined(__DO_TBB_LAYER__)
+namespace
+{
+
+struct ThreaderArena;
+
+#if defined(__linux__)
+/* Bound arena the current thread works in, NULL outside of the bound arenas */
+static __thread ThreaderArena *currentBoundArena = NULL;
+
+/* Binds the threads that join the arena to the processors of the arena and restores
+   the previous binding of the threads when they leave the arena */
+class ThreaderArenaObserver : public tbb::task_scheduler_observer
+{
+public:
+    ThreaderArenaObserver(tbb::task_arena &arena, ThreaderArena *owner, const cpu_set_t &cpus) :
+        tbb::task_scheduler_observer(arena), _owner(owner), _cpus(cpus)
+    {
+        observe(true);
+    }
+
+    ~ThreaderArenaObserver()
+    {
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool isWorker)
+    {
+        SavedState &saved = _saved.local();
+        saved.arena = currentBoundArena;
+        currentBoundArena = _owner;
+        bind(saved.cpus);
+    }
+
+    void on_scheduler_exit(bool isWorker)
+    {
+        SavedState &saved = _saved.local();
+        sched_setaffinity(0, sizeof(cpu_set_t), &(saved.cpus));
+        currentBoundArena = saved.arena;
+    }
+
+    void bind(cpu_set_t &savedCpus) const
+    {
+        sched_getaffinity(0, sizeof(cpu_set_t), &savedCpus);
+        sched_setaffinity(0, sizeof(cpu_set_t), &_cpus);
+    }
+
+private:
+    struct SavedState
+    {
+        cpu_set_t cpus;
+        ThreaderArena *arena;
+    };
+
+    ThreaderArena *_owner;
+    cpu_set_t _cpus;
+    tbb::enumerable_thread_specific<SavedState> _saved;
+};
+#endif
+
+struct ThreaderArena
+{
+    ThreaderArena(int maxThreads, const size_t *cpus, size_t nCpus) :
+        maxThreads(maxThreads), firstTouch(false), arena(maxThreads), observer(NULL)
+    {
+        arena.initialize();
+  #if defined(__linux__)
+        if(nCpus == 0) { return; }
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for(size_t i = 0; i < nCpus; i++)
+        {
+            if(cpus[i] < CPU_SETSIZE) { CPU_SET(cpus[i], &cpuSet); }
+        }
+        observer = new ThreaderArenaObserver(arena, this, cpuSet);
+  #endif
+    }
+
+    ~ThreaderArena()
+    {
+  #if defined(__linux__)
+        delete observer;
+  #endif
+    }
+
+    int maxThreads;
+    bool firstTouch;    /* The memory of the tables allocated in the arena is written first by its threads */
+    tbb::task_arena arena;
+  #if defined(__linux__)
+    ThreaderArenaObserver *observer;
+  #else
+    void *observer;
+  #endif
+};
+
+}
+
+/* Returns the number of the threads of the bound arena the current thread works in,
+   the number of the threads of the library otherwise */
+static int getCurrentMaxThreads()
+{
+  #if defined(__linux__)
+    if(currentBoundArena) { return currentBoundArena->maxThreads; }
+  #endif
+    return _daal_threader_get_max_threads();
+}
+#endif
+
+DAAL_EXPORT void *_daal_threader_arena_create(int maxThreads, const size_t *cpus, size_t nCpus)
+{
+  #if defined(__DO_TBB_LAYER__)
+    if(maxThreads <= 0)
+    {
+        maxThreads = (nCpus > 0 ? (int)nCpus : tbb::task_scheduler_init::default_num_threads());
+    }
+    return (void *)(new ThreaderArena(maxThreads, cpus, nCpus));
+  #elif defined(__DO_SEQ_LAYER__)
+    return NULL;
+  #endif
+}
+
+DAAL_EXPORT void _daal_threader_arena_execute(void *arena, const void *a, daal::arena_functype func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    if(!arena)
+    {
+        func(a);
+        return;
+    }
+    ThreaderArena *p = static_cast<ThreaderArena *>(arena);
+  #if defined(__linux__)
+    /* The calling thread may run the functor itself, so it is bound to the processors of the arena too */
+    cpu_set_t savedCpus;
+    ThreaderArena *savedArena = currentBoundArena;
+    if(p->observer)
+    {
+        p->observer->bind(savedCpus);
+        currentBoundArena = p;
+    }
+  #endif
+    p->arena.execute( [&]()
+    {
+        func(a);
+    } );
+  #if defined(__linux__)
+    if(p->observer)
+    {
+        sched_setaffinity(0, sizeof(cpu_set_t), &savedCpus);
+        currentBoundArena = savedArena;
+    }
+  #endif
+  #elif defined(__DO_SEQ_LAYER__)
+    func(a);
+  #endif
+}
+
+DAAL_EXPORT int _daal_threader_arena_get_max_threads(void *arena)
+{
+  #if defined(__DO_TBB_LAYER__)
+    return (arena ? static_cast<ThreaderArena *>(arena)->maxThreads : _daal_threader_get_max_threads());
+  #elif defined(__DO_SEQ_LAYER__)
+    return 1;
+  #endif
+}
+
+DAAL_EXPORT void _daal_threader_arena_delete(void *arena)
+{
+  #if defined(__DO_TBB_LAYER__)
+    delete static_cast<ThreaderArena *>(arena);
+  #endif
+}
+
+DAAL_EXPORT void _daal_threader_arena_set_first_touch(void *arena, int firstTouch)
+{
+  #if defined(__DO_TBB_LAYER__)
+    if(arena) { static_cast<ThreaderArena *>(arena)->firstTouch = (firstTouch != 0); }
+  #endif
+}
+
+DAAL_EXPORT int _daal_threader_arena_get_first_touch(void *arena)
+{
+  #if defined(__DO_TBB_LAYER__)
+    return (arena && static_cast<ThreaderArena *>(arena)->firstTouch ? 1 : 0);
+  #elif defined(__DO_SEQ_LAYER__)
+    return 0;
+  #endif
+}
+
+DAAL_EXPORT int _daal_threader_get_first_touch_threads()
+{
+  #if defined(__DO_TBB_LAYER__) && defined(__linux__)
+    ThreaderArena *p = currentBoundArena;
+    return (p && p->firstTouch ? p->maxThreads : 0);
+  #else
+    return 0;
+  #endif
+}
+
+DAAL_EXPORT size_t _daal_numa_get_number_of_nodes()
+{
+    size_t nNodes = 0;
+  #if defined(__linux__)
+    char fileName[64];
+    for(;; nNodes++)
+    {
+        snprintf(fileName, sizeof(fileName), "/sys/devices/system/node/node%lu/cpulist", (unsigned long)nNodes);
+        FILE *f = fopen(fileName, "r");
+        if(!f) { break; }
+        fclose(f);
+    }
+  #endif
+    return (nNodes > 0 ? nNodes : 1);
+}
+
+DAAL_EXPORT size_t _daal_numa_get_node_cpus(size_t node, size_t *cpus, size_t maxCpus)
+{
+    size_t nCpus = 0;
+  #if defined(__linux__)
+    char fileName[64];
+    snprintf(fileName, sizeof(fileName), "/sys/devices/system/node/node%lu/cpulist", (unsigned long)node);
+    FILE *f = fopen(fileName, "r");
+    if(!f) { return 0; }
+
+    /* The list of the processors has the format like 0-7,16-23 */
+    unsigned long first, last;
+    while(fscanf(f, "%lu", &first) == 1)
+    {
+        last = first;
+        int c = fgetc(f);
+        if(c == '-')
+        {
+            if(fscanf(f, "%lu", &last) != 1) { break; }
+            c = fgetc(f);
+        }
+        for(unsigned long cpu = first; cpu <= last; cpu++, nCpus++)
+        {
+            if(nCpus < maxCpus) { cpus[nCpus] = cpu; }
+        }
+        if(c != ',') { break; }
+    }
+    fclose(f);
+  #endif
+    return nCpus;
+}
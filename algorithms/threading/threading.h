@@ -33,6 +33,15 @@ typedef void (*functype)(int i, const void *a);
 typedef void (*functype2)(int i, int n, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
+typedef void (*arena_functype)(const void *a);
+
+/* Policy of the distribution of the iterations of the parallel loops among the threads */
+enum ThreaderPartitioner
+{
+    autoPartitioner     = 0,    /* Splits the iterations adaptively, not into the parts less than the grain size */
+    staticPartitioner   = 1,    /* Splits the iterations into the equal parts, about one part per thread */
+    affinityPartitioner = 2     /* Splits the iterations adaptively, preferring the threads that ran the neighbouring parts */
+};
 
 }
 
@@ -41,12 +50,28 @@ extern "C" {
     DAAL_EXPORT int   _daal_threader_get_max_threads();
     DAAL_EXPORT void  _daal_threader_for(int n, int threads_request, const void *a, daal::functype func);
     DAAL_EXPORT void  _daal_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
+    DAAL_EXPORT void  _daal_threader_for_ex(int n, int grainSize, int partitioner, const void *a, daal::functype func);
+    DAAL_EXPORT void  _daal_threader_for_blocked_ex(int n, int grainSize, int partitioner, const void *a, daal::functype2 func);
+    DAAL_EXPORT size_t _daal_threader_get_cache_size();
+    DAAL_EXPORT void  _daal_threader_set_reproducible(int reproducible);
+    DAAL_EXPORT int   _daal_threader_get_reproducible();
     DAAL_EXPORT void *_daal_get_tls_ptr( void *a, daal::tls_functype func );
     DAAL_EXPORT void *_daal_get_tls_local( void *tlsPtr );
     DAAL_EXPORT void  _daal_reduce_tls( void *tlsPtr, void *a, daal::tls_reduce_functype func );
     DAAL_EXPORT void  _daal_del_tls_ptr( void *tlsPtr );
 
     DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void **init);
+
+    DAAL_EXPORT void *_daal_threader_arena_create(int maxThreads, const size_t *cpus, size_t nCpus);
+    DAAL_EXPORT void  _daal_threader_arena_execute(void *arena, const void *a, daal::arena_functype func);
+    DAAL_EXPORT int   _daal_threader_arena_get_max_threads(void *arena);
+    DAAL_EXPORT void  _daal_threader_arena_delete(void *arena);
+    DAAL_EXPORT void  _daal_threader_arena_set_first_touch(void *arena, int firstTouch);
+    DAAL_EXPORT int   _daal_threader_arena_get_first_touch(void *arena);
+    DAAL_EXPORT int   _daal_threader_get_first_touch_threads();
+
+    DAAL_EXPORT size_t _daal_numa_get_number_of_nodes();
+    DAAL_EXPORT size_t _daal_numa_get_node_cpus(size_t node, size_t *cpus, size_t maxCpus);
 }
 
 namespace daal
@@ -92,6 +117,84 @@ inline void threader_for_blocked(int n, int threads_request, const F &lambda)
     _daal_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
 }
 
+/* Runs lambda(i) for i in [0, n). The iterations are split into the parts of at least grainSize
+   iterations (but one) and the parts are distributed among the threads according to partitioner */
+template<typename F>
+inline void threader_for(int n, int grainSize, ThreaderPartitioner partitioner, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_ex(n, grainSize, (int)partitioner, a, threader_func<F>);
+}
+
+/* Runs lambda(i0, in) for the parts [i0, i0 + in) of [0, n) split as in threader_for() */
+template<typename F>
+inline void threader_for_blocked(int n, int grainSize, ThreaderPartitioner partitioner, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_ex(n, grainSize, (int)partitioner, a, threader_func_b<F>);
+}
+
+/* Number of the blocks per thread left by threader_get_block_size() for the load balance */
+const size_t threaderBlocksPerThread = 4;
+
+/* Returns the number of the rows in a block of the data processed by one task. The block of nCols values
+   of type FPType per row fits into the cache of the processor core. If nBlocksPerThread is not 0, the block
+   is also small enough to give every thread nBlocksPerThread blocks of the nRows rows */
+template<typename FPType>
+inline size_t threader_get_block_size(size_t nRows, size_t nCols, size_t nBlocksPerThread = threaderBlocksPerThread,
+                                      size_t minBlockSize = 16, size_t maxBlockSize = 4096)
+{
+    const size_t rowSize = (nCols ? nCols : 1) * sizeof(FPType);
+    size_t blockSize = _daal_threader_get_cache_size() / rowSize;
+
+    /* In the reproducible mode the blocks do not depend on the number of the threads */
+    if(nBlocksPerThread && !_daal_threader_get_reproducible())
+    {
+        const size_t nParts = (size_t)threader_get_threads_number() * nBlocksPerThread;
+        const size_t balancedBlockSize = (nRows + nParts - 1) / nParts;
+        if(blockSize > balancedBlockSize) { blockSize = balancedBlockSize; }
+    }
+
+    if(blockSize < minBlockSize) { blockSize = minBlockSize; }
+    if(blockSize > maxBlockSize) { blockSize = maxBlockSize; }
+    if(blockSize > nRows && nRows) { blockSize = nRows; }
+    return blockSize;
+}
+
+/* Runs lambda(iStartRow, nRowsInBlock) for the blocks of blockSize rows of the nRows rows.
+   The blocks are distributed among the threads according to partitioner */
+template<typename F>
+inline void threader_for_row_blocks(size_t nRows, size_t blockSize, ThreaderPartitioner partitioner, const F &lambda)
+{
+    const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+
+    threader_for((int)nBlocks, 1, partitioner, [&](int iBlock)
+    {
+        const size_t iStartRow = (size_t)iBlock * blockSize;
+        const size_t nRowsInBlock = (iStartRow + blockSize > nRows ? nRows - iStartRow : blockSize);
+        lambda(iStartRow, nRowsInBlock);
+    } );
+}
+
+template<typename F>
+inline void threader_arena_func(const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
+/* Runs the functor in the arena created by _daal_threader_arena_create(). Parallel loops started by
+   the functor use the threads of the arena only. The calling thread runs the functor if arena is NULL */
+template<typename F>
+inline void threader_arena_execute(void *arena, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_arena_execute(arena, a, threader_arena_func<F>);
+}
+
 template<typename lambdaType>
 inline void *tls_func(const void *a)
 {
@@ -172,6 +275,163 @@ private:
     tls_deleter *d;
 };
 
+/* Number of the partial results of the loops of partial_tls in the reproducible mode */
+const size_t reproduciblePartialsNumber = 128;
+
+/* Partial results of type F (a pointer) accumulated by the blocks of the parallel loops and merged into one.
+   By default every thread accumulates the blocks it runs into its own partial result, so the floating-point
+   result of the merge depends on the number of the threads and on the scheduling.
+   In the reproducible mode, set by _daal_threader_set_reproducible() before the object is created,
+   the contiguous ranges of the blocks are accumulated into up to reproduciblePartialsNumber partial results
+   in the order of the blocks and the partial results are merged by the pairwise tree of the fixed shape */
+template<typename F>
+class partial_tls : public tlsBase
+{
+public:
+    template<typename lambdaType>
+    explicit partial_tls(const lambdaType &lambda) : _tls(0), _partials(0), _nPartials(0), _merged(0)
+    {
+        lambdaType *locall = new lambdaType(lambda);
+        d = new tls_deleter_<lambdaType>();
+        voidLambda = static_cast<void *>(locall);
+        createFunc = tls_func<lambdaType>;
+
+        if(_daal_threader_get_reproducible())
+        {
+            _partials = new F[reproduciblePartialsNumber];
+            for(size_t i = 0; i < reproduciblePartialsNumber; i++)
+            {
+                _partials[i] = 0;
+            }
+        }
+        else
+        {
+            _tls = new tls<F>(lambda);
+        }
+    }
+
+    ~partial_tls()
+    {
+        delete _tls;
+        delete[] _partials;
+        d->del(voidLambda);
+        delete d;
+    }
+
+    /* Runs lambda(iBlock, local) for iBlock in [0, nBlocks), local is the partial result of the block */
+    template<typename lambdaType>
+    void for_blocks(size_t nBlocks, const lambdaType &lambda)
+    {
+        if(!_partials)
+        {
+            threader_for((int)nBlocks, (int)nBlocks, [&](int iBlock)
+            {
+                lambda(iBlock, _tls->local());
+            } );
+            return;
+        }
+
+        const size_t nPartials = (nBlocks < reproduciblePartialsNumber ? nBlocks : reproduciblePartialsNumber);
+        if(_nPartials < nPartials) { _nPartials = nPartials; }
+
+        threader_for((int)nPartials, (int)nPartials, [&](int iPartial)
+        {
+            if(!_partials[iPartial])
+            {
+                _partials[iPartial] = static_cast<F>(createFunc(voidLambda));
+            }
+            F local = _partials[iPartial];
+
+            const size_t iFirstBlock = nBlocks * iPartial / nPartials;
+            const size_t iLastBlock  = nBlocks * (iPartial + 1) / nPartials;
+            for(size_t iBlock = iFirstBlock; iBlock < iLastBlock; iBlock++)
+            {
+                lambda((int)iBlock, local);
+            }
+        } );
+    }
+
+    /* Runs lambda(iStartRow, nRowsInBlock, local) for the blocks of blockSize rows of the nRows rows */
+    template<typename lambdaType>
+    void for_row_blocks(size_t nRows, size_t blockSize, const lambdaType &lambda)
+    {
+        const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+
+        for_blocks(nBlocks, [&](int iBlock, F local)
+        {
+            const size_t iStartRow = (size_t)iBlock * blockSize;
+            const size_t nRowsInBlock = (iStartRow + blockSize > nRows ? nRows - iStartRow : blockSize);
+            lambda(iStartRow, nRowsInBlock, local);
+        } );
+    }
+
+    /* Merges the partial results into one of them by combine(dst, src) and returns it, 0 if there are no partial results.
+       The merge is done once, the following calls return the same partial result */
+    template<typename combineType>
+    F merge(const combineType &combine)
+    {
+        if(_merged) { return _merged; }
+
+        if(!_partials)
+        {
+            F merged = 0;
+            _tls->reduce( [&](F v)
+            {
+                if(!v) { return; }
+                if(!merged) { merged = v; }
+                else        { combine(merged, v); }
+            } );
+            _merged = merged;
+            return _merged;
+        }
+
+        for(size_t stride = 1; stride < _nPartials; stride *= 2)
+        {
+            const size_t nPairs = (_nPartials + 2 * stride - 1) / (2 * stride);
+            threader_for((int)nPairs, (int)nPairs, [&](int iPair)
+            {
+                const size_t iDst = 2 * stride * iPair;
+                const size_t iSrc = iDst + stride;
+                if(iSrc >= _nPartials || !_partials[iSrc]) { return; }
+                if(!_partials[iDst])
+                {
+                    _partials[iDst] = _partials[iSrc];
+                    _partials[iSrc] = 0;
+                    return;
+                }
+                combine(_partials[iDst], _partials[iSrc]);
+            } );
+        }
+        _merged = _partials[0];
+        return _merged;
+    }
+
+    /* Runs lambda(local) for all partial results, used to release them */
+    template<typename lambdaType>
+    void reduce(const lambdaType &lambda)
+    {
+        if(!_partials)
+        {
+            _tls->reduce(lambda);
+            return;
+        }
+        for(size_t i = 0; i < reproduciblePartialsNumber; i++)
+        {
+            if(_partials[i]) { lambda(_partials[i]); }
+        }
+    }
+
+private:
+    tls<F> *_tls;
+    F *_partials;
+    size_t _nPartials;
+    F _merged;
+
+    void *voidLambda;
+    tls_functype createFunc;
+    tls_deleter *d;
+};
+
 }
 
 #endif
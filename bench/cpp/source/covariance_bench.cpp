@@ -0,0 +1,160 @@
+/* file: covariance_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the computation of the variance-covariance matrix in the batch,
+!    online and distributed processing modes on a synthetic data set
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-COVARIANCE_BENCH"></a>
+ * \example covariance_bench.cpp
+ */
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+template <typename FPType, covariance::Method method>
+class CovarianceBatchBench : public BenchCase
+{
+public:
+    CovarianceBatchBench(const BenchOptions &opt, services::SharedPtr<NumericTable> data) :
+        BenchCase(getBenchCaseName(opt, "covariance", "batch", data->getNumberOfRows()), data->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _data(data) {}
+
+    void run()
+    {
+        covariance::Batch<FPType, method> algorithm;
+        algorithm.input.set(covariance::data, _data);
+        algorithm.compute();
+    }
+
+private:
+    services::SharedPtr<NumericTable> _data;
+};
+
+template <typename FPType, covariance::Method method>
+class CovarianceOnlineBench : public BenchCase
+{
+public:
+    CovarianceOnlineBench(const BenchOptions &opt, const vector<services::SharedPtr<NumericTable> > &blocks, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "covariance", "online", nRows), nRows, getBenchDataSize<FPType>(opt, nRows)),
+        _blocks(blocks) {}
+
+    void run()
+    {
+        covariance::Online<FPType, method> algorithm;
+        for (size_t i = 0; i < _blocks.size(); i++)
+        {
+            algorithm.input.set(covariance::data, _blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+private:
+    const vector<services::SharedPtr<NumericTable> > &_blocks;
+};
+
+template <typename FPType, covariance::Method method>
+class CovarianceDistributedBench : public BenchCase
+{
+public:
+    CovarianceDistributedBench(const BenchOptions &opt, const vector<services::SharedPtr<NumericTable> > &blocks, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "covariance", "distributed", nRows), nRows, getBenchDataSize<FPType>(opt, nRows)),
+        _blocks(blocks) {}
+
+    void run()
+    {
+        covariance::Distributed<step2Master, FPType, method> masterAlgorithm;
+        for (size_t i = 0; i < _blocks.size(); i++)
+        {
+            covariance::Distributed<step1Local, FPType, method> localAlgorithm;
+            localAlgorithm.input.set(covariance::data, _blocks[i]);
+            localAlgorithm.compute();
+
+            masterAlgorithm.input.add(covariance::partialResults, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+    }
+
+private:
+    const vector<services::SharedPtr<NumericTable> > &_blocks;
+};
+
+template <typename FPType, covariance::Method method>
+void runCovarianceBench(const BenchOptions &opt, BenchReport &report)
+{
+    BenchDataGenerator generator(opt);
+
+    if (isBenchModeEnabled(opt, "batch"))
+    {
+        CovarianceBatchBench<FPType, method> bench(opt, generator.generateData<FPType>(opt.nRows));
+        report.measure(bench);
+    }
+
+    if (!isBenchModeEnabled(opt, "online") && !isBenchModeEnabled(opt, "distributed")) { return; }
+
+    vector<services::SharedPtr<NumericTable> > blocks = generator.generateDataBlocks<FPType>(opt.nRows, opt.nBlocks);
+    const size_t nRows = opt.nRows / opt.nBlocks * opt.nBlocks;
+
+    if (isBenchModeEnabled(opt, "online"))
+    {
+        CovarianceOnlineBench<FPType, method> bench(opt, blocks, nRows);
+        report.measure(bench);
+    }
+
+    if (isBenchModeEnabled(opt, "distributed"))
+    {
+        CovarianceDistributedBench<FPType, method> bench(opt, blocks, nRows);
+        report.measure(bench);
+    }
+}
+
+template <typename FPType>
+void runCovarianceBench(const BenchOptions &opt, BenchReport &report)
+{
+    if (opt.sparsity > 0.0)
+    {
+        runCovarianceBench<FPType, covariance::fastCSR>(opt, report);
+    }
+    else
+    {
+        runCovarianceBench<FPType, covariance::defaultDense>(opt, report);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    opt.nRows = 1000000;
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runCovarianceBench<float>(opt, report); }
+    else                      { runCovarianceBench<double>(opt, report); }
+
+    return report.finish();
+}
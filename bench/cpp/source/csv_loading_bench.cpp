@@ -0,0 +1,150 @@
+/* file: csv_loading_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the loading of a synthetic data set from a .csv file in the batch
+!    and online processing modes and of the conversion of the loaded numeric table
+!    to the floating-point type of the benchmark
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-CSV_LOADING_BENCH"></a>
+ * \example csv_loading_bench.cpp
+ */
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+
+const string csvFileName = "csv_loading_bench.csv";
+
+/* Loads the whole file into one numeric table */
+class CSVLoadingBatchBench : public BenchCase
+{
+public:
+    CSVLoadingBatchBench(const BenchOptions &opt, size_t nBytes) :
+        BenchCase(getBenchCaseName(opt, "csv_loading", "batch", opt.nRows), opt.nRows, nBytes) {}
+
+    void run()
+    {
+        FileDataSource<CSVFeatureManager> dataSource(csvFileName, DataSource::doAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+        dataSource.loadDataBlock();
+        _table = dataSource.getNumericTable();
+    }
+
+    services::SharedPtr<NumericTable> getNumericTable() const { return _table; }
+
+private:
+    services::SharedPtr<NumericTable> _table;
+};
+
+/* Loads the file by blocks of observations */
+class CSVLoadingOnlineBench : public BenchCase
+{
+public:
+    CSVLoadingOnlineBench(const BenchOptions &opt, size_t nBytes) :
+        BenchCase(getBenchCaseName(opt, "csv_loading", "online", opt.nRows), opt.nRows, nBytes),
+        _nRowsInBlock((opt.nRows + opt.nBlocks - 1) / opt.nBlocks) {}
+
+    void run()
+    {
+        FileDataSource<CSVFeatureManager> dataSource(csvFileName, DataSource::doAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+        while (dataSource.loadDataBlock(_nRowsInBlock) == _nRowsInBlock) {}
+    }
+
+private:
+    size_t _nRowsInBlock;
+};
+
+/* Reads all observations of the loaded numeric table in the floating-point type of the benchmark */
+template <typename FPType>
+class CSVConversionBench : public BenchCase
+{
+public:
+    CSVConversionBench(const BenchOptions &opt, services::SharedPtr<NumericTable> table) :
+        BenchCase(getBenchCaseName(opt, "csv_conversion", "batch", table->getNumberOfRows()), table->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, table->getNumberOfRows())),
+        _table(table) {}
+
+    void run()
+    {
+        BlockDescriptor<FPType> block;
+        _table->getBlockOfRows(0, _table->getNumberOfRows(), readOnly, block);
+        _table->releaseBlockOfRows(block);
+    }
+
+private:
+    services::SharedPtr<NumericTable> _table;
+};
+
+template <typename FPType>
+void runCSVLoadingBench(const BenchOptions &opt, BenchReport &report, size_t nBytes)
+{
+    if (isBenchModeEnabled(opt, "batch"))
+    {
+        CSVLoadingBatchBench loadingBench(opt, nBytes);
+        report.measure(loadingBench);
+
+        if (loadingBench.getNumericTable().get())
+        {
+            CSVConversionBench<FPType> conversionBench(opt, loadingBench.getNumericTable());
+            report.measure(conversionBench);
+        }
+    }
+
+    if (isBenchModeEnabled(opt, "online"))
+    {
+        CSVLoadingOnlineBench loadingBench(opt, nBytes);
+        report.measure(loadingBench);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    opt.nRepeats = 5;
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+    if (opt.sparsity > 0.0)
+    {
+        printf("The loading of dense data sets only is measured\n");
+        return 1;
+    }
+
+    /* The file is generated once and is removed after the measurements */
+    BenchDataGenerator generator(opt);
+    if (!generator.writeCSV(csvFileName, opt.nRows))
+    {
+        printf("Failed to write the data set to %s\n", csvFileName.c_str());
+        return 1;
+    }
+    ifstream file(csvFileName.c_str(), ios::binary | ios::ate);
+    size_t nBytes = (size_t)file.tellg();
+    file.close();
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runCSVLoadingBench<float>(opt, report, nBytes); }
+    else                      { runCSVLoadingBench<double>(opt, report, nBytes); }
+
+    remove(csvFileName.c_str());
+    return report.finish();
+}
@@ -0,0 +1,124 @@
+/* file: fullyconnected_layer_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the forward and backward fully-connected neural network layers
+!    in the batch processing mode on a synthetic data set. The number of the layer outputs
+!    is set with the --classes option
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-FULLYCONNECTED_LAYER_BENCH"></a>
+ * \example fullyconnected_layer_bench.cpp
+ */
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks::layers;
+
+template <typename FPType>
+class FullyConnectedForwardBench : public BenchCase
+{
+public:
+    FullyConnectedForwardBench(const BenchOptions &opt, services::SharedPtr<Tensor> data) :
+        BenchCase(getBenchCaseName(opt, "fullyconnected_layer_forward", "batch", data->getDimensionSize(0)),
+                  data->getDimensionSize(0), getBenchDataSize<FPType>(opt, data->getDimensionSize(0))),
+        _opt(opt), _data(data) {}
+
+    void run()
+    {
+        fullyconnected::forward::Batch<FPType> algorithm(_opt.nClasses);
+        algorithm.input.set(forward::data, _data);
+        algorithm.compute();
+        _result = algorithm.getResult();
+    }
+
+    services::SharedPtr<fullyconnected::forward::Result> getResult() const { return _result; }
+
+private:
+    const BenchOptions &_opt;
+    services::SharedPtr<Tensor> _data;
+    services::SharedPtr<fullyconnected::forward::Result> _result;
+};
+
+template <typename FPType>
+class FullyConnectedBackwardBench : public BenchCase
+{
+public:
+    FullyConnectedBackwardBench(const BenchOptions &opt, services::SharedPtr<fullyconnected::forward::Result> forwardResult, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "fullyconnected_layer_backward", "batch", nRows), nRows, getBenchDataSize<FPType>(opt, nRows)),
+        _opt(opt), _forwardResult(forwardResult)
+    {
+        const services::Collection<size_t> &dims = forwardResult->get(forward::value)->getDimensions();
+        _inputGradient = services::SharedPtr<Tensor>(new HomogenTensor<FPType>(dims, Tensor::doAllocate, (FPType)0.01));
+    }
+
+    void run()
+    {
+        fullyconnected::backward::Batch<FPType> algorithm(_opt.nClasses);
+        algorithm.input.set(backward::inputGradient,    _inputGradient);
+        algorithm.input.set(backward::inputFromForward, _forwardResult->get(forward::resultForBackward));
+        algorithm.compute();
+    }
+
+private:
+    const BenchOptions &_opt;
+    services::SharedPtr<fullyconnected::forward::Result> _forwardResult;
+    services::SharedPtr<Tensor> _inputGradient;
+};
+
+template <typename FPType>
+void runFullyConnectedBench(const BenchOptions &opt, BenchReport &report)
+{
+    /* The layers are available in the batch processing mode only */
+    if (!isBenchModeEnabled(opt, "batch")) { return; }
+
+    BenchDataGenerator generator(opt);
+    FullyConnectedForwardBench<FPType> forwardBench(opt, generator.generateTensor<FPType>(opt.nRows));
+    report.measure(forwardBench);
+
+    /* The backward layer uses the result of the last run of the forward layer */
+    if (forwardBench.getResult().get())
+    {
+        FullyConnectedBackwardBench<FPType> backwardBench(opt, forwardBench.getResult(), opt.nRows);
+        report.measure(backwardBench);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    opt.nClasses = 100;
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+    if (opt.sparsity > 0.0)
+    {
+        printf("The layers support dense data only\n");
+        return 1;
+    }
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runFullyConnectedBench<float>(opt, report); }
+    else                      { runFullyConnectedBench<double>(opt, report); }
+
+    return report.finish();
+}
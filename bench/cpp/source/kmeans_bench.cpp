@@ -0,0 +1,156 @@
+/* file: kmeans_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the K-Means clustering in the batch and distributed processing modes
+!    on a synthetic data set. The initialization of the centroids is not measured
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-KMEANS_BENCH"></a>
+ * \example kmeans_bench.cpp
+ */
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+template <typename FPType, kmeans::Method method, kmeans::init::Method initMethod>
+class KMeansBatchBench : public BenchCase
+{
+public:
+    KMeansBatchBench(const BenchOptions &opt, services::SharedPtr<NumericTable> data) :
+        BenchCase(getBenchCaseName(opt, "kmeans", "batch", data->getNumberOfRows()), data->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, data->getNumberOfRows()) * opt.nIterations),
+        _opt(opt), _data(data) {}
+
+    void setUp()
+    {
+        if (_centroids.get()) { return; }
+        kmeans::init::Batch<FPType, initMethod> init(_opt.nClasses);
+        init.input.set(kmeans::init::data, _data);
+        init.compute();
+        _centroids = init.getResult()->get(kmeans::init::centroids);
+    }
+
+    void run()
+    {
+        kmeans::Batch<FPType, method> algorithm(_opt.nClasses, _opt.nIterations);
+        algorithm.input.set(kmeans::data,           _data);
+        algorithm.input.set(kmeans::inputCentroids, _centroids);
+        algorithm.compute();
+    }
+
+private:
+    const BenchOptions &_opt;
+    services::SharedPtr<NumericTable> _data;
+    services::SharedPtr<NumericTable> _centroids;
+};
+
+template <typename FPType, kmeans::Method method, kmeans::init::Method initMethod>
+class KMeansDistributedBench : public BenchCase
+{
+public:
+    KMeansDistributedBench(const BenchOptions &opt, const vector<services::SharedPtr<NumericTable> > &blocks, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "kmeans", "distributed", nRows), nRows, getBenchDataSize<FPType>(opt, nRows) * opt.nIterations),
+        _opt(opt), _blocks(blocks) {}
+
+    void setUp()
+    {
+        if (_centroids.get()) { return; }
+        kmeans::init::Batch<FPType, initMethod> init(_opt.nClasses);
+        init.input.set(kmeans::init::data, _blocks[0]);
+        init.compute();
+        _centroids = init.getResult()->get(kmeans::init::centroids);
+    }
+
+    void run()
+    {
+        services::SharedPtr<NumericTable> centroids = _centroids;
+        for (size_t it = 0; it < _opt.nIterations; it++)
+        {
+            kmeans::Distributed<step2Master, FPType, method> masterAlgorithm(_opt.nClasses);
+            for (size_t i = 0; i < _blocks.size(); i++)
+            {
+                kmeans::Distributed<step1Local, FPType, method> localAlgorithm(_opt.nClasses, false);
+                localAlgorithm.input.set(kmeans::data,           _blocks[i]);
+                localAlgorithm.input.set(kmeans::inputCentroids, centroids);
+                localAlgorithm.compute();
+
+                masterAlgorithm.input.add(kmeans::partialResults, localAlgorithm.getPartialResult());
+            }
+            masterAlgorithm.compute();
+            masterAlgorithm.finalizeCompute();
+            centroids = masterAlgorithm.getResult()->get(kmeans::centroids);
+        }
+    }
+
+private:
+    const BenchOptions &_opt;
+    const vector<services::SharedPtr<NumericTable> > &_blocks;
+    services::SharedPtr<NumericTable> _centroids;
+};
+
+template <typename FPType, kmeans::Method method, kmeans::init::Method initMethod>
+void runKMeansBench(const BenchOptions &opt, BenchReport &report)
+{
+    BenchDataGenerator generator(opt);
+
+    if (isBenchModeEnabled(opt, "batch"))
+    {
+        KMeansBatchBench<FPType, method, initMethod> bench(opt, generator.generateData<FPType>(opt.nRows));
+        report.measure(bench);
+    }
+
+    if (isBenchModeEnabled(opt, "distributed"))
+    {
+        vector<services::SharedPtr<NumericTable> > blocks = generator.generateDataBlocks<FPType>(opt.nRows, opt.nBlocks);
+        KMeansDistributedBench<FPType, method, initMethod> bench(opt, blocks, opt.nRows / opt.nBlocks * opt.nBlocks);
+        report.measure(bench);
+    }
+}
+
+template <typename FPType>
+void runKMeansBench(const BenchOptions &opt, BenchReport &report)
+{
+    if (opt.sparsity > 0.0)
+    {
+        runKMeansBench<FPType, kmeans::lloydCSR, kmeans::init::randomCSR>(opt, report);
+    }
+    else
+    {
+        runKMeansBench<FPType, kmeans::lloydDense, kmeans::init::randomDense>(opt, report);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    opt.nClasses = 20;
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runKMeansBench<float>(opt, report); }
+    else                      { runKMeansBench<double>(opt, report); }
+
+    return report.finish();
+}
@@ -0,0 +1,624 @@
+/* file: math_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the logistic, hyperbolic tangent, smooth rectifier and softmax
+!    functions that use the vector math functions of the library (exp, tanh, log1p).
+!    The throughput is compared with the same functions computed by the C library
+!    and the accuracy is checked against the long double C library functions.
+!    If the benchmark is built with the sources of the library, the vector math functions
+!    vExp, vLog, vLog1p, vErf, vErfInv and vPowx are checked one by one against the bounds
+!    of the errors of service_math_vec.h and the special cases of the C library
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-MATH_BENCH"></a>
+ * \example math_bench.cpp
+ */
+
+#include "bench.h"
+#include <cmath>
+#include <limits>
+
+#if defined(DAAL_BENCH_VEC_MATH)
+/* The internal header is available when the benchmark is built by the bench target of the library makefile */
+#include "service_math_vec.h"
+#endif
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Maximal error of the functions in units in the last place of the result */
+const double maxErrorInUlps = 4.0;
+
+/* Function computed by the library algorithm, by the C library and by the long double C library */
+template <typename FPType>
+struct LogisticFunction
+{
+    static const char *getName() { return "logistic"; }
+    static double getScale() { return 2.0; }
+
+    static services::SharedPtr<NumericTable> compute(const services::SharedPtr<NumericTable> &data)
+    {
+        math::logistic::Batch<FPType> algorithm;
+        algorithm.input.set(math::logistic::data, data);
+        algorithm.compute();
+        return algorithm.getResult()->get(math::logistic::value);
+    }
+
+    static void computeRow(const FPType *x, size_t n, FPType *y)
+    {
+        for (size_t i = 0; i < n; i++) { y[i] = (FPType)1 / ((FPType)1 + std::exp(-x[i])); }
+    }
+
+    static void computeRow(const FPType *x, size_t n, long double *y)
+    {
+        for (size_t i = 0; i < n; i++) { y[i] = 1.0L / (1.0L + expl(-(long double)x[i])); }
+    }
+};
+
+template <typename FPType>
+struct TanhFunction
+{
+    static const char *getName() { return "tanh"; }
+    static double getScale() { return 0.5; }
+
+    static services::SharedPtr<NumericTable> compute(const services::SharedPtr<NumericTable> &data)
+    {
+        math::tanh::Batch<FPType> algorithm;
+        algorithm.input.set(math::tanh::data, data);
+        algorithm.compute();
+        return algorithm.getResult()->get(math::tanh::value);
+    }
+
+    static void computeRow(const FPType *x, size_t n, FPType *y)
+    {
+        for (size_t i = 0; i < n; i++) { y[i] = std::tanh(x[i]); }
+    }
+
+    static void computeRow(const FPType *x, size_t n, long double *y)
+    {
+        for (size_t i = 0; i < n; i++) { y[i] = tanhl((long double)x[i]); }
+    }
+};
+
+template <typename FPType>
+struct SmoothReLUFunction
+{
+    static const char *getName() { return "smoothrelu"; }
+    static double getScale() { return 2.0; }
+
+    static services::SharedPtr<NumericTable> compute(const services::SharedPtr<NumericTable> &data)
+    {
+        math::smoothrelu::Batch<FPType> algorithm;
+        algorithm.input.set(math::smoothrelu::data, data);
+        algorithm.compute();
+        return algorithm.getResult()->get(math::smoothrelu::value);
+    }
+
+    static void computeRow(const FPType *x, size_t n, FPType *y)
+    {
+        for (size_t i = 0; i < n; i++) { y[i] = std::log1p(std::exp(x[i])); }
+    }
+
+    static void computeRow(const FPType *x, size_t n, long double *y)
+    {
+        for (size_t i = 0; i < n; i++) { y[i] = log1pl(expl((long double)x[i])); }
+    }
+};
+
+template <typename FPType>
+struct SoftmaxFunction
+{
+    static const char *getName() { return "softmax"; }
+    static double getScale() { return 2.0; }
+
+    static services::SharedPtr<NumericTable> compute(const services::SharedPtr<NumericTable> &data)
+    {
+        math::softmax::Batch<FPType> algorithm;
+        algorithm.input.set(math::softmax::data, data);
+        algorithm.compute();
+        return algorithm.getResult()->get(math::softmax::value);
+    }
+
+    template <typename ResultType>
+    static void computeRow(const FPType *x, size_t n, ResultType *y)
+    {
+        FPType xMax = x[0];
+        for (size_t i = 1; i < n; i++) { xMax = (x[i] > xMax ? x[i] : xMax); }
+
+        ResultType sum = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            y[i] = exp((ResultType)(x[i] - xMax));
+            sum += y[i];
+        }
+        for (size_t i = 0; i < n; i++) { y[i] /= sum; }
+    }
+};
+
+/* Computes the function by the library algorithm */
+template <typename FPType, template <typename> class Function>
+class MathFunctionBench : public BenchCase
+{
+public:
+    MathFunctionBench(const BenchOptions &opt, const services::SharedPtr<NumericTable> &data) :
+        BenchCase(getBenchCaseName(opt, Function<FPType>::getName(), "batch", data->getNumberOfRows()),
+                  data->getNumberOfRows(), getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _data(data) {}
+
+    void run()
+    {
+        _result = Function<FPType>::compute(_data);
+    }
+
+    services::SharedPtr<NumericTable> getResult() const { return _result; }
+
+private:
+    services::SharedPtr<NumericTable> _data;
+    services::SharedPtr<NumericTable> _result;
+};
+
+/* Computes the function by the C library functions in the floating-point type of the benchmark */
+template <typename FPType, template <typename> class Function>
+class LibmFunctionBench : public BenchCase
+{
+public:
+    LibmFunctionBench(const BenchOptions &opt, const services::SharedPtr<NumericTable> &data) :
+        BenchCase(getBenchCaseName(opt, string(Function<FPType>::getName()) + "_libm", "batch", data->getNumberOfRows()),
+                  data->getNumberOfRows(), getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _data(data), _result(data->getNumberOfRows() * data->getNumberOfColumns()) {}
+
+    void run()
+    {
+        const size_t nRows = _data->getNumberOfRows(), nCols = _data->getNumberOfColumns();
+        BlockDescriptor<FPType> block;
+        _data->getBlockOfRows(0, nRows, readOnly, block);
+        const FPType *x = block.getBlockPtr();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            Function<FPType>::computeRow(x + i * nCols, nCols, &_result[i * nCols]);
+        }
+        _data->releaseBlockOfRows(block);
+    }
+
+private:
+    services::SharedPtr<NumericTable> _data;
+    vector<FPType> _result;
+};
+
+/* Returns the maximal error of the result of the library algorithm in units in the last place */
+template <typename FPType, template <typename> class Function>
+double getMaxErrorInUlps(const services::SharedPtr<NumericTable> &data, const services::SharedPtr<NumericTable> &result)
+{
+    const size_t nRows = data->getNumberOfRows(), nCols = data->getNumberOfColumns();
+    BlockDescriptor<FPType> dataBlock, resultBlock;
+    data->getBlockOfRows(0, nRows, readOnly, dataBlock);
+    result->getBlockOfRows(0, nRows, readOnly, resultBlock);
+    const FPType *x = dataBlock.getBlockPtr();
+    const FPType *y = resultBlock.getBlockPtr();
+
+    vector<long double> reference(nCols);
+    double maxError = 0.0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        Function<FPType>::computeRow(x + i * nCols, nCols, &reference[0]);
+        for (size_t j = 0; j < nCols; j++)
+        {
+            FPType r = (FPType)reference[j];
+            FPType ulp = (r != (FPType)0 ? fabs(r) * numeric_limits<FPType>::epsilon() : numeric_limits<FPType>::denorm_min());
+            double error = (double)(fabsl((long double)y[i * nCols + j] - reference[j]) / (long double)ulp);
+            maxError = (error > maxError || error != error ? error : maxError);
+        }
+    }
+
+    data->releaseBlockOfRows(dataBlock);
+    result->releaseBlockOfRows(resultBlock);
+    return maxError;
+}
+
+template <typename FPType, template <typename> class Function>
+void runMathFunctionBench(const BenchOptions &opt, BenchReport &report, BenchDataGenerator &generator)
+{
+    /* The generated values are in [0, 11), they are centered and scaled to the range where the function changes */
+    services::SharedPtr<NumericTable> data = generator.generateData<FPType>(opt.nRows);
+    FPType *values = static_cast<HomogenNumericTable<FPType> *>(data.get())->getArray();
+    for (size_t i = 0; i < opt.nRows * opt.nFeatures; i++)
+    {
+        values[i] = (FPType)((values[i] - 5.5) * Function<FPType>::getScale());
+    }
+
+    MathFunctionBench<FPType, Function> bench(opt, data);
+    report.measure(bench);
+
+    LibmFunctionBench<FPType, Function> libmBench(opt, data);
+    report.measure(libmBench);
+
+    if (bench.getResult().get())
+    {
+        double maxError = getMaxErrorInUlps<FPType, Function>(data, bench.getResult());
+        printf("%-64s max error %.2f ulp\n", bench.getName().c_str(), maxError);
+        if (!(maxError <= maxErrorInUlps))
+        {
+            report.fail(bench.getName(), "the error exceeds the bound");
+        }
+    }
+}
+
+#if defined(DAAL_BENCH_VEC_MATH)
+
+/* Number of the random arguments of every vector math function and parameter */
+const size_t nVecMathArguments = 1000000;
+
+/* Pseudo-random numbers of the arguments of the vector math functions */
+class VecMathRandom
+{
+public:
+    VecMathRandom(unsigned long long seed) : _state(seed) {}
+
+    /* Returns a pseudo-random number uniformly distributed on [a, b) */
+    double getUniform(double a, double b)
+    {
+        next();
+        return a + (b - a) * ((double)(_state >> 11) / 9007199254740992.0);
+    }
+
+    /* Returns a pseudo-random number with the decimal logarithm of the absolute value uniformly distributed
+       on [a, b), the sign is random if isSigned */
+    double getLogUniform(double a, double b, bool isSigned)
+    {
+        double value = pow(10.0, getUniform(a, b));
+        return (isSigned && getBit() ? -value : value);
+    }
+
+    bool getBit()
+    {
+        next();
+        return ((_state >> 63) != 0);
+    }
+
+private:
+    void next() { _state = _state * 6364136223846793005ULL + 1442695040888963407ULL; }
+
+    unsigned long long _state;
+};
+
+template <typename FPType>
+bool isDoubleType() { return (sizeof(FPType) == sizeof(double)); }
+
+/* Vector math functions of the library. Every function provides the bound of its error in ulp from the table
+   of service_math_vec.h, the random arguments of the range of the bound, the reference computed by the long double
+   C library and the arguments of the special cases. The parameter is the power of vPowx, unused by the other functions */
+template <typename FPType>
+struct VecExpFunction
+{
+    typedef daal::internal::vec::VecMath<FPType, daal::sse2> VecMath;
+
+    static const char *getName() { return "vExp"; }
+    static double getMaxError() { return (isDoubleType<FPType>() ? 0.99 : 1.06); }
+    static vector<double> getParameters() { return vector<double>(1, 0.0); }
+
+    static void compute(size_t n, FPType *x, double parameter, FPType *y) { VecMath::vExp(n, x, y); }
+    static long double getReference(long double x, double parameter) { return expl(x); }
+
+    static FPType getArgument(VecMathRandom &random, double parameter)
+    {
+        return (FPType)(isDoubleType<FPType>() ? random.getUniform(-745.1, 709.78) : random.getUniform(-103.9, 88.72));
+    }
+
+    static vector<double> getSpecialArguments()
+    {
+        const double values[] = { 0.0, -0.0, 1.0e-300, 710.0, -746.0, 89.0, -104.0 };
+        return vector<double>(values, values + sizeof(values) / sizeof(values[0]));
+    }
+};
+
+template <typename FPType>
+struct VecLogFunction
+{
+    typedef daal::internal::vec::VecMath<FPType, daal::sse2> VecMath;
+
+    static const char *getName() { return "vLog"; }
+    static double getMaxError() { return (isDoubleType<FPType>() ? 0.81 : 0.83); }
+    static vector<double> getParameters() { return vector<double>(1, 0.0); }
+
+    static void compute(size_t n, FPType *x, double parameter, FPType *y) { VecMath::vLog(n, x, y); }
+    static long double getReference(long double x, double parameter) { return logl(x); }
+
+    /* The arguments include the denormal numbers */
+    static FPType getArgument(VecMathRandom &random, double parameter)
+    {
+        return (FPType)(isDoubleType<FPType>() ? random.getLogUniform(-323.0, 308.0, false) : random.getLogUniform(-44.8, 38.5, false));
+    }
+
+    static vector<double> getSpecialArguments()
+    {
+        const double values[] = { 0.0, -0.0, -1.0, 1.0, 2.0 };
+        return vector<double>(values, values + sizeof(values) / sizeof(values[0]));
+    }
+};
+
+template <typename FPType>
+struct VecLog1pFunction
+{
+    typedef daal::internal::vec::VecMath<FPType, daal::sse2> VecMath;
+
+    static const char *getName() { return "vLog1p"; }
+    static double getMaxError() { return (isDoubleType<FPType>() ? 1.44 : 0.50); }
+    static vector<double> getParameters() { return vector<double>(1, 0.0); }
+
+    static void compute(size_t n, FPType *x, double parameter, FPType *y) { VecMath::vLog1p(n, x, y); }
+    static long double getReference(long double x, double parameter) { return log1pl(x); }
+
+    /* Half of the arguments are in (-1, 1), the others are of all the magnitudes */
+    static FPType getArgument(VecMathRandom &random, double parameter)
+    {
+        if (random.getBit()) { return (FPType)random.getUniform(-1.0, 1.0); }
+        double x = random.getLogUniform(-30.0, (isDoubleType<FPType>() ? 300.0 : 38.0), true);
+        return (FPType)(x < -1.0 ? -1.0 / x : x);
+    }
+
+    static vector<double> getSpecialArguments()
+    {
+        const double values[] = { 0.0, -0.0, -1.0, -2.0, 1.0e-300, -1.0e-300 };
+        return vector<double>(values, values + sizeof(values) / sizeof(values[0]));
+    }
+};
+
+template <typename FPType>
+struct VecErfFunction
+{
+    typedef daal::internal::vec::VecMath<FPType, daal::sse2> VecMath;
+
+    static const char *getName() { return "vErf"; }
+    static double getMaxError() { return (isDoubleType<FPType>() ? 1.67 : 0.50); }
+    static vector<double> getParameters() { return vector<double>(1, 0.0); }
+
+    static void compute(size_t n, FPType *x, double parameter, FPType *y) { VecMath::vErf(n, x, y); }
+    static long double getReference(long double x, double parameter) { return erfl(x); }
+
+    /* Half of the arguments are in (-7, 7), the others are small */
+    static FPType getArgument(VecMathRandom &random, double parameter)
+    {
+        if (random.getBit()) { return (FPType)random.getUniform(-7.0, 7.0); }
+        return (FPType)random.getLogUniform(-30.0, 0.0, true);
+    }
+
+    static vector<double> getSpecialArguments()
+    {
+        const double values[] = { 0.0, -0.0, 1.0e-300, -1.0e-300, 6.0, -6.0, 30.0 };
+        return vector<double>(values, values + sizeof(values) / sizeof(values[0]));
+    }
+};
+
+template <typename FPType>
+struct VecErfInvFunction
+{
+    typedef daal::internal::vec::VecMath<FPType, daal::sse2> VecMath;
+
+    static const char *getName() { return "vErfInv"; }
+    static double getMaxError() { return (isDoubleType<FPType>() ? 3.45 : 0.50); }
+    static vector<double> getParameters() { return vector<double>(1, 0.0); }
+
+    static void compute(size_t n, FPType *x, double parameter, FPType *y) { VecMath::vErfInv(n, x, y); }
+
+    /* Solves erf(w) = x by the Newton method, erfc(|w|) = 1 - |x| is solved for |x| >= 0.5 to avoid the cancellation */
+    static long double getReference(long double x, double parameter)
+    {
+        const long double a = fabsl(x);
+        if (!(a < 1.0L)) { return (a == 1.0L ? x * numeric_limits<long double>::infinity() : numeric_limits<long double>::quiet_NaN()); }
+
+        const long double sqrtPi = 1.772453850905516027298167483341145183L;
+        long double w = (a < 0.5L ? a * sqrtPi / 2.0L : sqrtl(-logl((1.0L - a) * (1.0L + a))));
+        for (int i = 0; i < 100; i++)
+        {
+            const long double derivative = 2.0L / sqrtPi * expl(-w * w);
+            const long double step = (a < 0.5L ? (erfl(w) - a) : ((1.0L - a) - erfcl(w))) / derivative;
+            w -= step;
+            if (fabsl(step) <= w * numeric_limits<long double>::epsilon()) { break; }
+        }
+        return (x < 0.0L || (x == 0.0L && signbit(x)) ? -w : w);
+    }
+
+    /* Half of the arguments are in (-1, 1), the others are close to -1 and 1 */
+    static FPType getArgument(VecMathRandom &random, double parameter)
+    {
+        if (random.getBit()) { return (FPType)random.getUniform(-1.0, 1.0); }
+        double x = 1.0 - random.getLogUniform((isDoubleType<FPType>() ? -16.0 : -7.2), -1.0, false);
+        return (FPType)(random.getBit() ? -x : x);
+    }
+
+    static vector<double> getSpecialArguments()
+    {
+        const double values[] = { 0.0, -0.0, 1.0, -1.0, 1.5, -1.5, 1.0e-300 };
+        return vector<double>(values, values + sizeof(values) / sizeof(values[0]));
+    }
+};
+
+template <typename FPType>
+struct VecPowxFunction
+{
+    typedef daal::internal::vec::VecMath<FPType, daal::sse2> VecMath;
+
+    static const char *getName() { return "vPowx"; }
+    static double getMaxError() { return (isDoubleType<FPType>() ? 1.16 : 0.50); }
+
+    /* The powers include the integer ones and the ones computed apart from the general kernel */
+    static vector<double> getParameters()
+    {
+        const double values[] = { 0.3, -0.5, 2.5, 3.7, 17.0, -18.0, 50.0, 100.25, -199.9, 300.0, 2.0, -1.0 };
+        return vector<double>(values, values + sizeof(values) / sizeof(values[0]));
+    }
+
+    static void compute(size_t n, FPType *x, double parameter, FPType *y) { VecMath::vPowx(n, x, (FPType)parameter, y); }
+    static long double getReference(long double x, double parameter) { return powl(x, (long double)(FPType)parameter); }
+
+    /* The results cover the whole range including the overflow and the denormal numbers,
+       the arguments are negative for the integer powers */
+    static FPType getArgument(VecMathRandom &random, double parameter)
+    {
+        const double y = (double)(FPType)parameter;
+        const double z = (isDoubleType<FPType>() ? random.getUniform(-745.0, 709.7) : random.getUniform(-103.9, 88.7));
+        const double x = exp(z / y);
+        return (FPType)(floor(y) == y && random.getBit() ? -x : x);
+    }
+
+    static vector<double> getSpecialArguments()
+    {
+        const double values[] = { 0.0, -0.0, 1.0, -1.0, -2.0, 1.0e-300, 1.0e+300 };
+        return vector<double>(values, values + sizeof(values) / sizeof(values[0]));
+    }
+};
+
+/* Returns the error of the result in units in the last place of the reference rounded to FPType,
+   the infinite and not-a-number results must be equal to the rounded reference */
+template <typename FPType>
+double getErrorInUlps(FPType result, long double reference)
+{
+    const FPType r = (FPType)reference;
+    if (r != r || result != result) { return (r != r && result != result ? 0.0 : numeric_limits<double>::infinity()); }
+    if (fabs(r) == numeric_limits<FPType>::infinity() || fabs(result) == numeric_limits<FPType>::infinity())
+    {
+        return (r == result ? 0.0 : numeric_limits<double>::infinity());
+    }
+
+    int exponent = numeric_limits<FPType>::min_exponent;
+    if (reference != 0.0L)
+    {
+        frexpl(reference, &exponent);
+        exponent = (exponent < numeric_limits<FPType>::min_exponent ? numeric_limits<FPType>::min_exponent : exponent);
+    }
+    const long double ulp = ldexpl(1.0L, exponent - numeric_limits<FPType>::digits);
+    return (double)(fabsl((long double)result - reference) / ulp);
+}
+
+/* Returns true if the result of the special case is the reference rounded to FPType, including the sign of zero */
+template <typename FPType>
+bool isSpecialCaseCorrect(FPType result, long double reference)
+{
+    const FPType r = (FPType)reference;
+    if (r != r) { return (result != result); }
+    return (result == r && signbit(result) == signbit(r));
+}
+
+template <typename FPType, template <typename> class Function>
+void checkVecMathFunction(const BenchOptions &opt, BenchReport &report)
+{
+    const FPType inf = numeric_limits<FPType>::infinity();
+    const FPType specialValues[] = { inf, -inf, numeric_limits<FPType>::quiet_NaN(), numeric_limits<FPType>::denorm_min(),
+                                     numeric_limits<FPType>::max(), -numeric_limits<FPType>::max() };
+
+    VecMathRandom random(opt.seed);
+    const vector<double> parameters = Function<FPType>::getParameters();
+    for (size_t k = 0; k < parameters.size(); k++)
+    {
+        const double parameter = parameters[k];
+        ostringstream name;
+        name << Function<FPType>::getName() << "/" << opt.dtype;
+        if (parameters.size() > 1) { name << "/y=" << (FPType)parameter; }
+
+        vector<FPType> x(nVecMathArguments), y(nVecMathArguments);
+        for (size_t i = 0; i < nVecMathArguments; i++) { x[i] = Function<FPType>::getArgument(random, parameter); }
+        Function<FPType>::compute(nVecMathArguments, &x[0], parameter, &y[0]);
+
+        double maxError = 0.0;
+        FPType maxErrorArgument = 0;
+        for (size_t i = 0; i < nVecMathArguments; i++)
+        {
+            double error = getErrorInUlps<FPType>(y[i], Function<FPType>::getReference((long double)x[i], parameter));
+            if (error > maxError || error != error)
+            {
+                maxError = error;
+                maxErrorArgument = x[i];
+            }
+        }
+
+        /* The special cases are computed one by one to check the branches of the functions for the whole vectors */
+        vector<double> special = Function<FPType>::getSpecialArguments();
+        special.insert(special.end(), specialValues, specialValues + sizeof(specialValues) / sizeof(specialValues[0]));
+        size_t nIncorrect = 0;
+        for (size_t i = 0; i < special.size(); i++)
+        {
+            FPType xs = (FPType)special[i], ys;
+            Function<FPType>::compute(1, &xs, parameter, &ys);
+            if (!isSpecialCaseCorrect<FPType>(ys, Function<FPType>::getReference((long double)xs, parameter)))
+            {
+                printf("%-64s special case x=%g: %g\n", name.str().c_str(), (double)xs, (double)ys);
+                nIncorrect++;
+            }
+        }
+
+        printf("%-64s max error %.2f ulp at x=%.9g, bound %.2f ulp\n", name.str().c_str(), maxError, (double)maxErrorArgument,
+               Function<FPType>::getMaxError());
+        /* The bounds are published with two decimal places */
+        if (!(maxError <= Function<FPType>::getMaxError() + 0.005)) { report.fail(name.str(), "the error exceeds the bound"); }
+        if (nIncorrect > 0) { report.fail(name.str(), "the special cases differ from the C library"); }
+    }
+}
+
+template <typename FPType>
+void checkVecMathFunctions(const BenchOptions &opt, BenchReport &report)
+{
+    checkVecMathFunction<FPType, VecExpFunction   >(opt, report);
+    checkVecMathFunction<FPType, VecLogFunction   >(opt, report);
+    checkVecMathFunction<FPType, VecLog1pFunction >(opt, report);
+    checkVecMathFunction<FPType, VecErfFunction   >(opt, report);
+    checkVecMathFunction<FPType, VecErfInvFunction>(opt, report);
+    checkVecMathFunction<FPType, VecPowxFunction  >(opt, report);
+}
+
+#endif
+
+template <typename FPType>
+void runMathBench(const BenchOptions &opt, BenchReport &report)
+{
+    /* The functions are available in the batch processing mode only */
+    if (!isBenchModeEnabled(opt, "batch")) { return; }
+
+    BenchDataGenerator generator(opt);
+    runMathFunctionBench<FPType, LogisticFunction  >(opt, report, generator);
+    runMathFunctionBench<FPType, TanhFunction      >(opt, report, generator);
+    runMathFunctionBench<FPType, SmoothReLUFunction>(opt, report, generator);
+    runMathFunctionBench<FPType, SoftmaxFunction   >(opt, report, generator);
+
+#if defined(DAAL_BENCH_VEC_MATH)
+    checkVecMathFunctions<FPType>(opt, report);
+#else
+    printf("The vector math functions are checked when the benchmark is built by the bench target of the library makefile\n");
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+    if (opt.sparsity > 0.0)
+    {
+        printf("The math functions are measured on dense data only\n");
+        return 1;
+    }
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runMathBench<float>(opt, report); }
+    else                      { runMathBench<double>(opt, report); }
+
+    return report.finish();
+}
@@ -0,0 +1,215 @@
+/* file: naive_bayes_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the training of the multinomial Naive Bayes classifier in the batch,
+!    online and distributed processing modes and of the prediction in the batch processing mode
+!    on a synthetic data set
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-NAIVE_BAYES_BENCH"></a>
+ * \example naive_bayes_bench.cpp
+ */
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::multinomial_naive_bayes;
+
+typedef vector<services::SharedPtr<NumericTable> > DataBlocks;
+
+template <typename FPType, training::Method method>
+class NaiveBayesTrainingBatchBench : public BenchCase
+{
+public:
+    NaiveBayesTrainingBatchBench(const BenchOptions &opt, services::SharedPtr<NumericTable> data,
+                                 services::SharedPtr<NumericTable> labels) :
+        BenchCase(getBenchCaseName(opt, "naive_bayes_training", "batch", data->getNumberOfRows()), data->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _opt(opt), _data(data), _labels(labels) {}
+
+    void run()
+    {
+        training::Batch<FPType, method> algorithm(_opt.nClasses);
+        algorithm.input.set(classifier::training::data,   _data);
+        algorithm.input.set(classifier::training::labels, _labels);
+        algorithm.compute();
+        _model = algorithm.getResult()->get(classifier::training::model);
+    }
+
+    services::SharedPtr<classifier::Model> getModel() const { return _model; }
+
+private:
+    const BenchOptions &_opt;
+    services::SharedPtr<NumericTable> _data;
+    services::SharedPtr<NumericTable> _labels;
+    services::SharedPtr<classifier::Model> _model;
+};
+
+template <typename FPType, training::Method method>
+class NaiveBayesTrainingOnlineBench : public BenchCase
+{
+public:
+    NaiveBayesTrainingOnlineBench(const BenchOptions &opt, const DataBlocks &blocks, const DataBlocks &labels, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "naive_bayes_training", "online", nRows), nRows, getBenchDataSize<FPType>(opt, nRows)),
+        _opt(opt), _blocks(blocks), _labels(labels) {}
+
+    void run()
+    {
+        training::Online<FPType, method> algorithm(_opt.nClasses);
+        for (size_t i = 0; i < _blocks.size(); i++)
+        {
+            algorithm.input.set(classifier::training::data,   _blocks[i]);
+            algorithm.input.set(classifier::training::labels, _labels[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+private:
+    const BenchOptions &_opt;
+    const DataBlocks &_blocks;
+    const DataBlocks &_labels;
+};
+
+template <typename FPType, training::Method method>
+class NaiveBayesTrainingDistributedBench : public BenchCase
+{
+public:
+    NaiveBayesTrainingDistributedBench(const BenchOptions &opt, const DataBlocks &blocks, const DataBlocks &labels, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "naive_bayes_training", "distributed", nRows), nRows, getBenchDataSize<FPType>(opt, nRows)),
+        _opt(opt), _blocks(blocks), _labels(labels) {}
+
+    void run()
+    {
+        training::Distributed<step2Master, FPType, method> masterAlgorithm(_opt.nClasses);
+        for (size_t i = 0; i < _blocks.size(); i++)
+        {
+            training::Distributed<step1Local, FPType, method> localAlgorithm(_opt.nClasses);
+            localAlgorithm.input.set(classifier::training::data,   _blocks[i]);
+            localAlgorithm.input.set(classifier::training::labels, _labels[i]);
+            localAlgorithm.compute();
+
+            masterAlgorithm.input.add(classifier::training::partialModels, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+    }
+
+private:
+    const BenchOptions &_opt;
+    const DataBlocks &_blocks;
+    const DataBlocks &_labels;
+};
+
+template <typename FPType, prediction::Method method>
+class NaiveBayesPredictionBatchBench : public BenchCase
+{
+public:
+    NaiveBayesPredictionBatchBench(const BenchOptions &opt, services::SharedPtr<NumericTable> data,
+                                   services::SharedPtr<classifier::Model> model) :
+        BenchCase(getBenchCaseName(opt, "naive_bayes_prediction", "batch", data->getNumberOfRows()), data->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _opt(opt), _data(data), _model(model) {}
+
+    void run()
+    {
+        prediction::Batch<FPType, method> algorithm(_opt.nClasses);
+        algorithm.input.set(classifier::prediction::data,  _data);
+        algorithm.input.set(classifier::prediction::model, _model);
+        algorithm.compute();
+    }
+
+private:
+    const BenchOptions &_opt;
+    services::SharedPtr<NumericTable> _data;
+    services::SharedPtr<classifier::Model> _model;
+};
+
+template <typename FPType, training::Method trainingMethod, prediction::Method predictionMethod>
+void runNaiveBayesBench(const BenchOptions &opt, BenchReport &report)
+{
+    BenchDataGenerator generator(opt);
+
+    if (isBenchModeEnabled(opt, "batch"))
+    {
+        services::SharedPtr<NumericTable> data = generator.generateData<FPType>(opt.nRows);
+        NaiveBayesTrainingBatchBench<FPType, trainingMethod> trainingBench(opt, data, generator.generateLabels<FPType>(opt.nRows));
+        report.measure(trainingBench);
+
+        /* The prediction uses the model trained in the last run of the training benchmark */
+        if (trainingBench.getModel().get())
+        {
+            NaiveBayesPredictionBatchBench<FPType, predictionMethod> predictionBench(opt, data, trainingBench.getModel());
+            report.measure(predictionBench);
+        }
+    }
+
+    if (!isBenchModeEnabled(opt, "online") && !isBenchModeEnabled(opt, "distributed")) { return; }
+
+    DataBlocks blocks = generator.generateDataBlocks<FPType>(opt.nRows, opt.nBlocks);
+    const size_t nRowsInBlock = opt.nRows / opt.nBlocks;
+    DataBlocks labels(opt.nBlocks);
+    for (size_t i = 0; i < opt.nBlocks; i++)
+    {
+        labels[i] = generator.generateLabels<FPType>(nRowsInBlock, i * nRowsInBlock);
+    }
+
+    if (isBenchModeEnabled(opt, "online"))
+    {
+        NaiveBayesTrainingOnlineBench<FPType, trainingMethod> bench(opt, blocks, labels, nRowsInBlock * opt.nBlocks);
+        report.measure(bench);
+    }
+
+    if (isBenchModeEnabled(opt, "distributed"))
+    {
+        NaiveBayesTrainingDistributedBench<FPType, trainingMethod> bench(opt, blocks, labels, nRowsInBlock * opt.nBlocks);
+        report.measure(bench);
+    }
+}
+
+template <typename FPType>
+void runNaiveBayesBench(const BenchOptions &opt, BenchReport &report)
+{
+    if (opt.sparsity > 0.0)
+    {
+        runNaiveBayesBench<FPType, training::fastCSR, prediction::fastCSR>(opt, report);
+    }
+    else
+    {
+        runNaiveBayesBench<FPType, training::defaultDense, prediction::defaultDense>(opt, report);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    opt.nRows = 1000000;
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runNaiveBayesBench<float>(opt, report); }
+    else                      { runNaiveBayesBench<double>(opt, report); }
+
+    return report.finish();
+}
@@ -0,0 +1,236 @@
+/* file: quantiles_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the computation of quantiles in the batch, online and distributed
+!    processing modes on a synthetic data set. The quantiles computed from the sketches
+!    in the online and distributed processing modes are checked against the ranks
+!    of the observations
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-QUANTILES_BENCH"></a>
+ * \example quantiles_bench.cpp
+ */
+
+#include "bench.h"
+#include <algorithm>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Orders of the quantiles, the tails are included to check the accuracy of the sketches */
+const size_t nQuantileOrders = 9;
+const double quantileOrders[nQuantileOrders] = { 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999 };
+
+/* Maximal difference between the order of the quantile and the rank of its value divided by the number of observations */
+const double maxRankError = 0.01;
+
+template <typename FPType>
+services::SharedPtr<NumericTable> getQuantileOrders()
+{
+    HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(nQuantileOrders, 1, NumericTable::doAllocate);
+    for (size_t k = 0; k < nQuantileOrders; k++) { table->getArray()[k] = (FPType)quantileOrders[k]; }
+    return services::SharedPtr<NumericTable>(table);
+}
+
+template <typename FPType>
+class QuantilesBatchBench : public BenchCase
+{
+public:
+    QuantilesBatchBench(const BenchOptions &opt, services::SharedPtr<NumericTable> data) :
+        BenchCase(getBenchCaseName(opt, "quantiles", "batch", data->getNumberOfRows()), data->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _data(data) {}
+
+    void run()
+    {
+        quantiles::Batch<FPType> algorithm;
+        algorithm.parameter.quantileOrders = getQuantileOrders<FPType>();
+        algorithm.input.set(quantiles::data, _data);
+        algorithm.compute();
+    }
+
+private:
+    services::SharedPtr<NumericTable> _data;
+};
+
+template <typename FPType>
+class QuantilesOnlineBench : public BenchCase
+{
+public:
+    QuantilesOnlineBench(const BenchOptions &opt, const vector<services::SharedPtr<NumericTable> > &blocks, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "quantiles", "online", nRows), nRows, getBenchDataSize<FPType>(opt, nRows)),
+        _blocks(blocks) {}
+
+    void run()
+    {
+        quantiles::Online<FPType> algorithm;
+        algorithm.parameter.quantileOrders = getQuantileOrders<FPType>();
+        for (size_t i = 0; i < _blocks.size(); i++)
+        {
+            algorithm.input.set(quantiles::data, _blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+        _result = algorithm.getResult()->get(quantiles::quantiles);
+    }
+
+    services::SharedPtr<NumericTable> getResult() const { return _result; }
+
+private:
+    const vector<services::SharedPtr<NumericTable> > &_blocks;
+    services::SharedPtr<NumericTable> _result;
+};
+
+template <typename FPType>
+class QuantilesDistributedBench : public BenchCase
+{
+public:
+    QuantilesDistributedBench(const BenchOptions &opt, const vector<services::SharedPtr<NumericTable> > &blocks, size_t nRows) :
+        BenchCase(getBenchCaseName(opt, "quantiles", "distributed", nRows), nRows, getBenchDataSize<FPType>(opt, nRows)),
+        _blocks(blocks) {}
+
+    void run()
+    {
+        quantiles::Distributed<step2Master, FPType> masterAlgorithm;
+        masterAlgorithm.parameter.quantileOrders = getQuantileOrders<FPType>();
+        for (size_t i = 0; i < _blocks.size(); i++)
+        {
+            quantiles::Distributed<step1Local, FPType> localAlgorithm;
+            localAlgorithm.input.set(quantiles::data, _blocks[i]);
+            localAlgorithm.compute();
+
+            masterAlgorithm.input.add(quantiles::partialResults, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+        _result = masterAlgorithm.getResult()->get(quantiles::quantiles);
+    }
+
+    services::SharedPtr<NumericTable> getResult() const { return _result; }
+
+private:
+    const vector<services::SharedPtr<NumericTable> > &_blocks;
+    services::SharedPtr<NumericTable> _result;
+};
+
+/* Returns the maximal difference between the orders of the quantiles and the ranks of their values in the blocks */
+template <typename FPType>
+double getMaxRankError(const vector<services::SharedPtr<NumericTable> > &blocks, const services::SharedPtr<NumericTable> &result)
+{
+    const size_t nFeatures = result->getNumberOfRows();
+    BlockDescriptor<FPType> resultBlock;
+    result->getBlockOfRows(0, nFeatures, readOnly, resultBlock);
+    const FPType *quants = resultBlock.getBlockPtr();
+
+    double maxError = 0.0;
+    vector<FPType> values;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        values.clear();
+        for (size_t b = 0; b < blocks.size(); b++)
+        {
+            const size_t nRows = blocks[b]->getNumberOfRows();
+            BlockDescriptor<FPType> block;
+            blocks[b]->getBlockOfColumnValues(j, 0, nRows, readOnly, block);
+            values.insert(values.end(), block.getBlockPtr(), block.getBlockPtr() + nRows);
+            blocks[b]->releaseBlockOfColumnValues(block);
+        }
+        sort(values.begin(), values.end());
+
+        const double n = (double)values.size();
+        for (size_t k = 0; k < nQuantileOrders; k++)
+        {
+            const FPType value = quants[j * nQuantileOrders + k];
+            const double lowerRank = (double)(lower_bound(values.begin(), values.end(), value) - values.begin()) / n;
+            const double upperRank = (double)(upper_bound(values.begin(), values.end(), value) - values.begin()) / n;
+            const double error = (quantileOrders[k] < lowerRank ? lowerRank - quantileOrders[k] :
+                                 (quantileOrders[k] > upperRank ? quantileOrders[k] - upperRank : 0.0));
+            maxError = (error > maxError || error != error ? error : maxError);
+        }
+    }
+
+    result->releaseBlockOfRows(resultBlock);
+    return maxError;
+}
+
+template <typename FPType, typename Bench>
+void checkRankError(BenchReport &report, const Bench &bench, const vector<services::SharedPtr<NumericTable> > &blocks)
+{
+    if (!bench.getResult().get()) { return; }
+
+    double maxError = getMaxRankError<FPType>(blocks, bench.getResult());
+    printf("%-64s max rank error %.5f\n", bench.getName().c_str(), maxError);
+    if (!(maxError <= maxRankError))
+    {
+        report.fail(bench.getName(), "the rank error exceeds the bound");
+    }
+}
+
+template <typename FPType>
+void runQuantilesBench(const BenchOptions &opt, BenchReport &report)
+{
+    BenchDataGenerator generator(opt);
+
+    if (isBenchModeEnabled(opt, "batch"))
+    {
+        QuantilesBatchBench<FPType> bench(opt, generator.generateData<FPType>(opt.nRows));
+        report.measure(bench);
+    }
+
+    if (!isBenchModeEnabled(opt, "online") && !isBenchModeEnabled(opt, "distributed")) { return; }
+
+    vector<services::SharedPtr<NumericTable> > blocks = generator.generateDataBlocks<FPType>(opt.nRows, opt.nBlocks);
+    const size_t nRows = opt.nRows / opt.nBlocks * opt.nBlocks;
+
+    if (isBenchModeEnabled(opt, "online"))
+    {
+        QuantilesOnlineBench<FPType> bench(opt, blocks, nRows);
+        report.measure(bench);
+        checkRankError<FPType>(report, bench, blocks);
+    }
+
+    if (isBenchModeEnabled(opt, "distributed"))
+    {
+        QuantilesDistributedBench<FPType> bench(opt, blocks, nRows);
+        report.measure(bench);
+        checkRankError<FPType>(report, bench, blocks);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    opt.nRows = 1000000;
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+    if (opt.sparsity > 0.0)
+    {
+        printf("The quantiles are computed on dense data only\n");
+        return 1;
+    }
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runQuantilesBench<float>(opt, report); }
+    else                      { runQuantilesBench<double>(opt, report); }
+
+    return report.finish();
+}
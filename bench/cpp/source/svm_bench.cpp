@@ -0,0 +1,142 @@
+/* file: svm_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the training and prediction of the two-class SVM classifier
+!    with the linear kernel in the batch processing mode on a synthetic data set
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-BENCH-CPP-SVM_BENCH"></a>
+ * \example svm_bench.cpp
+ */
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+const size_t svmCacheSize = 600000000;
+
+template <typename FPType>
+class SVMTrainingBatchBench : public BenchCase
+{
+public:
+    SVMTrainingBatchBench(const BenchOptions &opt, services::SharedPtr<NumericTable> data, services::SharedPtr<NumericTable> labels,
+                          services::SharedPtr<kernel_function::KernelIface> kernel) :
+        BenchCase(getBenchCaseName(opt, "svm_training", "batch", data->getNumberOfRows()), data->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _data(data), _labels(labels), _kernel(kernel) {}
+
+    void run()
+    {
+        svm::training::Batch<FPType> algorithm;
+        algorithm.parameter.kernel    = _kernel;
+        algorithm.parameter.cacheSize = svmCacheSize;
+        algorithm.input.set(classifier::training::data,   _data);
+        algorithm.input.set(classifier::training::labels, _labels);
+        algorithm.compute();
+        _model = algorithm.getResult()->get(classifier::training::model);
+    }
+
+    services::SharedPtr<classifier::Model> getModel() const { return _model; }
+
+private:
+    services::SharedPtr<NumericTable> _data;
+    services::SharedPtr<NumericTable> _labels;
+    services::SharedPtr<kernel_function::KernelIface> _kernel;
+    services::SharedPtr<classifier::Model> _model;
+};
+
+template <typename FPType>
+class SVMPredictionBatchBench : public BenchCase
+{
+public:
+    SVMPredictionBatchBench(const BenchOptions &opt, services::SharedPtr<NumericTable> data, services::SharedPtr<classifier::Model> model,
+                            services::SharedPtr<kernel_function::KernelIface> kernel) :
+        BenchCase(getBenchCaseName(opt, "svm_prediction", "batch", data->getNumberOfRows()), data->getNumberOfRows(),
+                  getBenchDataSize<FPType>(opt, data->getNumberOfRows())),
+        _data(data), _model(model), _kernel(kernel) {}
+
+    void run()
+    {
+        svm::prediction::Batch<FPType> algorithm;
+        algorithm.parameter.kernel = _kernel;
+        algorithm.input.set(classifier::prediction::data,  _data);
+        algorithm.input.set(classifier::prediction::model, _model);
+        algorithm.compute();
+    }
+
+private:
+    services::SharedPtr<NumericTable> _data;
+    services::SharedPtr<classifier::Model> _model;
+    services::SharedPtr<kernel_function::KernelIface> _kernel;
+};
+
+template <typename FPType, kernel_function::linear::Method kernelMethod>
+void runSVMBench(const BenchOptions &opt, BenchReport &report)
+{
+    /* SVM is available in the batch processing mode only */
+    if (!isBenchModeEnabled(opt, "batch")) { return; }
+
+    BenchDataGenerator generator(opt);
+    services::SharedPtr<NumericTable> data = generator.generateData<FPType>(opt.nRows);
+    services::SharedPtr<NumericTable> labels = generator.generateLabels<FPType>(opt.nRows, 0, true);
+    services::SharedPtr<kernel_function::KernelIface> kernel(new kernel_function::linear::Batch<FPType, kernelMethod>());
+
+    SVMTrainingBatchBench<FPType> trainingBench(opt, data, labels, kernel);
+    report.measure(trainingBench);
+
+    /* The prediction uses the model trained in the last run of the training benchmark */
+    if (trainingBench.getModel().get())
+    {
+        SVMPredictionBatchBench<FPType> predictionBench(opt, data, trainingBench.getModel(), kernel);
+        report.measure(predictionBench);
+    }
+}
+
+template <typename FPType>
+void runSVMBench(const BenchOptions &opt, BenchReport &report)
+{
+    if (opt.sparsity > 0.0)
+    {
+        runSVMBench<FPType, kernel_function::linear::fastCSR>(opt, report);
+    }
+    else
+    {
+        runSVMBench<FPType, kernel_function::linear::defaultDense>(opt, report);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchOptions opt;
+    setDefaultBenchOptions(opt);
+    opt.nRows    = 10000;
+    opt.nClasses = 2;
+    opt.nRepeats = 5;
+    if (!parseBenchOptions(argc, argv, opt)) { return 1; }
+
+    BenchReport report(opt);
+    if (opt.dtype == "float") { runSVMBench<float>(opt, report); }
+    else                      { runSVMBench<double>(opt, report); }
+
+    return report.finish();
+}
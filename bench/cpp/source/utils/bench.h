@@ -0,0 +1,634 @@
+/* file: bench.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Auxiliary functions used in C++ benchmarks: generation of synthetic data sets,
+!    measurement of the runs, reports and comparison with the baseline results
+!******************************************************************************/
+
+#ifndef _BENCH_H
+#define _BENCH_H
+
+#include "daal.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+using namespace daal;
+using namespace daal::data_management;
+
+/* Exit code of a benchmark that is slower than its baseline */
+const int benchRegressionExitCode = 2;
+
+/* Growth of the memory in megabytes that is not reported as a regression regardless of the relative tolerance */
+const double benchMemoryToleranceMB = 1.0;
+
+/* Parameters of the benchmark run set from the command line */
+struct BenchOptions
+{
+    size_t nRows;           /* Number of observations in the generated data set */
+    size_t nFeatures;       /* Number of features in the generated data set */
+    size_t nClasses;        /* Number of classes, clusters or outputs */
+    size_t nBlocks;         /* Number of blocks in the online and distributed processing modes */
+    size_t nIterations;     /* Number of iterations of the iterative algorithms */
+    size_t nWarmups;        /* Number of runs excluded from the measurements */
+    size_t nRepeats;        /* Number of measured runs */
+    double sparsity;        /* Fraction of zero values. CSR numeric tables are used if it is positive */
+    double tolerance;       /* Relative slowdown or memory growth reported as a regression */
+    unsigned int seed;      /* Seed of the data set generator */
+    std::string dtype;      /* Floating-point type of the algorithms: float or double */
+    std::string mode;       /* Processing mode: batch, online, distributed or all */
+    std::string output;     /* Name of the file for the results in the JSON format */
+    std::string baseline;   /* Name of the file with the baseline results in the JSON format */
+};
+
+/* Measurements of the benchmark case */
+struct BenchRecord
+{
+    std::string name;
+    size_t nRows;
+    size_t nRuns;
+    double throughput;      /* Observations per second for the median latency */
+    double bandwidth;       /* Megabytes of the input data per second for the median latency */
+    double latencyMin;      /* Latencies of the runs in milliseconds */
+    double latencyMean;
+    double latencyP50;
+    double latencyP90;
+    double latencyP99;
+    double latencyMax;
+    double peakRSSGrowth;   /* Growth of the peak resident set size of the process during the runs in megabytes */
+};
+
+/**
+ *  Benchmark case. setUp() prepares the algorithms before every run and is not measured,
+ *  run() is the measured part of the run
+ */
+class BenchCase
+{
+public:
+    BenchCase(const std::string &name, size_t nRows, size_t nBytes) : _name(name), _nRows(nRows), _nBytes(nBytes) {}
+    virtual ~BenchCase() {}
+
+    virtual void setUp() {}
+    virtual void run() = 0;
+
+    const std::string &getName() const { return _name; }
+    size_t getNumberOfRows() const { return _nRows; }
+    size_t getNumberOfBytes() const { return _nBytes; }
+
+protected:
+    std::string _name;
+    size_t _nRows;
+    size_t _nBytes;
+};
+
+void printBenchUsage(const char *program, const BenchOptions &opt)
+{
+    printf("Usage: %s [option value]...\n", program);
+    printf("  --rows N         number of observations [%lu]\n", (unsigned long)opt.nRows);
+    printf("  --features N     number of features [%lu]\n", (unsigned long)opt.nFeatures);
+    printf("  --classes N      number of classes, clusters or outputs [%lu]\n", (unsigned long)opt.nClasses);
+    printf("  --blocks N       number of blocks in the online and distributed modes [%lu]\n", (unsigned long)opt.nBlocks);
+    printf("  --iterations N   number of iterations of the iterative algorithms [%lu]\n", (unsigned long)opt.nIterations);
+    printf("  --warmups N      number of runs excluded from the measurements [%lu]\n", (unsigned long)opt.nWarmups);
+    printf("  --repeats N      number of measured runs [%lu]\n", (unsigned long)opt.nRepeats);
+    printf("  --sparsity X     fraction of zero values, CSR numeric tables are used if positive [%g]\n", opt.sparsity);
+    printf("  --dtype T        floating-point type: float or double [%s]\n", opt.dtype.c_str());
+    printf("  --mode M         processing mode: batch, online, distributed or all [%s]\n", opt.mode.c_str());
+    printf("  --seed N         seed of the data set generator [%u]\n", opt.seed);
+    printf("  --output FILE    file for the results in the JSON format\n");
+    printf("  --baseline FILE  file with the baseline results to compare with\n");
+    printf("  --tolerance X    relative slowdown or memory growth reported as a regression [%g]\n", opt.tolerance);
+}
+
+void setDefaultBenchOptions(BenchOptions &opt)
+{
+    opt.nRows       = 100000;
+    opt.nFeatures   = 50;
+    opt.nClasses    = 10;
+    opt.nBlocks     = 4;
+    opt.nIterations = 5;
+    opt.nWarmups    = 1;
+    opt.nRepeats    = 10;
+    opt.sparsity    = 0.0;
+    opt.tolerance   = 0.1;
+    opt.seed        = 777;
+    opt.dtype       = "double";
+    opt.mode        = "all";
+}
+
+/* Parses the command line. Returns false if the program must exit */
+bool parseBenchOptions(int argc, char *argv[], BenchOptions &opt)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string key(argv[i]);
+        if (key == "--help" || key == "-h")
+        {
+            printBenchUsage(argv[0], opt);
+            return false;
+        }
+        if (i + 1 == argc)
+        {
+            printf("Missing value of the option %s\n", key.c_str());
+            return false;
+        }
+        const char *value = argv[++i];
+
+        if      (key == "--rows")       { opt.nRows       = (size_t)atol(value); }
+        else if (key == "--features")   { opt.nFeatures   = (size_t)atol(value); }
+        else if (key == "--classes")    { opt.nClasses    = (size_t)atol(value); }
+        else if (key == "--blocks")     { opt.nBlocks     = (size_t)atol(value); }
+        else if (key == "--iterations") { opt.nIterations = (size_t)atol(value); }
+        else if (key == "--warmups")    { opt.nWarmups    = (size_t)atol(value); }
+        else if (key == "--repeats")    { opt.nRepeats    = (size_t)atol(value); }
+        else if (key == "--sparsity")   { opt.sparsity    = atof(value); }
+        else if (key == "--tolerance")  { opt.tolerance   = atof(value); }
+        else if (key == "--seed")       { opt.seed        = (unsigned int)atol(value); }
+        else if (key == "--dtype")      { opt.dtype       = value; }
+        else if (key == "--mode")       { opt.mode        = value; }
+        else if (key == "--output")     { opt.output      = value; }
+        else if (key == "--baseline")   { opt.baseline    = value; }
+        else
+        {
+            printf("Unknown option %s\n", key.c_str());
+            printBenchUsage(argv[0], opt);
+            return false;
+        }
+    }
+
+    if (opt.dtype != "float" && opt.dtype != "double")
+    {
+        printf("Unsupported floating-point type %s\n", opt.dtype.c_str());
+        return false;
+    }
+    if (opt.nRows == 0 || opt.nFeatures == 0 || opt.nClasses < 2 || opt.nBlocks == 0 || opt.nBlocks > opt.nRows ||
+        opt.nRepeats == 0 || opt.sparsity < 0.0 || opt.sparsity >= 1.0)
+    {
+        printf("Incorrect parameters of the benchmark\n");
+        return false;
+    }
+    return true;
+}
+
+/* Returns true if the benchmarks of the processing mode are requested */
+bool isBenchModeEnabled(const BenchOptions &opt, const char *mode)
+{
+    return (opt.mode == "all" || opt.mode == mode);
+}
+
+/* Returns the name of the benchmark case that includes the parameters of the data set */
+std::string getBenchCaseName(const BenchOptions &opt, const std::string &algorithm, const std::string &mode, size_t nRows)
+{
+    std::ostringstream name;
+    name << algorithm << "/" << mode << "/" << opt.dtype << "/" << (opt.sparsity > 0.0 ? "csr" : "dense")
+         << "/n=" << nRows << ",p=" << opt.nFeatures;
+    if (opt.sparsity > 0.0) { name << ",sparsity=" << opt.sparsity; }
+    return name.str();
+}
+
+/* Returns the size of the generated data set in bytes */
+template <typename FPType>
+size_t getBenchDataSize(const BenchOptions &opt, size_t nRows)
+{
+    double nValues = (double)nRows * (double)opt.nFeatures * (1.0 - opt.sparsity);
+    size_t valueSize = sizeof(FPType) + (opt.sparsity > 0.0 ? sizeof(size_t) : 0);
+    return (size_t)(nValues * valueSize);
+}
+
+/*
+ *  Generator of the synthetic data sets. The observation i belongs to the class i % nClasses.
+ *  The non-zero values of the features are non-negative and grouped around the center of the class,
+ *  so the data sets are suitable for clustering, classification and the multinomial naive Bayes
+ */
+class BenchDataGenerator
+{
+public:
+    BenchDataGenerator(const BenchOptions &opt) : _opt(opt), _state(opt.seed) {}
+
+    /* Returns a block of observations. firstRow is the index of the first observation in the whole data set */
+    template <typename FPType>
+    services::SharedPtr<NumericTable> generateData(size_t nRows, size_t firstRow = 0)
+    {
+        if (_opt.sparsity > 0.0)
+        {
+            return generateSparseData<FPType>(nRows, firstRow);
+        }
+
+        HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(_opt.nFeatures, nRows, NumericTable::doAllocate);
+        FPType *data = table->getArray();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = 0; j < _opt.nFeatures; j++)
+            {
+                data[i * _opt.nFeatures + j] = (FPType)getValue(firstRow + i, j);
+            }
+        }
+        return services::SharedPtr<NumericTable>(table);
+    }
+
+    /* Splits the data set of nRows observations into nBlocks blocks of the same size */
+    template <typename FPType>
+    std::vector<services::SharedPtr<NumericTable> > generateDataBlocks(size_t nRows, size_t nBlocks)
+    {
+        const size_t nRowsInBlock = nRows / nBlocks;
+        std::vector<services::SharedPtr<NumericTable> > blocks(nBlocks);
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            blocks[i] = generateData<FPType>(nRowsInBlock, i * nRowsInBlock);
+        }
+        return blocks;
+    }
+
+    /* Returns the classes of the observations: 0 ... nClasses-1, or -1 and 1 if twoClassLabels is true */
+    template <typename FPType>
+    services::SharedPtr<NumericTable> generateLabels(size_t nRows, size_t firstRow = 0, bool twoClassLabels = false)
+    {
+        HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(1, nRows, NumericTable::doAllocate);
+        FPType *labels = table->getArray();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            size_t label = (firstRow + i) % _opt.nClasses;
+            labels[i] = (twoClassLabels ? (label % 2 == 0 ? (FPType)(-1.0) : (FPType)1.0) : (FPType)label);
+        }
+        return services::SharedPtr<NumericTable>(table);
+    }
+
+    /* Returns the observations as a tensor of size nRows x nFeatures */
+    template <typename FPType>
+    services::SharedPtr<Tensor> generateTensor(size_t nRows)
+    {
+        services::Collection<size_t> dims;
+        dims.push_back(nRows);
+        dims.push_back(_opt.nFeatures);
+        HomogenTensor<FPType> *tensor = new HomogenTensor<FPType>(dims, Tensor::doAllocate);
+        FPType *data = tensor->getArray();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = 0; j < _opt.nFeatures; j++)
+            {
+                data[i * _opt.nFeatures + j] = (FPType)getValue(i, j);
+            }
+        }
+        return services::SharedPtr<Tensor>(tensor);
+    }
+
+    /* Writes the observations to a file in the CSV format */
+    bool writeCSV(const std::string &fileName, size_t nRows)
+    {
+        FILE *f = fopen(fileName.c_str(), "w");
+        if (!f) { return false; }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = 0; j < _opt.nFeatures; j++)
+            {
+                fprintf(f, (j + 1 < _opt.nFeatures ? "%.6g," : "%.6g\n"), getValue(i, j));
+            }
+        }
+        return (fclose(f) == 0);
+    }
+
+private:
+    template <typename FPType>
+    services::SharedPtr<NumericTable> generateSparseData(size_t nRows, size_t firstRow)
+    {
+        std::vector<FPType> values;
+        std::vector<size_t> colIndices;
+        std::vector<size_t> rowOffsets(nRows + 1);
+        rowOffsets[0] = 1;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = 0; j < _opt.nFeatures; j++)
+            {
+                if (getUniform() < _opt.sparsity) { continue; }
+                values.push_back((FPType)getValue(firstRow + i, j));
+                colIndices.push_back(j + 1);
+            }
+            /* Every observation has at least one non-zero value */
+            if (values.size() + 1 == rowOffsets[i])
+            {
+                size_t j = (firstRow + i) % _opt.nFeatures;
+                values.push_back((FPType)getValue(firstRow + i, j));
+                colIndices.push_back(j + 1);
+            }
+            rowOffsets[i + 1] = values.size() + 1;
+        }
+
+        CSRNumericTable *table = new CSRNumericTable((FPType *)0, 0, 0, _opt.nFeatures, nRows);
+        table->allocateDataMemory(values.size());
+        FPType *tableValues;
+        size_t *tableColIndices, *tableRowOffsets;
+        table->getArrays((void **)&tableValues, &tableColIndices, &tableRowOffsets);
+        std::copy(values.begin(), values.end(), tableValues);
+        std::copy(colIndices.begin(), colIndices.end(), tableColIndices);
+        std::copy(rowOffsets.begin(), rowOffsets.end(), tableRowOffsets);
+        return services::SharedPtr<NumericTable>(table);
+    }
+
+    /* Returns the value of the feature j of the observation i: the center of the class plus a noise */
+    double getValue(size_t i, size_t j)
+    {
+        size_t label = i % _opt.nClasses;
+        double center = (double)((label * 7 + j * 3) % 10);
+        return center + getUniform();
+    }
+
+    /* Returns a pseudo-random number uniformly distributed on [0, 1) */
+    double getUniform()
+    {
+        _state = _state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (double)(_state >> 11) / 9007199254740992.0;
+    }
+
+    const BenchOptions &_opt;
+    unsigned long long _state;
+};
+
+/* Returns the current time in milliseconds */
+double getBenchTime()
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec * 1.0e3 + (double)t.tv_nsec * 1.0e-6;
+#else
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    return (double)t.tv_sec * 1.0e3 + (double)t.tv_usec * 1.0e-3;
+#endif
+}
+
+/* Returns the value in kilobytes of the field of /proc/self/status, or a negative value if it is not available */
+double getBenchProcStatusValue(const char *field)
+{
+    FILE *f = fopen("/proc/self/status", "r");
+    if (!f) { return -1.0; }
+
+    double value = -1.0;
+    const size_t fieldLength = strlen(field);
+    char line[256];
+    while (fgets(line, sizeof(line), f))
+    {
+        if (strncmp(line, field, fieldLength) == 0 && line[fieldLength] == ':')
+        {
+            value = atof(line + fieldLength + 1);
+            break;
+        }
+    }
+    fclose(f);
+    return value;
+}
+
+/* Returns the current resident set size of the process in megabytes */
+double getBenchRSS()
+{
+    double rss = getBenchProcStatusValue("VmRSS");
+    return (rss >= 0.0 ? rss / 1024.0 : 0.0);
+}
+
+/*
+ *  Resets the peak resident set size of the process to the current one, so the peak of the next
+ *  benchmark case does not include the peaks of the previous cases. Returns false if the system does not support it
+ */
+bool resetBenchPeakRSS()
+{
+    FILE *f = fopen("/proc/self/clear_refs", "w");
+    if (!f) { return false; }
+    bool isReset = (fputs("5", f) >= 0);
+    return (fclose(f) == 0 && isReset);
+}
+
+/* Returns the peak resident set size of the process in megabytes */
+double getBenchPeakRSS()
+{
+    double peakRSS = getBenchProcStatusValue("VmHWM");
+    if (peakRSS >= 0.0) { return peakRSS / 1024.0; }
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0.0; }
+#if defined(__APPLE__)
+    return (double)usage.ru_maxrss / (1024.0 * 1024.0);    /* Bytes */
+#else
+    return (double)usage.ru_maxrss / 1024.0;               /* Kilobytes */
+#endif
+}
+
+/*
+ *  Measures the memory of a benchmark case: the growth of the peak resident set size of the process
+ *  over the resident set size before the case. If the system cannot reset the peak, the growth
+ *  of the peak of the process is used, it is zero for the cases that stay below the peaks of the previous cases
+ */
+class BenchMemoryMeter
+{
+public:
+    BenchMemoryMeter() : _startRSS(getBenchRSS()), _isPeakReset(resetBenchPeakRSS())
+    {
+        if (!_isPeakReset) { _startRSS = getBenchPeakRSS(); }
+    }
+
+    /* Returns the growth of the resident set size since the construction in megabytes */
+    double getGrowth() const
+    {
+        double growth = getBenchPeakRSS() - _startRSS;
+        return (growth > 0.0 ? growth : 0.0);
+    }
+
+private:
+    double _startRSS;
+    bool _isPeakReset;
+};
+
+/* Returns the percentile of the sorted latencies with the nearest-rank method */
+double getBenchPercentile(const std::vector<double> &sortedLatencies, double percentile)
+{
+    size_t rank = (size_t)(percentile / 100.0 * (double)sortedLatencies.size() + 0.5);
+    rank = (rank > 0 ? rank - 1 : 0);
+    rank = (rank < sortedLatencies.size() ? rank : sortedLatencies.size() - 1);
+    return sortedLatencies[rank];
+}
+
+/* Returns the value of the numeric field of the JSON record written by BenchReport */
+bool getBenchJSONValue(const std::string &record, const char *key, double &value)
+{
+    std::string pattern = std::string("\"") + key + "\": ";
+    size_t pos = record.find(pattern);
+    if (pos == std::string::npos) { return false; }
+    value = atof(record.c_str() + pos + pattern.size());
+    return true;
+}
+
+/* Runs the benchmark cases, prints and stores the measurements and compares them with the baseline */
+class BenchReport
+{
+public:
+    BenchReport(const BenchOptions &opt) : _opt(opt), _nFailures(0)
+    {
+        printf("%-64s %12s %10s %10s %10s %10s %10s\n",
+               "Benchmark", "Rows/s", "MB/s", "p50, ms", "p90, ms", "p99, ms", "+RSS, MB");
+    }
+
+    /* Measures the benchmark case */
+    void measure(BenchCase &benchCase)
+    {
+        std::vector<double> latencies(_opt.nRepeats);
+        BenchMemoryMeter memoryMeter;
+        try
+        {
+            for (size_t i = 0; i < _opt.nWarmups; i++)
+            {
+                benchCase.setUp();
+                benchCase.run();
+            }
+
+            for (size_t i = 0; i < _opt.nRepeats; i++)
+            {
+                benchCase.setUp();
+                double start = getBenchTime();
+                benchCase.run();
+                latencies[i] = getBenchTime() - start;
+            }
+        }
+        catch (services::Exception &e)
+        {
+            fail(benchCase.getName(), e.what());
+            return;
+        }
+
+        BenchRecord r;
+        r.name  = benchCase.getName();
+        r.nRows = benchCase.getNumberOfRows();
+        r.nRuns = _opt.nRepeats;
+
+        double sum = 0.0;
+        for (size_t i = 0; i < latencies.size(); i++) { sum += latencies[i]; }
+        std::sort(latencies.begin(), latencies.end());
+
+        r.latencyMin  = latencies.front();
+        r.latencyMax  = latencies.back();
+        r.latencyMean = sum / (double)latencies.size();
+        r.latencyP50  = getBenchPercentile(latencies, 50.0);
+        r.latencyP90  = getBenchPercentile(latencies, 90.0);
+        r.latencyP99  = getBenchPercentile(latencies, 99.0);
+
+        double seconds = (r.latencyP50 > 0.0 ? r.latencyP50 * 1.0e-3 : 1.0e-9);
+        r.throughput = (double)r.nRows / seconds;
+        r.bandwidth  = (double)benchCase.getNumberOfBytes() / (1024.0 * 1024.0) / seconds;
+        r.peakRSSGrowth = memoryMeter.getGrowth();
+
+        printf("%-64s %12.0f %10.1f %10.3f %10.3f %10.3f %10.1f\n", r.name.c_str(),
+               r.throughput, r.bandwidth, r.latencyP50, r.latencyP90, r.latencyP99, r.peakRSSGrowth);
+        _records.push_back(r);
+    }
+
+    /* Adds a failure of the benchmark case */
+    void fail(const std::string &name, const char *description)
+    {
+        printf("%-64s FAILED: %s\n", name.c_str(), description);
+        _nFailures++;
+    }
+
+    /* Writes the results, compares them with the baseline and returns the exit code of the benchmark */
+    int finish()
+    {
+        if (!_opt.output.empty() && !writeJSON(_opt.output))
+        {
+            printf("Failed to write the results to %s\n", _opt.output.c_str());
+            return 1;
+        }
+        size_t nRegressions = (_opt.baseline.empty() ? 0 : compareWithBaseline(_opt.baseline));
+        if (_nFailures > 0) { return 1; }
+        return (nRegressions > 0 ? benchRegressionExitCode : 0);
+    }
+
+private:
+    bool writeJSON(const std::string &fileName) const
+    {
+        FILE *f = fopen(fileName.c_str(), "w");
+        if (!f) { return false; }
+
+        fprintf(f, "{\n\"results\": [");
+        for (size_t i = 0; i < _records.size(); i++)
+        {
+            const BenchRecord &r = _records[i];
+            fprintf(f, "%s\n{\"name\": \"%s\", \"rows\": %lu, \"runs\": %lu, \"throughput\": %.6g, \"bandwidth\": %.6g, "
+                    "\"latencyMin\": %.6g, \"latencyMean\": %.6g, \"latencyP50\": %.6g, \"latencyP90\": %.6g, "
+                    "\"latencyP99\": %.6g, \"latencyMax\": %.6g, \"peakRSSGrowth\": %.6g}",
+                    (i > 0 ? "," : ""), r.name.c_str(), (unsigned long)r.nRows, (unsigned long)r.nRuns, r.throughput, r.bandwidth,
+                    r.latencyMin, r.latencyMean, r.latencyP50, r.latencyP90, r.latencyP99, r.latencyMax, r.peakRSSGrowth);
+        }
+        fprintf(f, "\n],\n\"timeUnit\": \"ms\",\n\"memoryUnit\": \"MB\"\n}\n");
+        return (fclose(f) == 0);
+    }
+
+    /* Returns the number of the benchmark cases slower or larger than in the baseline */
+    size_t compareWithBaseline(const std::string &fileName) const
+    {
+        std::ifstream file(fileName.c_str());
+        if (!file.is_open())
+        {
+            printf("Baseline %s is not available, comparison is skipped\n", fileName.c_str());
+            return 0;
+        }
+
+        size_t nRegressions = 0, nCompared = 0;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            for (size_t i = 0; i < _records.size(); i++)
+            {
+                const BenchRecord &r = _records[i];
+                if (line.find("\"name\": \"" + r.name + "\"") == std::string::npos) { continue; }
+
+                double throughput, peakRSSGrowth;
+                if (!getBenchJSONValue(line, "throughput", throughput) || !getBenchJSONValue(line, "peakRSSGrowth", peakRSSGrowth))
+                {
+                    continue;
+                }
+                nCompared++;
+
+                double speedup = r.throughput / throughput;
+                bool isSlower = (speedup < 1.0 - _opt.tolerance);
+                bool isLarger = (r.peakRSSGrowth > peakRSSGrowth * (1.0 + _opt.tolerance) + benchMemoryToleranceMB);
+                if (isSlower || isLarger)
+                {
+                    printf("REGRESSION %s: throughput %.0f vs %.0f (x%.2f), peak RSS growth %.1f MB vs %.1f MB\n",
+                           r.name.c_str(), r.throughput, throughput, speedup, r.peakRSSGrowth, peakRSSGrowth);
+                    nRegressions++;
+                }
+            }
+        }
+        printf("Compared with %s: %lu of %lu benchmarks, %lu regressions\n", fileName.c_str(),
+               (unsigned long)nCompared, (unsigned long)_records.size(), (unsigned long)nRegressions);
+        return nRegressions;
+    }
+
+    const BenchOptions &_opt;
+    std::vector<BenchRecord> _records;
+    size_t _nFailures;
+};
+
+#endif
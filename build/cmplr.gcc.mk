@@ -30,10 +30,14 @@ COMPILER.lnx.gcc = g++ -D__int64="long long" -D__int32="int" -m64
 
 link.dynamic.lnx.gcc = g++ -m64
 
-p4_OPT.gcc   = $(-Q)mcpu=power8 -mtune=power8
-mc_OPT.gcc   = $(-Q)mcpu=power8 -mtune=power8
-mc3_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8
-avx_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8
-avx2_OPT.gcc = $(-Q)mcpu=power8 -mtune=power8
-knl_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8
-skx_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8
+# Floating-point exceptions are not used by the library, so the loops with the conditional
+# selects (e.g. the vector math functions in service_math_vec.h) are vectorized for VSX
+vec_OPT.gcc  = -fno-trapping-math -ftree-vectorize -fvect-cost-model=cheap
+
+p4_OPT.gcc   = $(-Q)mcpu=power8 -mtune=power8 $(vec_OPT.gcc)
+mc_OPT.gcc   = $(-Q)mcpu=power8 -mtune=power8 $(vec_OPT.gcc)
+mc3_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8 $(vec_OPT.gcc)
+avx_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8 $(vec_OPT.gcc)
+avx2_OPT.gcc = $(-Q)mcpu=power8 -mtune=power8 $(vec_OPT.gcc)
+knl_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8 $(vec_OPT.gcc)
+skx_OPT.gcc  = $(-Q)mcpu=power8 -mtune=power8 $(vec_OPT.gcc)
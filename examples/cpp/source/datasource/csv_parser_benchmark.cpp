@@ -0,0 +1,160 @@
+/* file: csv_parser_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ micro-benchmark of parsing of CSV data.
+!    Compares the batch parser of the CSV feature manager with the parser based on string streams
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-CSV_PARSER_BENCHMARK"></a>
+ * \example csv_parser_benchmark.cpp
+ */
+
+#include <ctime>
+#include <cstdio>
+#include <sstream>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace data_management;
+
+const size_t nRows        = 200000;  /* Number of rows in the generated CSV data */
+const size_t nFeatures    = 20;      /* Number of features in a row */
+const size_t nCategories  = 50;      /* Number of categories of the last feature */
+const size_t nRowsInBlock = 10000;   /* Number of rows loaded from the data source at once */
+
+/* Feature manager that parses every value with a string stream, one row per block of the numeric table */
+class StreamCSVFeatureManager : public CSVFeatureManager
+{
+public:
+    void parseRowIn(char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, NumericTable *nt, size_t ntRowIndex)
+    {
+        std::stringstream ssLine(rawRowData);
+        char *word = new char[rawDataSize];
+
+        size_t nCols = nt->getNumberOfColumns();
+
+        BlockDescriptor<double> block;
+        nt->getBlockOfRows(ntRowIndex, 1, writeOnly, block);
+        double *row = block.getBlockPtr();
+
+        for (size_t i = 0; i < nCols; i++)
+        {
+            ssLine.getline(word, rawDataSize, _delimiter);
+            if (ssLine.fail()) { break; }
+
+            DataSourceFeature &dsFeat = (*dict)[i];
+            if (dsFeat.ntFeature.featureType == data_feature_utils::DAAL_CONTINUOUS)
+            {
+                std::istringstream iss(word);
+                double f = 0;
+                iss >> f;
+                row[i] = (iss.fail() ? 0 : f);
+            }
+            else
+            {
+                row[i] = dsFeat.getCategoricalDictionary()->insert(word, strlen(word));
+            }
+        }
+
+        delete[] word;
+        nt->releaseBlockOfRows(block);
+    }
+
+    void parseRowsIn(char **rawRowsData, const size_t *rawRowsSizes, size_t nRows, DataSourceDictionary *dict,
+                     NumericTable *nt, size_t ntRowIndex)
+    {
+        StringRowFeatureManagerIface::parseRowsIn(rawRowsData, rawRowsSizes, nRows, dict, nt, ntRowIndex);
+    }
+};
+
+string generateCSV();
+
+template <typename FeatureManager>
+double parse(const string &csv, double &checkSum);
+
+int main(int argc, char *argv[])
+{
+    string csv = generateCSV();
+    double sizeInGB = (double)csv.size() / (1024.0 * 1024.0 * 1024.0);
+
+    double streamCheckSum, batchCheckSum;
+    double streamTime = parse<StreamCSVFeatureManager>(csv, streamCheckSum);
+    double batchTime  = parse<CSVFeatureManager>(csv, batchCheckSum);
+
+    printf("Rows: %lu, features: %lu, size: %.1f MB\n", (unsigned long)nRows, (unsigned long)nFeatures,
+           (double)csv.size() / (1024.0 * 1024.0));
+    printf("%-16s %12s %12s %10s\n", "Parser", "Rows/s", "GB/s", "Time, s");
+    printf("%-16s %12.0f %12.3f %10.3f\n", "string stream", nRows / streamTime, sizeInGB / streamTime, streamTime);
+    printf("%-16s %12.0f %12.3f %10.3f\n", "batch", nRows / batchTime, sizeInGB / batchTime, batchTime);
+    printf("Speedup: %.2f, results %s\n", streamTime / batchTime,
+           (streamCheckSum == batchCheckSum ? "match" : "do not match"));
+
+    return 0;
+}
+
+/* Generates rows of continuous features followed by one categorical feature */
+string generateCSV()
+{
+    string csv;
+    char value[32];
+    unsigned int seed = 777;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j + 1 < nFeatures; j++)
+        {
+            seed = seed * 1103515245 + 12345;
+            sprintf(value, "%.6f,", (double)(seed % 2000000) / 1000.0 - 1000.0);
+            csv += value;
+        }
+        seed = seed * 1103515245 + 12345;
+        sprintf(value, "category%u\n", seed % nCategories);
+        csv += value;
+    }
+    return csv;
+}
+
+/* Loads all rows of the CSV data and returns the time of parsing in seconds */
+template <typename FeatureManager>
+double parse(const string &csv, double &checkSum)
+{
+    StringDataSource<FeatureManager> dataSource((const byte *)csv.c_str(), DataSource::doAllocateNumericTable,
+                                                DataSource::doDictionaryFromContext, nRowsInBlock);
+
+    checkSum = 0;
+    clock_t start = clock();
+    size_t nLoadedRows;
+    while ((nLoadedRows = dataSource.loadDataBlock(nRowsInBlock)) > 0)
+    {
+        services::SharedPtr<NumericTable> table = dataSource.getNumericTable();
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, nLoadedRows, readOnly, block);
+        double *data = block.getBlockPtr();
+        for (size_t i = 0; i < nLoadedRows * nFeatures; i++)
+        {
+            checkSum += data[i];
+        }
+        table->releaseBlockOfRows(block);
+        if (nLoadedRows < nRowsInBlock) { break; }
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
@@ -0,0 +1,175 @@
+/* file: soa_aos_block_access_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ micro-benchmark of reading blocks of rows from structure of arrays (SOA)
+!    and array of structures (AOS) numeric tables.
+!    Compares getBlockOfRows with the conversion of the features one by one
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SOA_AOS_BLOCK_ACCESS_BENCHMARK"></a>
+ * \example soa_aos_block_access_benchmark.cpp
+ */
+
+#include <ctime>
+#include <cstdio>
+#include <vector>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace data_management;
+
+const size_t nRows        = 200000;  /* Number of rows in the numeric tables */
+const size_t nFeatures    = 16;      /* Number of features in a row */
+const size_t nRowsInBlock = 4096;    /* Number of rows read from the numeric table at once */
+const size_t nRepeats     = 20;      /* Number of passes over the numeric table */
+
+/* Observation of the AOS numeric table. The identifier is not a feature of the table */
+struct Observation
+{
+    float values[nFeatures];
+    int id;
+};
+
+/* Reads the blocks of rows with getBlockOfRows and returns the time in seconds */
+double readBlocks(NumericTable &table, vector<double> &rows);
+
+/* Reads the blocks of rows converting the features one by one and returns the time in seconds */
+double readColumnsSOA(SOANumericTable &table, vector<double> &rows);
+double readColumnsAOS(AOSNumericTable &table, vector<double> &rows);
+
+int main(int argc, char *argv[])
+{
+    vector<float> columns(nFeatures * nRows);
+    vector<Observation> observations(nRows);
+    unsigned int seed = 777;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            seed = seed * 1103515245 + 12345;
+            float value = (float)(seed % 2000000) / 1000.0f - 1000.0f;
+            columns[j * nRows + i] = value;
+            observations[i].values[j] = value;
+        }
+        observations[i].id = (int)i;
+    }
+
+    SOANumericTable soaTable(nFeatures, nRows);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        soaTable.setArray<float>(&columns[j * nRows], j);
+    }
+
+    AOSNumericTable aosTable(&observations[0], nFeatures, nRows);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        aosTable.setFeature<float>(j, DAAL_STRUCT_MEMBER_OFFSET(Observation, values) + j * sizeof(float));
+    }
+
+    vector<double> blockRows(nRows * nFeatures), columnRows(nRows * nFeatures);
+
+    double soaColumnTime = readColumnsSOA(soaTable, columnRows);
+    double soaBlockTime  = readBlocks(soaTable, blockRows);
+    bool soaMatch = (blockRows == columnRows);
+
+    double aosColumnTime = readColumnsAOS(aosTable, columnRows);
+    double aosBlockTime  = readBlocks(aosTable, blockRows);
+    bool aosMatch = (blockRows == columnRows);
+
+    double sizeInGB = (double)(nRows * nFeatures * sizeof(float) * nRepeats) / (1024.0 * 1024.0 * 1024.0);
+
+    printf("Rows: %lu, features: %lu, passes: %lu\n", (unsigned long)nRows, (unsigned long)nFeatures, (unsigned long)nRepeats);
+    printf("%-6s %-16s %12s %10s\n", "Layout", "Access", "GB/s", "Time, s");
+    printf("%-6s %-16s %12.3f %10.3f\n", "SOA", "by features", sizeInGB / soaColumnTime, soaColumnTime);
+    printf("%-6s %-16s %12.3f %10.3f\n", "SOA", "getBlockOfRows", sizeInGB / soaBlockTime, soaBlockTime);
+    printf("%-6s %-16s %12.3f %10.3f\n", "AOS", "by features", sizeInGB / aosColumnTime, aosColumnTime);
+    printf("%-6s %-16s %12.3f %10.3f\n", "AOS", "getBlockOfRows", sizeInGB / aosBlockTime, aosBlockTime);
+    printf("SOA speedup: %.2f, results %s\n", soaColumnTime / soaBlockTime, (soaMatch ? "match" : "do not match"));
+    printf("AOS speedup: %.2f, results %s\n", aosColumnTime / aosBlockTime, (aosMatch ? "match" : "do not match"));
+
+    return 0;
+}
+
+double readBlocks(NumericTable &table, vector<double> &rows)
+{
+    clock_t start = clock();
+    for (size_t r = 0; r < nRepeats; r++)
+    {
+        for (size_t i = 0; i < nRows; i += nRowsInBlock)
+        {
+            BlockDescriptor<double> block;
+            table.getBlockOfRows(i, nRowsInBlock, readOnly, block);
+            double *data = block.getBlockPtr();
+            size_t nBlockValues = block.getNumberOfRows() * nFeatures;
+            for (size_t k = 0; k < nBlockValues; k++)
+            {
+                rows[i * nFeatures + k] = data[k];
+            }
+            table.releaseBlockOfRows(block);
+        }
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+double readColumnsSOA(SOANumericTable &table, vector<double> &rows)
+{
+    NumericTableDictionary *dict = table.getDictionary();
+    double buffer[32];
+    clock_t start = clock();
+    for (size_t r = 0; r < nRepeats; r++)
+    {
+        for (size_t i = 0; i < nRows; i += 32)
+        {
+            size_t di = (i + 32 < nRows ? 32 : nRows - i);
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                NumericTableFeature &f = (*dict)[j];
+                char *ptr = (char *)table.getArray(j) + i * f.typeSize;
+                data_feature_utils::vectorUpCast[f.indexType][data_feature_utils::getInternalNumType<double>()](di, ptr, buffer);
+                for (size_t ii = 0; ii < di; ii++)
+                {
+                    rows[(i + ii) * nFeatures + j] = buffer[ii];
+                }
+            }
+        }
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+double readColumnsAOS(AOSNumericTable &table, vector<double> &rows)
+{
+    NumericTableDictionary *dict = table.getDictionary();
+    char *ptr = (char *)table.getArray();
+    clock_t start = clock();
+    for (size_t r = 0; r < nRepeats; r++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            NumericTableFeature &f = (*dict)[j];
+            char *location = ptr + DAAL_STRUCT_MEMBER_OFFSET(Observation, values) + j * sizeof(float);
+            data_feature_utils::vectorStrideUpCast[f.indexType][data_feature_utils::getInternalNumType<double>()]
+            (nRows, location, sizeof(Observation), &rows[j], sizeof(double) * nFeatures);
+        }
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
@@ -0,0 +1,71 @@
+/* file: nearest_neighbors_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the search of the nearest neighbors in terms of the cosine distance
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-NEAREST_NEIGHBORS_BATCH"></a>
+ * \example nearest_neighbors_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/distance.csv";
+const size_t nQueries   = 10;
+const size_t nNeighbors = 5;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the reference data from a .csv file */
+    FileDataSource<CSVFeatureManager> referenceDataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                          DataSource::doDictionaryFromContext);
+    referenceDataSource.loadDataBlock();
+
+    /* Use the first vectors of the data set as the queries */
+    FileDataSource<CSVFeatureManager> queryDataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+    queryDataSource.loadDataBlock(nQueries);
+
+    /* Create an algorithm to search the nearest neighbors using the default method */
+    nearest_neighbors::Batch<> algorithm(nNeighbors);
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(nearest_neighbors::queryData,     queryDataSource.getNumericTable());
+    algorithm.input.set(nearest_neighbors::referenceData, referenceDataSource.getNumericTable());
+
+    /* Search the nearest neighbors */
+    algorithm.compute();
+
+    /* Get the indices of the nearest neighbors and the distances to them */
+    services::SharedPtr<nearest_neighbors::Result> res = algorithm.getResult();
+
+    printNumericTable(res->get(nearest_neighbors::indices),   "Indices of the nearest neighbors");
+    printNumericTable(res->get(nearest_neighbors::distances), "Cosine distances to the nearest neighbors");
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+/* file: low_order_moments_dense_pipeline.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing low order moments in the online processing mode
+!    with loading of the next data block overlapped with the computation
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOW_ORDER_MOMENTS_DENSE_PIPELINE">
+ * \example low_order_moments_dense_pipeline.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/online/covcormoments_dense.csv";
+const size_t nVectorsInBlock = 50;
+
+void printResults(const services::SharedPtr<low_order_moments::Result> &res);
+
+int main(int argc, char *argv[])
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm to compute low order moments in the online processing mode using the default method */
+    low_order_moments::Online<> algorithm;
+
+    /* Create a pipeline that loads the next data block while the current one is being processed */
+    DataSourcePipeline<> pipeline(dataSource, nVectorsInBlock);
+
+    /* Compute partial low order moments estimates for all data blocks available in the data source */
+    pipeline.run(algorithm, low_order_moments::data);
+
+    /* Finalize the result in the online processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed low order moments */
+    services::SharedPtr<low_order_moments::Result> res = algorithm.getResult();
+
+    printResults(res);
+
+    return 0;
+}
+
+void printResults(const services::SharedPtr<low_order_moments::Result> &res)
+{
+    printNumericTable(res->get(low_order_moments::minimum),              "Minimum:");
+    printNumericTable(res->get(low_order_moments::maximum),              "Maximum:");
+    printNumericTable(res->get(low_order_moments::sum),                  "Sum:");
+    printNumericTable(res->get(low_order_moments::sumSquares),           "Sum of squares:");
+    printNumericTable(res->get(low_order_moments::sumSquaresCentered),   "Sum of squared difference from the means:");
+    printNumericTable(res->get(low_order_moments::mean),                 "Mean:");
+    printNumericTable(res->get(low_order_moments::secondOrderRawMoment), "Second order raw moment:");
+    printNumericTable(res->get(low_order_moments::variance),             "Variance:");
+    printNumericTable(res->get(low_order_moments::standardDeviation),    "Standard deviation:");
+    printNumericTable(res->get(low_order_moments::variation),            "Variation:");
+}
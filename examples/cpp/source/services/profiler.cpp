@@ -0,0 +1,89 @@
+/* file: profiler.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the profiling of the algorithms.
+!    The measurements are collected only if the library is built with REQPROF=yes
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PROFILER"></a>
+ * \example profiler.cpp
+ */
+
+#include <cstdio>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+const char *statisticsFileName = "profiler_statistics.json";
+const char *traceFileName      = "profiler_trace.json";
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+    dataSource.loadDataBlock();
+
+    /* Store every measurement to write the trace for the Chrome* trace viewer */
+    services::ChromeTraceWriter trace;
+    services::Profiler::setCallback(&trace);
+    services::Profiler::enable();
+
+    /* Compute low order moments in single and double precision */
+    low_order_moments::Batch<float> floatAlgorithm;
+    floatAlgorithm.input.set(low_order_moments::data, dataSource.getNumericTable());
+    floatAlgorithm.compute();
+
+    low_order_moments::Batch<double> doubleAlgorithm;
+    doubleAlgorithm.input.set(low_order_moments::data, dataSource.getNumericTable());
+    doubleAlgorithm.compute();
+
+    services::Profiler::disable();
+    services::Profiler::setCallback(NULL);
+
+    /* Print the measurements aggregated by the operations */
+    size_t nStatistics = services::Profiler::getNumberOfStatistics();
+    printf("%-6s %-6s %8s %14s  %s\n", "Type", "CPU", "Count", "Total time, ns", "Operation");
+    for (size_t i = 0; i < nStatistics; i++)
+    {
+        services::ProfilerStatistics statistics;
+        services::Profiler::getStatistics(i, statistics);
+        printf("%-6d %-6d %8lu %14llu  %s\n", (int)statistics.type, statistics.cpu,
+               (unsigned long)statistics.count, statistics.totalTime, statistics.name);
+    }
+
+    if (!services::Profiler::writeJSON(statisticsFileName) || !trace.write(traceFileName))
+    {
+        printf("Failed to write the measurements\n");
+        return 1;
+    }
+    printf("Statistics: %s, trace with %lu events: %s\n", statisticsFileName, (unsigned long)trace.getNumberOfEvents(), traceFileName);
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/* file: thread_arena.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of running an algorithm by the threads of one NUMA node
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-THREAD_ARENA"></a>
+ * \example thread_arena.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName     = "../data/batch/kmeans_dense.csv";
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 20;
+const size_t nIterations = 5;
+
+/* Loads the data set and runs the K-Means algorithm */
+class KMeansTask : public services::ThreadArenaTask
+{
+public:
+    KMeansTask(const services::SharedPtr<services::ThreadArena> &arena) : _arena(arena) {}
+
+    void run()
+    {
+        /* The numeric table is allocated inside the arena with the first touch enabled,
+           so its memory is placed on the NUMA node of the arena */
+        FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+        dataSource.loadDataBlock();
+
+        /* Get initial clusters for the K-Means algorithm */
+        kmeans::init::Batch<double, kmeans::init::randomDense> init(nClusters);
+        init.input.set(kmeans::init::data, dataSource.getNumericTable());
+        init.compute();
+
+        /* Create an algorithm object for the K-Means algorithm that runs in the arena */
+        kmeans::Batch<> algorithm(nClusters, nIterations);
+        algorithm.setThreadArena(_arena);
+
+        algorithm.input.set(kmeans::data,           dataSource.getNumericTable());
+        algorithm.input.set(kmeans::inputCentroids, init.getResult()->get(kmeans::init::centroids));
+        algorithm.compute();
+
+        goalFunction = algorithm.getResult()->get(kmeans::goalFunction);
+    }
+
+    services::SharedPtr<NumericTable> goalFunction;
+
+private:
+    services::SharedPtr<services::ThreadArena> _arena;
+};
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Create the arena with the threads bound to the processors of the first NUMA node */
+    size_t nNodes = services::ThreadArena::getNumberOfNumaNodes();
+    services::Collection<size_t> cpus = services::ThreadArena::getNumaNodeCpus(0);
+    services::SharedPtr<services::ThreadArena> arena(new services::ThreadArena(0, cpus));
+    arena->setFirstTouch(true);
+
+    /* Load the data and run the computations in the arena */
+    KMeansTask task(arena);
+    arena->execute(task);
+
+    cout << "Number of NUMA nodes:             " << nNodes << endl;
+    cout << "Number of processors of node 0:   " << cpus.size() << endl;
+    cout << "Number of threads in the arena:   " << arena->getMaxThreads() << endl;
+    printNumericTable(task.goalFunction, "Goal function value:");
+
+    return 0;
+}
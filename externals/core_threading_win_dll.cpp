@@ -89,21 +89,49 @@ FARPROC load_daal_thr_func(char *ordinal)
 
 typedef void (* _daal_threader_for_t)(int , int , const void *, daal::functype );
 typedef void (* _daal_threader_for_blocked_t)(int , int , const void *, daal::functype2 );
+typedef void (* _daal_threader_for_ex_t)(int , int , int , const void *, daal::functype );
+typedef void (* _daal_threader_for_blocked_ex_t)(int , int , int , const void *, daal::functype2 );
+typedef size_t (* _daal_threader_get_cache_size_t)(void);
+typedef void (* _daal_threader_set_reproducible_t)(int);
+typedef int (* _daal_threader_get_reproducible_t)(void);
 typedef int (* _daal_threader_get_max_threads_t)(void);
 typedef void *(* _daal_get_tls_ptr_t)(void *, daal::tls_functype );
 typedef void (* _daal_del_tls_ptr_t)(void *);
 typedef void *(* _daal_get_tls_local_t)(void *);
 typedef void (* _daal_reduce_tls_t)(void *, void *, daal::tls_reduce_functype );
 typedef size_t (* _setNumberOfThreads_t)(const size_t, void**);
+typedef void *(* _daal_threader_arena_create_t)(int, const size_t *, size_t);
+typedef void (* _daal_threader_arena_execute_t)(void *, const void *, daal::arena_functype );
+typedef int (* _daal_threader_arena_get_max_threads_t)(void *);
+typedef void (* _daal_threader_arena_delete_t)(void *);
+typedef void (* _daal_threader_arena_set_first_touch_t)(void *, int);
+typedef int (* _daal_threader_arena_get_first_touch_t)(void *);
+typedef int (* _daal_threader_get_first_touch_threads_t)();
+typedef size_t (* _daal_numa_get_number_of_nodes_t)(void);
+typedef size_t (* _daal_numa_get_node_cpus_t)(size_t, size_t *, size_t);
 
 static _daal_threader_for_t _daal_threader_for_ptr = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr = NULL;
+static _daal_threader_for_ex_t _daal_threader_for_ex_ptr = NULL;
+static _daal_threader_for_blocked_ex_t _daal_threader_for_blocked_ex_ptr = NULL;
+static _daal_threader_get_cache_size_t _daal_threader_get_cache_size_ptr = NULL;
+static _daal_threader_set_reproducible_t _daal_threader_set_reproducible_ptr = NULL;
+static _daal_threader_get_reproducible_t _daal_threader_get_reproducible_ptr = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr = NULL;
 static _daal_get_tls_ptr_t _daal_get_tls_ptr_ptr = NULL;
 static _daal_del_tls_ptr_t _daal_del_tls_ptr_ptr = NULL;
 static _daal_get_tls_local_t _daal_get_tls_local_ptr = NULL;
 static _daal_reduce_tls_t _daal_reduce_tls_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr = NULL;
+static _daal_threader_arena_create_t _daal_threader_arena_create_ptr = NULL;
+static _daal_threader_arena_execute_t _daal_threader_arena_execute_ptr = NULL;
+static _daal_threader_arena_get_max_threads_t _daal_threader_arena_get_max_threads_ptr = NULL;
+static _daal_threader_arena_delete_t _daal_threader_arena_delete_ptr = NULL;
+static _daal_threader_arena_set_first_touch_t _daal_threader_arena_set_first_touch_ptr = NULL;
+static _daal_threader_arena_get_first_touch_t _daal_threader_arena_get_first_touch_ptr = NULL;
+static _daal_threader_get_first_touch_threads_t _daal_threader_get_first_touch_threads_ptr = NULL;
+static _daal_numa_get_number_of_nodes_t _daal_numa_get_number_of_nodes_ptr = NULL;
+static _daal_numa_get_node_cpus_t _daal_numa_get_node_cpus_ptr = NULL;
 
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void *a, daal::functype func)
 {
@@ -123,6 +151,61 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
     _daal_threader_for_blocked_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_ex(int n, int grainSize, int partitioner, const void *a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_for_ex_ptr == NULL)
+    {
+        _daal_threader_for_ex_ptr
+            = (_daal_threader_for_ex_t)load_daal_thr_func("_daal_threader_for_ex");
+    }
+    _daal_threader_for_ex_ptr(n, grainSize, partitioner, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_ex(int n, int grainSize, int partitioner, const void *a, daal::functype2 func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_for_blocked_ex_ptr == NULL)
+    {
+        _daal_threader_for_blocked_ex_ptr
+            = (_daal_threader_for_blocked_ex_t)load_daal_thr_func("_daal_threader_for_blocked_ex");
+    }
+    _daal_threader_for_blocked_ex_ptr(n, grainSize, partitioner, a, func);
+}
+
+DAAL_EXPORT size_t _daal_threader_get_cache_size()
+{
+    load_daal_thr_dll();
+    if(_daal_threader_get_cache_size_ptr == NULL)
+    {
+        _daal_threader_get_cache_size_ptr
+            = (_daal_threader_get_cache_size_t)load_daal_thr_func("_daal_threader_get_cache_size");
+    }
+    return _daal_threader_get_cache_size_ptr();
+}
+
+DAAL_EXPORT void _daal_threader_set_reproducible(int reproducible)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_set_reproducible_ptr == NULL)
+    {
+        _daal_threader_set_reproducible_ptr
+            = (_daal_threader_set_reproducible_t)load_daal_thr_func("_daal_threader_set_reproducible");
+    }
+    _daal_threader_set_reproducible_ptr(reproducible);
+}
+
+DAAL_EXPORT int _daal_threader_get_reproducible()
+{
+    load_daal_thr_dll();
+    if(_daal_threader_get_reproducible_ptr == NULL)
+    {
+        _daal_threader_get_reproducible_ptr
+            = (_daal_threader_get_reproducible_t)load_daal_thr_func("_daal_threader_get_reproducible");
+    }
+    return _daal_threader_get_reproducible_ptr();
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
@@ -169,6 +252,105 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
     return _setNumberOfThreads_ptr(numThreads, init);
 }
 
+DAAL_EXPORT void *_daal_threader_arena_create(int maxThreads, const size_t *cpus, size_t nCpus)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_arena_create_ptr == NULL)
+    {
+        _daal_threader_arena_create_ptr
+            = (_daal_threader_arena_create_t)load_daal_thr_func("_daal_threader_arena_create");
+    }
+    return _daal_threader_arena_create_ptr(maxThreads, cpus, nCpus);
+}
+
+DAAL_EXPORT void _daal_threader_arena_execute(void *arena, const void *a, daal::arena_functype func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_arena_execute_ptr == NULL)
+    {
+        _daal_threader_arena_execute_ptr
+            = (_daal_threader_arena_execute_t)load_daal_thr_func("_daal_threader_arena_execute");
+    }
+    _daal_threader_arena_execute_ptr(arena, a, func);
+}
+
+DAAL_EXPORT int _daal_threader_arena_get_max_threads(void *arena)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_arena_get_max_threads_ptr == NULL)
+    {
+        _daal_threader_arena_get_max_threads_ptr
+            = (_daal_threader_arena_get_max_threads_t)load_daal_thr_func("_daal_threader_arena_get_max_threads");
+    }
+    return _daal_threader_arena_get_max_threads_ptr(arena);
+}
+
+DAAL_EXPORT void _daal_threader_arena_delete(void *arena)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_arena_delete_ptr == NULL)
+    {
+        _daal_threader_arena_delete_ptr
+            = (_daal_threader_arena_delete_t)load_daal_thr_func("_daal_threader_arena_delete");
+    }
+    _daal_threader_arena_delete_ptr(arena);
+}
+
+DAAL_EXPORT void _daal_threader_arena_set_first_touch(void *arena, int firstTouch)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_arena_set_first_touch_ptr == NULL)
+    {
+        _daal_threader_arena_set_first_touch_ptr
+            = (_daal_threader_arena_set_first_touch_t)load_daal_thr_func("_daal_threader_arena_set_first_touch");
+    }
+    _daal_threader_arena_set_first_touch_ptr(arena, firstTouch);
+}
+
+DAAL_EXPORT int _daal_threader_arena_get_first_touch(void *arena)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_arena_get_first_touch_ptr == NULL)
+    {
+        _daal_threader_arena_get_first_touch_ptr
+            = (_daal_threader_arena_get_first_touch_t)load_daal_thr_func("_daal_threader_arena_get_first_touch");
+    }
+    return _daal_threader_arena_get_first_touch_ptr(arena);
+}
+
+DAAL_EXPORT int _daal_threader_get_first_touch_threads()
+{
+    load_daal_thr_dll();
+    if(_daal_threader_get_first_touch_threads_ptr == NULL)
+    {
+        _daal_threader_get_first_touch_threads_ptr
+            = (_daal_threader_get_first_touch_threads_t)load_daal_thr_func("_daal_threader_get_first_touch_threads");
+    }
+    return _daal_threader_get_first_touch_threads_ptr();
+}
+
+DAAL_EXPORT size_t _daal_numa_get_number_of_nodes()
+{
+    load_daal_thr_dll();
+    if(_daal_numa_get_number_of_nodes_ptr == NULL)
+    {
+        _daal_numa_get_number_of_nodes_ptr
+            = (_daal_numa_get_number_of_nodes_t)load_daal_thr_func("_daal_numa_get_number_of_nodes");
+    }
+    return _daal_numa_get_number_of_nodes_ptr();
+}
+
+DAAL_EXPORT size_t _daal_numa_get_node_cpus(size_t node, size_t *cpus, size_t maxCpus)
+{
+    load_daal_thr_dll();
+    if(_daal_numa_get_node_cpus_ptr == NULL)
+    {
+        _daal_numa_get_node_cpus_ptr
+            = (_daal_numa_get_node_cpus_t)load_daal_thr_func("_daal_numa_get_node_cpus");
+    }
+    return _daal_numa_get_node_cpus_ptr(node, cpus, maxCpus);
+}
+
 #define CALL_VOID_FUNC_FROM_DLL(fn_dpref,fn_name,argdecl,argcall)         \
     typedef void (* ##fn_dpref##fn_name##_t)##argdecl;                    \
     static fn_dpref##fn_name##_t fn_dpref##fn_name##_ptr=NULL;            \
@@ -27,6 +27,7 @@
 
 #include "daal_defines.h"
 #include "service_memory.h"
+#include "service_profiler.h"
 
 //felix
 #include "service_openblas.h"
@@ -38,6 +39,10 @@ namespace internal
 
 /*
 // Template functions definition
+//
+// The OpenBLAS backend runs the level 3 functions in its own threads, so a call from a block
+// of a parallel loop of the threading layer nests the threads. The blocks of the parallel loops
+// use the sequential kernels of service_stat_vec.h and service_distance_tiles.h instead.
 */
 template<typename fpType, CpuType cpu, template<typename, CpuType> class _impl=ob::OpenBlas>
 struct Blas
@@ -47,41 +52,48 @@ struct Blas
     static void xsyrk(char *uplo, char *trans, SizeType *p, SizeType *n, fpType *alpha, fpType *a, SizeType *lda,
                fpType *beta, fpType *ata, SizeType *ldata)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerBlas, "xsyrk", cpu);
         _impl<fpType,cpu>::xsyrk(uplo, trans, p, n, alpha, a, lda, beta, ata, ldata);
     }
 
     static void xsyr(const char *uplo, const SizeType *n, const fpType *alpha,
               const fpType *x, const SizeType *incx, fpType *a, const SizeType *lda)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerBlas, "xsyr", cpu);
         _impl<fpType,cpu>::xsyr(uplo, n, alpha, x, incx, a, lda);
     }
 
     static void xgemm(char *transa, char *transb, SizeType *p, SizeType *ny, SizeType *n, fpType *alpha, fpType *a,
                SizeType *lda, fpType *y, SizeType *ldy, fpType *beta, fpType *aty, SizeType *ldaty)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerBlas, "xgemm", cpu);
         _impl<fpType,cpu>::xgemm(transa, transb, p, ny, n, alpha, a, lda, y, ldy, beta, aty, ldaty);
     }
 
     static void xxgemm(char *transa, char *transb, SizeType *p, SizeType *ny, SizeType *n, fpType *alpha, fpType *a,
                SizeType *lda, fpType *y, SizeType *ldy, fpType *beta, fpType *aty, SizeType *ldaty)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerBlas, "xxgemm", cpu);
         _impl<fpType,cpu>::xxgemm(transa, transb, p, ny, n, alpha, a, lda, y, ldy, beta, aty, ldaty);
     }
 
     static void xsymm(char *side, char *uplo, SizeType *m, SizeType *n, fpType *alpha, fpType *a, SizeType *lda,
                fpType *b, SizeType *ldb, fpType *beta, fpType *c, SizeType *ldc)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerBlas, "xsymm", cpu);
         _impl<fpType,cpu>::xsymm(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     }
 
     static void xgemv(char *trans, SizeType *m, SizeType *n, fpType *alpha, fpType *a, SizeType *lda, fpType *x,
                SizeType *incx, fpType *beta, fpType *y, SizeType *incy)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerBlas, "xgemv", cpu);
         _impl<fpType,cpu>::xgemv(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     }
 
     static void xaxpy(SizeType *n, fpType *a, fpType *x, SizeType *incx, fpType *y, SizeType *incy)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerBlas, "xaxpy", cpu);
         _impl<fpType,cpu>::xaxpy(n, a, x, incx, y, incy);
     }
 };
@@ -27,6 +27,7 @@
 
 #include "daal_defines.h"
 #include "service_memory.h"
+#include "service_profiler.h"
 
 #include "service_lapack_mkl.h"
 
@@ -45,58 +46,68 @@ struct Lapack
 
     static void xpotrf(char *uplo, SizeType *p, fpType *ata, SizeType *ldata, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xpotrf", cpu);
         _impl<fpType,cpu>::xpotrf(uplo, p, ata, ldata, info);
     }
 
     static void xpotrs(char *uplo, SizeType *p, SizeType *ny, fpType *ata, SizeType *ldata, fpType *beta, SizeType *ldaty,
                 SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xpotrs", cpu);
         _impl<fpType,cpu>::xpotrs(uplo, p, ny, ata, ldata, beta, ldaty, info);
     }
 
     static void xpotri(char *uplo, SizeType *p, fpType *ata, SizeType *ldata, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xpotri", cpu);
         _impl<fpType,cpu>::xpotri(uplo, p, ata, ldata, info);
     }
 
     static void xgerqf(SizeType *m, SizeType *n, fpType *a, SizeType *lda, fpType *tau, fpType *work, SizeType *lwork,
                 SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xgerqf", cpu);
         _impl<fpType,cpu>::xgerqf(m, n, a, lda, tau, work, lwork, info);
     }
 
     static void xormrq(char *side, char *trans, SizeType *m, SizeType *n, SizeType *k, fpType *a, SizeType *lda,
                 fpType *tau, fpType *c, SizeType *ldc, fpType *work, SizeType *lwork, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xormrq", cpu);
         _impl<fpType,cpu>::xormrq(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info);
     }
 
     static void xtrtrs(char *uplo, char *trans, char *diag, SizeType *n, SizeType *nrhs,
                 fpType *a, SizeType *lda, fpType *b, SizeType *ldb, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xtrtrs", cpu);
         _impl<fpType,cpu>::xtrtrs(uplo, trans, diag, n, nrhs, a, lda, b, ldb, info);
     }
 
     static void xpptrf(char *uplo, SizeType *n, fpType *ap, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xpptrf", cpu);
         _impl<fpType,cpu>::xpptrf(uplo, n, ap, info);
     }
 
     static void xgeqrf(SizeType m, SizeType n, fpType *a,
                 SizeType lda, fpType *tau, fpType *work, SizeType lwork, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xgeqrf", cpu);
         _impl<fpType,cpu>::xgeqrf(m, n, a, lda, tau, work, lwork, info);
     }
 
     static void xgeqp3(SizeType m, SizeType n, fpType *a,
                 SizeType lda, SizeType *jpvt, fpType *tau, fpType *work, SizeType lwork, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xgeqp3", cpu);
         _impl<fpType,cpu>::xgeqp3(m, n, a, lda, jpvt, tau, work, lwork, info);
     }
 
     static void xorgqr(SizeType m, SizeType n, SizeType k,
                 fpType *a, SizeType lda, fpType *tau, fpType *work, SizeType lwork, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xorgqr", cpu);
         _impl<fpType,cpu>::xorgqr(m, n, k, a, lda, tau, work, lwork, info);
     }
 
@@ -104,12 +115,14 @@ struct Lapack
                 fpType *a, SizeType lda, fpType *s, fpType *u, SizeType ldu, fpType *vt, SizeType ldvt,
                 fpType *work, SizeType lwork, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xgesvd", cpu);
         _impl<fpType,cpu>::xgesvd(jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, work, lwork, info);
     }
 
     static void xsyevd(char *jobz, char *uplo, SizeType *n, fpType *a, SizeType *lda, fpType *w, fpType *work,
                 SizeType *lwork, SizeType *iwork, SizeType *liwork, SizeType *info)
     {
+        __DAAL_PROFILER_CPU_TASK(profilerLapack, "xsyevd", cpu);
         _impl<fpType,cpu>::xsyevd(jobz, uplo, n, a, lda, w, work, lwork, iwork, liwork, info);
     }
 };
@@ -35,7 +35,7 @@ namespace internal
 /*
 // Template functions definition
 */
-template<typename fpType, CpuType cpu, template<typename, CpuType> class _impl=mkl::MklMath>
+template<typename fpType, CpuType cpu, template<typename, CpuType> class _impl=DefaultMath>
 struct Math
 {
     typedef typename _impl<fpType,cpu>::SizeType SizeType;
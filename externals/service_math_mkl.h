@@ -28,6 +28,7 @@
 #include <math.h>
 #include "vmlvsl.h"
 #include "service_defines.h"
+#include "service_math_vec.h"
 
 
 #if !defined(__DAAL_CONCAT5)
@@ -338,6 +339,22 @@ struct MklMath<float, cpu>
 };
 
 }
+
+/*
+// Vector math backend of the CpuType, see VecMathEnabled in service_math_vec.h
+*/
+
+template<typename fpType, CpuType cpu, bool useVecMath>
+struct MathBackend : public vec::VecMath<fpType, cpu> {};
+
+#if defined(DAAL_USE_MKL_VML)
+template<typename fpType, CpuType cpu>
+struct MathBackend<fpType, cpu, false> : public mkl::MklMath<fpType, cpu> {};
+#endif
+
+template<typename fpType, CpuType cpu>
+struct DefaultMath : public MathBackend<fpType, cpu, vec::VecMathEnabled<cpu>::value> {};
+
 }
 }
 
@@ -386,13 +403,13 @@ inline double sSqrt(double in)
 template<CpuType cpu>
 void vPowx(size_t n, float *in, float in1, float *out)
 {
-    VMLFN_CALL(sPowx,HAynn,((int)n, in, in1, out))
+    internal::DefaultMath<float, cpu>::vPowx(n, in, in1, out);
 }
 
 template<CpuType cpu>
 void vPowx(size_t n, double *in, double in1, double *out)
 {
-    VMLFN_CALL(dPowx,HAynn,((int)n, in, in1, out))
+    internal::DefaultMath<double, cpu>::vPowx(n, in, in1, out);
 }
 
 template<CpuType cpu>
@@ -422,13 +439,13 @@ inline double sPowx(double in, double in1)
 template<CpuType cpu>
 void vCeil(size_t n, float *in, float *out)
 {
-    VMLFN_CALL(sCeil,HAynn,((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vCeil(n, in, out);
 }
 
 template<CpuType cpu>
 void vCeil(size_t n, double *in, double *out)
 {
-    VMLFN_CALL(dCeil,HAynn,((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vCeil(n, in, out);
 }
 
 template<CpuType cpu>
@@ -458,13 +475,13 @@ inline double sCeil(double in)
 template<CpuType cpu>
 void vErfInv(size_t n, float *in, float *out)
 {
-    VMLFN_CALL(sErfInv,HAynn,((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vErfInv(n, in, out);
 }
 
 template<CpuType cpu>
 void vErfInv(size_t n, double *in, double *out)
 {
-    VMLFN_CALL(dErfInv,HAynn,((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vErfInv(n, in, out);
 }
 
 template<CpuType cpu>
@@ -502,7 +519,7 @@ void vErf(size_t n, float *in, float *out)
         out[i] = erff(in[i]);
     }
 #else
-    VMLFN_CALL(sErf,HAynn,((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vErf(n, in, out);
 #endif
 }
 
@@ -516,7 +533,7 @@ void vErf(size_t n, double *in, double *out)
         out[i] = erf(in[i]);
     }
 #else
-    VMLFN_CALL(dErf,HAynn,((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vErf(n, in, out);
 #endif
 }
 
@@ -535,7 +552,7 @@ void vExp(size_t n, float* in, float* out)
         out[i] = expf(in[i]);
     }
 #else
-    VMLFN_CALL(sExp,HAynn,((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vExp(n, in, out);
 #endif
 }
 
@@ -549,7 +566,7 @@ void vExp(size_t n, double* in, double* out)
         out[i] = exp(in[i]);
     }
 #else
-    VMLFN_CALL(dExp,HAynn,((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vExp(n, in, out);
 #endif
 }
 
@@ -568,7 +585,7 @@ void vTanh(size_t n, float *in, float *out)
         out[i] = tanhf(in[i]);
     }
 #else
-    VMLFN_CALL(sTanh, HAynn, ((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vTanh(n, in, out);
 #endif
 }
 
@@ -582,7 +599,7 @@ void vTanh(size_t n, double *in, double *out)
         out[i] = tanh(in[i]);
     }
 #else
-    VMLFN_CALL(dTanh, HAynn, ((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vTanh(n, in, out);
 #endif
 }
 
@@ -600,7 +617,7 @@ void vSqrt(size_t n, float *in, float *out)
         out[i] = sqrtf(in[i]);
     }
 #else
-    VMLFN_CALL(sSqrt, HAynn, ((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vSqrt(n, in, out);
 #endif
 }
 
@@ -614,7 +631,7 @@ void vSqrt(size_t n, double *in, double *out)
         out[i] = sqrt(in[i]);
     }
 #else
-    VMLFN_CALL(dSqrt, HAynn, ((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vSqrt(n, in, out);
 #endif
 }
 
@@ -632,7 +649,7 @@ void vLog(size_t n, float *in, float *out)
         out[i] = logf(in[i]);
     }
 #else
-    VMLFN_CALL(sLn,HAynn,((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vLog(n, in, out);
 #endif
 }
 
@@ -646,7 +663,7 @@ void vLog(size_t n, double* in, double* out)
         out[i] = log(in[i]);
     }
 #else
-    VMLFN_CALL(dLn,HAynn,((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vLog(n, in, out);
 #endif
 }
 
@@ -685,7 +702,7 @@ void vLog1p(size_t n, float *in, float *out)
         out[i] = log1pf(in[i]);
     }
 #else
-    VMLFN_CALL(sLog1p,HAynn,((int)n, in, out))
+    internal::DefaultMath<float, cpu>::vLog1p(n, in, out);
 #endif
 }
 
@@ -699,7 +716,7 @@ void vLog1p(size_t n, double* in, double* out)
         out[i] = log1p(in[i]);
     }
 #else
-    VMLFN_CALL(dLog1p,HAynn,((int)n, in, out))
+    internal::DefaultMath<double, cpu>::vLog1p(n, in, out);
 #endif
 }
 
@@ -0,0 +1,840 @@
+/* file: service_math_vec.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Vector math functions implemented in the library without Intel(R) MKL VML.
+//
+//  The functions are evaluated element by element by the branch-free inline kernels,
+//  so that the compiler vectorizes the loops for the instruction set of the CpuType
+//  the kernel is built for (VSX on POWER8, SSE/AVX on Intel(R) architecture).
+//
+//  Maximal errors measured against the long double C library functions on 3*10^7 random
+//  arguments of every range, in units in the last place (ulp) of the result, for the builds
+//  with and without the contraction of the floating-point operations into FMA. The errors are
+//  checked by math_bench built with the sources of the library, see bench/cpp:
+//
+//    function   double   float   range
+//    vExp        0.99     1.06   whole range, overflow to inf, underflow to 0 and denormals
+//    vLog        0.81     0.83   whole range including denormals
+//    vLog1p      1.44     0.50   x > -1
+//    vTanh       2.50     0.50   whole range
+//    vErf        1.67     0.50   whole range
+//    vErfInv     3.45     0.50   -1 < x < 1, the largest errors are at 1 - |x| < 10^-6
+//    vPowx       1.16     0.50   whole range of y * ln(x), |y| <= 1000
+//    vSqrt       0.50     0.50   correctly rounded
+//    vCeil       exact    exact
+//
+//  vPowx computes exp(y * log(x)) with log(x) as the pair of doubles and the exact product with y,
+//  so the error of vPowx is the error of vExp plus 2^-64 * |y * ln(x)| relative. The special cases
+//  of x and y are handled as in the C99 pow().
+//
+//  The float functions except vExp and vLog are evaluated with the double precision kernels.
+//--
+*/
+
+#ifndef __SERVICE_MATH_VEC_H__
+#define __SERVICE_MATH_VEC_H__
+
+#include <math.h>
+#include <limits>
+#include "service_defines.h"
+
+namespace daal
+{
+namespace internal
+{
+namespace vec
+{
+
+/**
+ *  Selects the backend of the vector math functions for the CpuType.
+ *  The functions of this file are used for all the CpuTypes unless the library is built with DAAL_USE_MKL_VML.
+ *  In that case Intel(R) MKL VML is used for the CpuTypes where the value is false
+ */
+template<CpuType cpu>
+struct VecMathEnabled
+{
+#if defined(DAAL_USE_MKL_VML)
+    static const bool value = false;
+#else
+    static const bool value = true;
+#endif
+};
+
+/*
+// Coefficients of the polynomial approximations
+*/
+
+/* 1/k!, k = 13, ..., 0: Taylor series of exp(r), |r| <= ln(2)/2, truncation error 1.4e-18 */
+static const double expCoeffs[14] =
+{
+    1.60590438368216146e-10, 2.08767569878680990e-09, 2.50521083854417188e-08, 2.75573192239858907e-07,
+    2.75573192239858907e-06, 2.48015873015873016e-05, 1.98412698412698413e-04, 1.38888888888888889e-03,
+    8.33333333333333333e-03, 4.16666666666666667e-02, 1.66666666666666667e-01, 5.00000000000000000e-01,
+    1.00000000000000000e+00, 1.00000000000000000e+00
+};
+
+/* 1/k!, k = 7, ..., 0: Taylor series of exp(r) in single precision, truncation error 5.3e-9 */
+static const float expCoeffsF[8] =
+{
+    1.98412698e-04f, 1.38888889e-03f, 8.33333333e-03f, 4.16666667e-02f,
+    1.66666667e-01f, 5.00000000e-01f, 1.00000000e+00f, 1.00000000e+00f
+};
+
+/* Minimax coefficients of R(z) = (log(1+f) - 2s)/s - s*s, s = f/(2+f), z = s*s, |s| <= 0.1716 */
+static const double logCoeffs[7] =
+{
+    1.479819860511658591e-01, 1.531383769920937332e-01, 1.818357216161805012e-01, 2.222219843214978396e-01,
+    2.857142874366239149e-01, 3.999999999940941908e-01, 6.666666666666735130e-01
+};
+
+/* Chebyshev approximation of erf(x)/x in t = x*x on [0, 1], error 1.3e-19 */
+static const double erfSmall[13] =
+{
+    5.95717614774891131e-11, -1.13728488567916737e-09, 1.46597752740474363e-08, -1.63503127010546952e-07,
+    1.64610004841213676e-06, -1.49255952668311818e-05, 1.20553311116427105e-04, -8.54832698083379003e-04,
+    5.22397762481801448e-03, -2.68661706450767923e-02, 1.12837916709548791e-01, -3.76126389031837483e-01,
+    1.12837916709551256e+00
+};
+
+/* Chebyshev approximations of erf(x) in t = x - 1.25 - 0.5*k on [1 + 0.5*k, 1.5 + 0.5*k], k = 0, ..., 9, error 3.7e-19 */
+static const double erfLarge[10][14] =
+{
+    { 5.44407249607149884e-05, -5.33588540847417458e-05, -3.23837895437258897e-04, 7.93563776047761485e-04,
+      8.77631120316539311e-04, -5.69768026346471456e-03, 3.62598271991902438e-03, 2.13012730114500483e-02,
+      -4.71810364060003887e-02, -6.15940423089653393e-03, 1.67535795066835469e-01, -2.95651403059111528e-01,
+      2.36521122447290788e-01, 9.22900128256458174e-01 },
+    { -1.70139321304885569e-05, 6.76549780569217474e-05, -5.50595521668554575e-06, -4.42662993234080077e-04,
+      8.94184316639716199e-04, 7.30047515506731539e-04, -6.05875152657360094e-03, 8.96304518038900169e-03,
+      6.62436146890060199e-03, -4.81022098330191397e-02, 9.01572847140046096e-02, -9.23562428777598282e-02,
+      5.27749959301503785e-02, 9.86671671219182422e-01 },
+    { -1.51649993594491045e-06, -2.19447216463213695e-05, 6.51506823581935064e-05, -1.15303495813625298e-05,
+      -3.69381086164473999e-04, 9.99496427271910669e-04, -6.70455955356343003e-04, -2.90435713041379022e-03,
+      1.06576791655155819e-02, -1.90833836363362500e-02, 2.17245536919719595e-02, -1.60702177995428741e-02,
+      7.14231902201798233e-03, 9.98537283413318821e-01 },
+    { 2.68713146895265614e-06, -1.26812530924326679e-06, -1.58437406794994948e-05, 5.50138352862840655e-05,
+      -7.12231180143149331e-05, -8.90122871921433112e-05, 6.46040956751227574e-04, -1.65732738802521341e-03,
+      2.75580841407282442e-03, -3.25811365979340609e-03, 2.76038870506660917e-03, -1.61226242950729317e-03,
+      5.86277247093792324e-04, 9.99899378077880319e-01 },
+    { -5.33624433184155309e-07, 1.90431118463322430e-06, -2.86555770493169900e-06, -2.32884048031674112e-06,
+      2.59139006734723754e-05, -8.16476320771271829e-05, 1.69991413336813296e-04, -2.63528504175794174e-04,
+      3.13797225503129236e-04, -2.86569337750709372e-04, 1.95809711948146103e-04, -9.48643324966387476e-05,
+      2.91890253835817327e-05, 9.99995697220536273e-01 },
+    { -6.04158527685999816e-08, -8.07852557733584751e-08, 7.75612586748520744e-07, -2.60411521542083562e-06,
+      6.10886942002645761e-06, -1.11281930542550035e-05, 1.62753029870424031e-05, -1.92727221994240712e-05,
+      1.83709749956294141e-05, -1.38412398700968097e-05, 7.96961606239755738e-06, -3.30537071714989404e-06,
+      8.81432191231797586e-07, 9.99999886272743388e-01 },
+    { 1.70309194316798490e-08, -5.65530944704869722e-08, 1.37774150331358695e-07, -2.75007860943218665e-07,
+      4.57005817298183345e-07, -6.37834656523887009e-07, 7.47725223100177708e-07, -7.30919965421291174e-07,
+      5.87246179793677472e-07, -3.78795269833831960e-07, 1.89019259799559205e-07, -6.86119733058384515e-08,
+      1.61439937195072037e-08, 9.99999998149425862e-01 },
+    { 2.04985421676406209e-09, -4.35232109852286021e-09, 7.50076755884510183e-09, -1.16455971374974317e-08,
+      1.56755682581510441e-08, -1.81734686556613776e-08, 1.80363012779769567e-08, -1.51447017896509996e-08,
+      1.05723969276924330e-08, -5.98092140343972107e-09, 2.63784501361415667e-09, -8.51881958550189377e-10,
+      1.79343570343532558e-10, 9.99999999981514898e-01 },
+    { 7.87516422700036982e-11, -1.33374243044881994e-10, 1.83429329004894092e-10, -2.38887872091414574e-10,
+      2.74882874617698392e-10, -2.75401263767248339e-10, 2.38604701214913855e-10, -1.76402696135469448e-10,
+      1.09200388033253591e-10, -5.51147170442901903e-11, 2.18016847865652572e-11, -6.34413919651362841e-12,
+      1.20840747160932654e-12, 9.99999999999886868e-01 },
+    { 1.35991177890038057e-12, -1.96375414978873327e-12, 2.25791658884646564e-12, -2.55854952681868862e-12,
+      2.59455507294497336e-12, -2.30109051151223016e-12, 1.77553760706931892e-12, -1.17567534338063521e-12,
+      6.54969251483902400e-13, -2.98752784759706341e-13, 1.07206281259567018e-13, -2.83962889544739568e-14,
+      4.93848514118248947e-15, 9.99999999999999556e-01 }
+};
+
+/* Chebyshev approximations of erfinv(x)/x in t = w - c for w = -ln(1-x*x) in [0, 1.5625] and [1.5625, 6.25]
+   and in t = sqrt(w) - c for sqrt(w) in [2.5, 4] and [4, 6.1], error 3.8e-18 */
+static const double erfInvCoeffs[4][21] =
+{
+    { 1.46601800060619297e-17, 8.08574684195520425e-17, -7.98657337764904749e-16, -2.45023097722881388e-15,
+      3.80409791503032540e-14, 4.18407744834898458e-14, -1.69845287600573989e-12, 1.05755070109705442e-12,
+      7.16323547592257777e-11, -1.69138947479385716e-10, -2.84278820247137466e-09, 1.25388614710418042e-08,
+      1.03963504689000771e-07, -7.65091346073180089e-07, -3.25296068715739337e-06, 4.31760174583325376e-05,
+      5.54958089944054247e-05, -2.44484988548191069e-03, 5.83480859956433170e-03, 2.45628303595510161e-01,
+      1.07338944078225373e+00 },
+    { -6.91719882042282124e-19, 3.69487319335618921e-18, 3.00819046436185545e-17, -4.01555037829207401e-16,
+      1.25489637066914535e-15, 1.24591535977446947e-14, -1.72368842371671319e-13, 6.79766076935819522e-13,
+      4.54612164195153523e-12, -7.72926093320778083e-11, 3.67919292020675883e-10, 1.54162993211012997e-09,
+      -3.48723963211298276e-08, 2.02875807021297172e-07, 3.61874657771376814e-07, -1.57545470770163571e-05,
+      1.26209361336456941e-04, -2.49922348981894134e-04, -7.15729549901180685e-03, 2.29702858088289857e-01,
+      1.83730757169280068e+00 },
+    { 7.68020047907705305e-09, -1.53053979641525481e-08, -2.09145333477312603e-08, 1.31586636831929664e-07,
+      -2.45498189633398231e-07, -2.76171622381624115e-08, 1.48159778740225388e-06, -3.98570594564817299e-06,
+      2.93257845538534999e-06, 1.24650282242174545e-05, -4.73206806654469670e-05, 6.82871173925195523e-05,
+      2.40315128657583568e-05, -3.55037813785245187e-04, 9.53289341579413693e-04, -1.68827553544885554e-03,
+      2.49144209795696021e-03, -3.75120850822473423e-03, 5.37091455355503261e-03, 1.00525896769416545e+00,
+      3.08388561049222076e+00 },
+    { -9.13408158162350284e-13, 5.01431357466100167e-12, -1.06475977749910742e-11, 2.64268625060001268e-12,
+      6.68677114204484359e-11, -3.28903793792628330e-10, 1.06112423581776223e-09, -2.70097942981689040e-09,
+      5.79669731441201581e-09, -1.11573803063319525e-08, 2.18258330173052134e-08, -5.49536751547910517e-08,
+      2.01618036178691100e-07, -9.07080501825421071e-07, 4.19385389478224300e-06, -1.83745369004335128e-05,
+      7.12403154135818654e-05, -2.00312006632563953e-04, -1.69858091493239037e-04, 1.01028501759777134e+00,
+      4.90042105144364015e+00 }
+};
+
+static const double erfInvShift[4] = { 0.78125, 3.90625, 3.25, 5.05 };
+
+/* 2/(2k+1), k = 12, ..., 2: atanh series log(1+f) = 2s + s^3 * (2/3 + z*Q(z)), z = s*s, s = f/(2+f),
+   truncation error 2e-22 for |s| <= 0.1716 */
+static const double logSeriesCoeffs[11] =
+{
+    8.00000000000000000e-02, 8.69565217391304348e-02, 9.52380952380952381e-02, 1.05263157894736842e-01,
+    1.17647058823529412e-01, 1.33333333333333333e-01, 1.53846153846153846e-01, 1.81818181818181818e-01,
+    2.22222222222222222e-01, 2.85714285714285714e-01, 4.00000000000000000e-01
+};
+
+/*
+// Scalar branch-free kernels
+*/
+
+/* Horner scheme for the polynomial c[0]*t^(n-1) + ... + c[n-1], unrolled at compile time */
+template<int n>
+struct Horner
+{
+    static double eval(const double *c, double t)
+    {
+        return Horner<n - 1>::eval(c, t) * t + c[n - 1];
+    }
+};
+
+template<>
+struct Horner<1>
+{
+    static double eval(const double *c, double t)
+    {
+        return c[0];
+    }
+};
+
+template<CpuType cpu>
+struct VecMathKernels
+{
+    static double asDouble(DAAL_INT64 i)
+    {
+        union { DAAL_INT64 i; double d; } u;
+        u.i = i;
+        return u.d;
+    }
+
+    static DAAL_INT64 asInt64(double d)
+    {
+        union { DAAL_INT64 i; double d; } u;
+        u.d = d;
+        return u.i;
+    }
+
+    static float asFloat(int i)
+    {
+        union { int i; float f; } u;
+        u.i = i;
+        return u.f;
+    }
+
+    static int asInt32(float f)
+    {
+        union { int i; float f; } u;
+        u.f = f;
+        return u.i;
+    }
+
+    template<int n>
+    static double horner(const double *c, double t)
+    {
+        double p = c[0];
+        for(int i = 1; i < n; i++)
+        {
+            p = p * t + c[i];
+        }
+        return p;
+    }
+
+    /* 2^k for -1022 <= k <= 1023 */
+    static double pow2(int k)
+    {
+        return asDouble((DAAL_INT64)(k + 1023) << 52);
+    }
+
+    /* 2^k for -126 <= k <= 127 */
+    static float pow2f(int k)
+    {
+        return asFloat((k + 127) << 23);
+    }
+
+    /* exp(x + xLo) = 2^n * exp(r), r = x - n*ln(2) + xLo with the Cody-Waite reduction, |xLo| <= ulp(x),
+       2^n is applied in two steps to produce the denormal results */
+    static double exp(double x, double xLo = 0.0)
+    {
+        const double log2e = 1.44269504088896338700e+00;
+        const double ln2Hi = 6.93147180369123816490e-01;
+        const double ln2Lo = 1.90821492927058770002e-10;
+        const double maxArg = 7.09782712893383973096e+02;
+        const double minArg = -7.45133219101941108420e+02;
+
+        double xc = (x > maxArg ? maxArg : x);
+        xc = (xc < minArg ? minArg : xc);
+        xc = (x == x ? xc : 0.0);
+        double n = floor(xc * log2e + 0.5);
+        double r = (xc - n * ln2Hi) - n * ln2Lo + xLo;
+        double p = 1.0 + (r + r * r * Horner<12>::eval(expCoeffs, r));
+        int k  = (int)n;
+        int k1 = k >> 1;
+        double res = p * pow2(k1) * pow2(k - k1);
+        res = (x > maxArg ? std::numeric_limits<double>::infinity() : res);
+        res = (x < minArg ? 0.0 : res);
+        return (x == x ? res : x);
+    }
+
+    static float expf(float x)
+    {
+        const float log2e = 1.44269502e+00f;
+        const float ln2Hi = 6.93145752e-01f;
+        const float ln2Lo = 1.42860677e-06f;
+        const float maxArg = 8.87228394e+01f;
+        const float minArg = -1.03972076e+02f;
+
+        float xc = (x > maxArg ? maxArg : x);
+        xc = (xc < minArg ? minArg : xc);
+        xc = (x == x ? xc : 0.0f);
+        float n = floorf(xc * log2e + 0.5f);
+        float r = (xc - n * ln2Hi) - n * ln2Lo;
+        float q = ((((expCoeffsF[0] * r + expCoeffsF[1]) * r + expCoeffsF[2]) * r + expCoeffsF[3]) * r + expCoeffsF[4]) * r + expCoeffsF[5];
+        float p = 1.0f + (r + r * r * q);
+        int k  = (int)n;
+        int k1 = k >> 1;
+        float res = p * pow2f(k1) * pow2f(k - k1);
+        res = (x > maxArg ? std::numeric_limits<float>::infinity() : res);
+        res = (x < minArg ? 0.0f : res);
+        return (x == x ? res : x);
+    }
+
+    /* expm1(x) = 2^n * expm1(r) + (2^n - 1) for -60 <= x <= 60 */
+    static double expm1(double x)
+    {
+        const double log2e = 1.44269504088896338700e+00;
+        const double ln2Hi = 6.93147180369123816490e-01;
+        const double ln2Lo = 1.90821492927058770002e-10;
+
+        double n = floor(x * log2e + 0.5);
+        double r = (x - n * ln2Hi) - n * ln2Lo;
+        double q = Horner<12>::eval(expCoeffs, r) * r * r + r;
+        double t = pow2((int)n);
+        return t * q + (t - 1.0);
+    }
+
+    /* log(x) = k*ln(2) + log(1+f), 1+f in [sqrt(2)/2, sqrt(2)) */
+    static double log(double x)
+    {
+        const double ln2Hi = 6.93147180369123816490e-01;
+        const double ln2Lo = 1.90821492927058770002e-10;
+        const double sqrt2 = 1.41421356237309504880e+00;
+        const double two54 = 1.80143985094819840000e+16;
+        const double minNormal = 2.22507385850720138309e-308;
+
+        bool denormal = (x < minNormal);
+        double xs = (denormal ? x * two54 : x);
+        DAAL_INT64 bits = asInt64(xs);
+        int k = (int)((bits >> 52) & 0x7ff) - 1023 - (denormal ? 54 : 0);
+        double m = asDouble((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+        bool big = (m > sqrt2);
+        m = (big ? m * 0.5 : m);
+        double dk = (double)(k + (big ? 1 : 0));
+
+        double f = m - 1.0;
+        double s = f / (2.0 + f);
+        double z = s * s;
+        double R = Horner<7>::eval(logCoeffs, z) * z;
+        double hfsq = 0.5 * f * f;
+        double res = dk * ln2Hi - ((hfsq - (s * (hfsq + R) + dk * ln2Lo)) - f);
+
+        res = (x == std::numeric_limits<double>::infinity() ? x : res);
+        res = (x == 0.0 ? -std::numeric_limits<double>::infinity() : res);
+        res = (x < 0.0 ? std::numeric_limits<double>::quiet_NaN() : res);
+        return (x == x ? res : x);
+    }
+
+    /* Rounding error of s = a + b (Knuth), relies on the strict order of the floating-point operations */
+    static double twoSumErr(double a, double b, double s)
+    {
+        double bb = s - a;
+        return (a - (s - bb)) + (b - bb);
+    }
+
+    /* a = hi + lo, hi has 26 significant bits. The low bits are cleared instead of the Dekker splitting
+       by the multiplication, which is not exact if the compiler contracts it into FMA */
+    static void split(double a, double &hi, double &lo)
+    {
+        hi = asDouble(asInt64(a) & (DAAL_INT64)0xfffffffff8000000ULL);
+        lo = a - hi;
+    }
+
+    /* a * b = p + e (Dekker), the error of e is below 2^-105 * |p| */
+    static void twoProd(double a, double b, double &p, double &e)
+    {
+        double ah, al, bh, bl;
+        split(a, ah, al);
+        split(b, bh, bl);
+        p = a * b;
+        e = (((ah * bh - p) + ah * bl) + al * bh) + al * bl;
+    }
+
+    static float logf(float x)
+    {
+        const float ln2Hi = 6.93145752e-01f;
+        const float ln2Lo = 1.42860677e-06f;
+        const float sqrt2 = 1.41421354e+00f;
+        const float two25 = 3.35544320e+07f;
+        const float minNormal = 1.17549435e-38f;
+
+        bool denormal = (x < minNormal);
+        float xs = (denormal ? x * two25 : x);
+        int bits = asInt32(xs);
+        int k = ((bits >> 23) & 0xff) - 127 - (denormal ? 25 : 0);
+        float m = asFloat((bits & 0x007fffff) | 0x3f800000);
+        bool big = (m > sqrt2);
+        m = (big ? m * 0.5f : m);
+        float dk = (float)(k + (big ? 1 : 0));
+
+        float f = m - 1.0f;
+        float s = f / (2.0f + f);
+        float z = s * s;
+        float R = z * ((float)logCoeffs[6] + z * ((float)logCoeffs[5] + z * ((float)logCoeffs[4] + z * (float)logCoeffs[3])));
+        float hfsq = 0.5f * f * f;
+        float res = dk * ln2Hi - ((hfsq - (s * (hfsq + R) + dk * ln2Lo)) - f);
+
+        res = (x == std::numeric_limits<float>::infinity() ? x : res);
+        res = (x == 0.0f ? -std::numeric_limits<float>::infinity() : res);
+        res = (x < 0.0f ? std::numeric_limits<float>::quiet_NaN() : res);
+        return (x == x ? res : x);
+    }
+
+    /* log1p(x) = log(u) - ((u-1)-x)/u, u = 1+x */
+    static double log1p(double x)
+    {
+        double u = 1.0 + x;
+        bool exact = (u == 1.0) | (u == 0.0) | (u == std::numeric_limits<double>::infinity());
+        double corr = ((u - 1.0) - x) / (exact ? 1.0 : u);
+        double res = log(u) - (exact ? 0.0 : corr);
+        return (u == 1.0 ? x : res);
+    }
+
+    /* tanh(x) = -e/(e+2), e = expm1(-2|x|) */
+    static double tanh(double x)
+    {
+        double a = (x < 0.0 ? -x : x);
+        a = (a > 20.0 ? 20.0 : a);
+        double e = expm1(-2.0 * a);
+        double res = -e / (e + 2.0);
+        res = (x < 0.0 ? -res : res);
+        return ((x == 0.0) | (x != x) ? x : res);
+    }
+
+    static double erf(double x)
+    {
+        double a = (x < 0.0 ? -x : x);
+        double small = x * Horner<13>::eval(erfSmall, a * a);
+
+        double ac = (a < 5.99 ? a : 5.99);
+        ac = (a == a ? ac : 1.0);
+        int idx = (int)((ac - 1.0) * 2.0);
+        idx = (idx < 0 ? 0 : idx);
+        double p = Horner<14>::eval(erfLarge[idx], ac - (1.25 + 0.5 * idx));
+        p = (a >= 6.0 ? 1.0 : p);
+        p = (x < 0.0 ? -p : p);
+        double res = (a < 1.0 ? small : p);
+        return (x == x ? res : x);
+    }
+
+    static double erfInv(double x)
+    {
+        double a = (x < 0.0 ? -x : x);
+        double ac = (a < 1.0 ? a : 0.0);
+        double w = -log((1.0 - ac) * (1.0 + ac));
+        double s = sqrt(w);
+        int idx = (w < 1.5625 ? 0 : (w < 6.25 ? 1 : (s < 4.0 ? 2 : 3)));
+        double t = (idx < 2 ? w : s) - erfInvShift[idx];
+        double res = Horner<21>::eval(erfInvCoeffs[idx], t) * x;
+        res = (a == 1.0 ? x * std::numeric_limits<double>::infinity() : res);
+        res = (a > 1.0 ? std::numeric_limits<double>::quiet_NaN() : res);
+        return (x == x ? res : x);
+    }
+
+    /* out[i] = exp(y * log(|in[i]|)) for the finite y with the sign and the special cases of pow().
+       log(|x|) = k*ln(2) + 2*atanh(s) is computed as lHi + lLo with the error below 2^-64 * |log(|x|)|:
+       s = f/(2+f) and the leading term 2/3 * s^3 of the series are kept as the pairs of doubles,
+       and the product with y is exact. The loop body is not a function to let the compiler vectorize it */
+    template<typename fpType>
+    static void powx(size_t n, const fpType *in, double y, fpType *out)
+    {
+        const double ln2Hi = 6.93147180369123816490e-01;
+        const double ln2Lo = 1.90821492927058770002e-10;
+        const double twoThirdsHi = 6.66666666666666629659e-01;
+        const double twoThirdsLo = 3.70074341541718826e-17;
+        const double sqrt2 = 1.41421356237309504880e+00;
+        const double two54 = 1.80143985094819840000e+16;
+        const double minNormal = 2.22507385850720138309e-308;
+
+        bool yInt = (floor(y) == y);
+        bool yOdd = (yInt && fabs(y) < 9007199254740992.0 && fmod(y, 2.0) != 0.0);
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; i++)
+        {
+            double x = (double)in[i];
+            double a = (x < 0.0 ? -x : x);
+            bool denormal = (a < minNormal);
+            double as = (denormal ? a * two54 : a);
+            DAAL_INT64 bits = asInt64(as);
+            int k = (int)((bits >> 52) & 0x7ff) - 1023 - (denormal ? 54 : 0);
+            double m = asDouble((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+            bool big = (m > sqrt2);
+            m = (big ? m * 0.5 : m);
+            double dk = (double)(k + (big ? 1 : 0));
+
+            /* s = sHi + sLo, f = m - 1 is exact */
+            double f = m - 1.0;
+            double d = 2.0 + f;
+            double dLo = twoSumErr(2.0, f, d);
+            double sHi = f / d;
+            double p, pLo;
+            twoProd(sHi, d, p, pLo);
+            double sLo = (((f - p) - pLo) - sHi * dLo) / d;
+
+            /* s^3 = cHi + cLo */
+            double z, zLo, cHi, cLo;
+            twoProd(sHi, sHi, z, zLo);
+            zLo += 2.0 * sHi * sLo;
+            twoProd(z, sHi, cHi, cLo);
+            cLo += zLo * sHi + z * sLo;
+
+            /* s^3 * (2/3 + z*Q(z)) = uHi + uLo */
+            double q = z * Horner<11>::eval(logSeriesCoeffs, z);
+            double tHi = twoThirdsHi + q;
+            double tLo = twoSumErr(twoThirdsHi, q, tHi) + twoThirdsLo;
+            double uHi, uLo;
+            twoProd(cHi, tHi, uHi, uLo);
+            uLo += cLo * tHi + cHi * tLo;
+
+            /* dk * ln2Hi and 2 * sHi are exact */
+            double t1 = dk * ln2Hi + 2.0 * sHi;
+            double e1 = twoSumErr(dk * ln2Hi, 2.0 * sHi, t1);
+            double t2 = t1 + uHi;
+            double e2 = twoSumErr(t1, uHi, t2);
+            double l = (e1 + e2) + ((dk * ln2Lo + 2.0 * sLo) + uLo);
+            double lHi = t2 + l;
+            double lLo = l - (lHi - t2);
+            lHi = (a == std::numeric_limits<double>::infinity() ? a : lHi);
+            lHi = (a == 0.0 ? -std::numeric_limits<double>::infinity() : lHi);
+
+            double zHi, zErr;
+            twoProd(y, lHi, zHi, zErr);
+            double zTail = zErr + y * lLo;
+            zTail = (zHi - zHi == 0.0 ? zTail : 0.0);
+            double r = exp(zHi, zTail);
+            bool negative = (asInt64(x) < 0);
+            bool undefined = (x < 0.0) & (x != -std::numeric_limits<double>::infinity()) & !yInt;
+            r = (negative & yOdd ? -r : r);
+            r = (undefined ? std::numeric_limits<double>::quiet_NaN() : r);
+            r = (x == 1.0 ? 1.0 : r);
+            out[i] = (fpType)(x == x ? r : x);
+        }
+    }
+};
+
+/*
+// Template functions definition
+*/
+
+template<typename fpType, CpuType cpu>
+struct VecMath {};
+
+/*
+// Double precision functions definition
+*/
+
+template<CpuType cpu>
+struct VecMath<double, cpu>
+{
+    typedef size_t SizeType;
+    typedef VecMathKernels<cpu> Kernels;
+
+    static double sFabs(double in)
+    {
+        return ( in >= 0.0 ) ? in : -in;
+    }
+
+    static double sMin(double in1, double in2)
+    {
+        return ( in1 > in2 ) ? in2 : in1;
+    }
+
+    static double sMax(double in1, double in2)
+    {
+        return ( in1 < in2 ) ? in2 : in1;
+    }
+
+    static double sSqrt(double in)
+    {
+        return sqrt(in);
+    }
+
+    static double sPowx(double in, double in1)
+    {
+        double r;
+        vPowx(1, &in, in1, &r);
+        return r;
+    }
+
+    static double sCeil(double in)
+    {
+        return ceil(in);
+    }
+
+    static double sErfInv(double in)
+    {
+        return Kernels::erfInv(in);
+    }
+
+    static double sLog(double in)
+    {
+        return Kernels::log(in);
+    }
+
+    static void vPowx(SizeType n, double *in, double in1, double *out)
+    {
+        if(in1 == 0.0)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(SizeType i = 0; i < n; i++) { out[i] = 1.0; }
+            return;
+        }
+        if(in1 == 1.0)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(SizeType i = 0; i < n; i++) { out[i] = in[i]; }
+            return;
+        }
+        if(in1 == 2.0)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(SizeType i = 0; i < n; i++) { out[i] = in[i] * in[i]; }
+            return;
+        }
+        if(in1 == -1.0)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(SizeType i = 0; i < n; i++) { out[i] = 1.0 / in[i]; }
+            return;
+        }
+        if(in1 - in1 != 0.0 || fabs(in1) > 1.0e+300)
+        {
+            /* Infinite, NaN or huge power */
+            for(SizeType i = 0; i < n; i++) { out[i] = pow(in[i], in1); }
+            return;
+        }
+        Kernels::powx(n, in, in1, out);
+    }
+
+    static void vCeil(SizeType n, double *in, double *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = ceil(in[i]); }
+    }
+
+    static void vErfInv(SizeType n, double *in, double *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::erfInv(in[i]); }
+    }
+
+    static void vErf(SizeType n, double *in, double *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::erf(in[i]); }
+    }
+
+    static void vExp(SizeType n, double* in, double* out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::exp(in[i]); }
+    }
+
+    static void vTanh(SizeType n, double *in, double *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::tanh(in[i]); }
+    }
+
+    static void vSqrt(SizeType n, double *in, double *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = sqrt(in[i]); }
+    }
+
+    static void vLog(SizeType n, double *in, double *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::log(in[i]); }
+    }
+
+    static void vLog1p(SizeType n, double *in, double *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::log1p(in[i]); }
+    }
+};
+
+
+/*
+// Single precision functions definition
+*/
+
+template<CpuType cpu>
+struct VecMath<float, cpu>
+{
+    typedef size_t SizeType;
+    typedef VecMathKernels<cpu> Kernels;
+
+    static float sFabs(float in)
+    {
+        return ( in >= 0.0f ) ? in : -in;
+    }
+
+    static float sMin(float in1, float in2)
+    {
+        return ( in1 > in2 ) ? in2 : in1;
+    }
+
+    static float sMax(float in1, float in2)
+    {
+        return ( in1 < in2 ) ? in2 : in1;
+    }
+
+    static float sSqrt(float in)
+    {
+        return sqrtf(in);
+    }
+
+    static float sPowx(float in, float in1)
+    {
+        float r;
+        vPowx(1, &in, in1, &r);
+        return r;
+    }
+
+    static float sCeil(float in)
+    {
+        return ceilf(in);
+    }
+
+    static float sErfInv(float in)
+    {
+        return (float)Kernels::erfInv((double)in);
+    }
+
+    static float sLog(float in)
+    {
+        return Kernels::logf(in);
+    }
+
+    static void vPowx(SizeType n, float *in, float in1, float *out)
+    {
+        double y = (double)in1;
+        if(y - y != 0.0)
+        {
+            /* Infinite or NaN power */
+            for(SizeType i = 0; i < n; i++) { out[i] = powf(in[i], in1); }
+            return;
+        }
+        Kernels::powx(n, in, y, out);
+    }
+
+    static void vCeil(SizeType n, float *in, float *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = ceilf(in[i]); }
+    }
+
+    static void vErfInv(SizeType n, float *in, float *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = (float)Kernels::erfInv((double)in[i]); }
+    }
+
+    static void vErf(SizeType n, float *in, float *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = (float)Kernels::erf((double)in[i]); }
+    }
+
+    static void vExp(SizeType n, float* in, float* out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::expf(in[i]); }
+    }
+
+    static void vTanh(SizeType n, float *in, float *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = (float)Kernels::tanh((double)in[i]); }
+    }
+
+    static void vSqrt(SizeType n, float *in, float *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = sqrtf(in[i]); }
+    }
+
+    static void vLog(SizeType n, float *in, float *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = Kernels::logf(in[i]); }
+    }
+
+    static void vLog1p(SizeType n, float *in, float *out)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(SizeType i = 0; i < n; i++) { out[i] = (float)Kernels::log1p((double)in[i]); }
+    }
+};
+
+} // namespace vec
+} // namespace internal
+} // namespace daal
+
+#endif
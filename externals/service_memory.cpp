@@ -23,10 +23,16 @@
 
 #include "mkl_daal.h"
 #include "service_memory.h"
+#include "service_profiler.h"
+#include "threading.h"
 #include <string.h>
 
+/* Minimal size of the memory block written in daal_first_touch() */
+static const size_t minFirstTouchSize = 1024 * 1024;
+
 void *daal::services::daal_malloc(size_t size, size_t alignment)
 {
+    __DAAL_PROFILER_MEMORY_TASK("daal_malloc", size);
     return malloc(size);
 }
 
@@ -35,6 +41,24 @@ void daal::services::daal_free(void *ptr)
     free(ptr);
 }
 
+void daal::services::daal_first_touch(void *ptr, size_t nRows, size_t rowSize)
+{
+    if(ptr == NULL || nRows < 2 || nRows * rowSize < minFirstTouchSize) { return; }
+
+    /* The first touch is enabled only inside the bound arenas */
+    const size_t nThreads = (size_t)_daal_threader_get_first_touch_threads();
+    if(nThreads < 2) { return; }
+
+    /* One contiguous range of rows per thread, the threads take the ranges in an undefined order */
+    const size_t nRanges = (nThreads < nRows ? nThreads : nRows);
+    const size_t rangeSize = (nRows + nRanges - 1) / nRanges;
+    char *cptr = (char *)ptr;
+    daal::threader_for_row_blocks(nRows, rangeSize, daal::staticPartitioner, [=](size_t iStartRow, size_t nRowsInRange)
+    {
+        memset(cptr + iStartRow * rowSize, 0, nRowsInRange * rowSize);
+    } );
+}
+
 void daal::services::daal_memcpy_s(void *dest, size_t destSize, const void *src, size_t srcSize)
 {
     size_t copySize = srcSize;
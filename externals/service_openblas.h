@@ -132,8 +132,6 @@ struct OpenBlas<double, cpu>
     static void xgemm(char *transa, char *transb, MKL_INT *p, MKL_INT *ny, MKL_INT *n, double *alpha, double *a,
                MKL_INT *lda, double *y, MKL_INT *ldy, double *beta, double *aty, MKL_INT *ldaty)
     {
-        cout << "Invoke xgemm with lda: " << *lda << endl;
-        //__DAAL_MKLFN_CALL(blas_, dgemm, (CblasRowMajor, ((*transa == 'N' || *transa == 'n') ? CblasNoTrans : CblasTrans), ((*transb == 'N' || *transb == 'n') ? CblasNoTrans : CblasTrans), *p, *ny, *n, *alpha, a, *lda, y, *ldy, *beta, aty, *ldaty));
         __DAAL_MKLFN_CALL(blas_, dgemm, (CblasRowMajor, ((*transb == 'N' || *transb == 'n') ? CblasNoTrans : CblasTrans), ((*transa == 'N' || *transa == 'n') ? CblasNoTrans : CblasTrans), *ny, *p, *n, *alpha, y, *ldy, a, *lda, *beta, aty, *ldaty));
     }
 
@@ -189,7 +187,7 @@ struct OpenBlas<float, cpu>
     static void xgemm(char *transa, char *transb, MKL_INT *p, MKL_INT *ny, MKL_INT *n, float *alpha, float *a,
                MKL_INT *lda, float *y, MKL_INT *ldy, float *beta, float *aty, MKL_INT *ldaty)
     {
-        __DAAL_MKLFN_CALL(blas_, sgemm, (CblasRowMajor, ((*transa == 'N' || *transa == 'n') ? CblasNoTrans : CblasTrans), ((*transb == 'N' || *transb == 'n') ? CblasNoTrans : CblasTrans), *p, *ny, *n, *alpha, a, *lda, y, *ldy, *beta, aty, *ldaty));
+        __DAAL_MKLFN_CALL(blas_, sgemm, (CblasRowMajor, ((*transb == 'N' || *transb == 'n') ? CblasNoTrans : CblasTrans), ((*transa == 'N' || *transa == 'n') ? CblasNoTrans : CblasTrans), *ny, *p, *n, *alpha, y, *ldy, a, *lda, *beta, aty, *ldaty));
     }
 
     /*
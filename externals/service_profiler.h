@@ -0,0 +1,41 @@
+/* file: service_profiler.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Profiler hooks of the internal code of the library.
+//  The hooks of the public headers are always compiled, see daal_profiler.h.
+//  The hooks below are used only by the sources of the library, so they are compiled
+//  out of the hot paths unless the library is built with the DAAL_PROFILER macro defined
+//--
+*/
+
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
+#include "daal_profiler.h"
+
+#if defined(DAAL_PROFILER)
+    #define __DAAL_PROFILER_CPU_TASK(type, name, cpu) DAAL_PROFILER_CPU_TASK(type, name, cpu)
+    #define __DAAL_PROFILER_MEMORY_TASK(name, size) \
+        daal::services::ProfilerTask __daalProfilerTask(daal::services::profilerMemory, name, -1, size)
+#else
+    #define __DAAL_PROFILER_CPU_TASK(type, name, cpu)
+    #define __DAAL_PROFILER_MEMORY_TASK(name, size)
+#endif
+
+#endif
@@ -38,7 +38,7 @@ namespace internal
 /*
 // Template functions definition
 */
-template<typename fpType, CpuType cpu, template<typename, CpuType> class _impl=mkl::MklStatistics>
+template<typename fpType, CpuType cpu, template<typename, CpuType> class _impl=DefaultStatistics>
 struct Statistics
 {
     typedef typename _impl<fpType,cpu>::SizeType   SizeType;
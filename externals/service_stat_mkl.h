@@ -236,6 +236,10 @@ extern "C"
 #define __DAAL_VSL_SS_ERROR_BAD_QUANT_ORDER                   -4022
 #define __DAAL_VSL_SS_ERROR_INDICES_NOT_SUPPORTED             -4085
 
+    // Errors of the summary statistics functions of the library
+#define __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE                -4000
+#define __DAAL_VSL_SS_ERROR_BAD_BACON_PARAMS                  -4050
+
 
 
     typedef void *tDAAL_VSLSSTaskPtr;
@@ -353,6 +357,8 @@ extern "C"
 
 #endif
 
+#include "service_stat_vec.h"
+
 namespace daal
 {
 namespace internal
@@ -966,6 +972,22 @@ struct MklStatistics<float, cpu>
 };
 
 } // namespace mkl
+
+/*
+// Summary statistics backend of the CpuType, see VecStatisticsEnabled in service_stat_vec.h
+*/
+
+template<typename fpType, CpuType cpu, bool useVecStatistics>
+struct StatisticsBackend : public vec::VecStatistics<fpType, cpu> {};
+
+#if defined(DAAL_USE_MKL_VSL)
+template<typename fpType, CpuType cpu>
+struct StatisticsBackend<fpType, cpu, false> : public mkl::MklStatistics<fpType, cpu> {};
+#endif
+
+template<typename fpType, CpuType cpu>
+struct DefaultStatistics : public StatisticsBackend<fpType, cpu, vec::VecStatisticsEnabled<cpu>::value> {};
+
 } // namespace internal
 } // namespace daal
 
@@ -0,0 +1,1154 @@
+/* file: service_stat_vec.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Summary statistics functions implemented in the library without Intel(R) MKL VSL.
+//
+//  The functions take the data in the layout of Intel(R) MKL VSL Summary Statistics used by the library
+//  (__DAAL_VSL_SS_MATRIX_STORAGE_COLS, the observations are the rows) and return the same results:
+//
+//    xcp, xxcp_weight     the cross-product of the centered data. The blocks of rows are processed
+//                         in parallel, the means and the cross-products of the blocks are merged
+//                         by the pairwise update of Chan, Golub and LeVeque
+//    x2c_mom, xLowOrderMoments, xSumAndVariance
+//                         the same update restricted to the diagonal of the cross-product
+//    xQuantiles           the selection of the order statistics of the features in parallel. The quantile
+//                         of order b is x(j) + f * (x(j+1) - x(j)), (n - 1) * b = j + f, x(0) <= ... <= x(n-1)
+//    xSort                the radix sort of the features in parallel. The features of many observations
+//                         are split into the parts sorted in parallel and merged
+//    xoutlierdetection    the BACON algorithm of Billor, Hadi and Velleman
+//
+//  The parallel loops over the blocks of rows use partial_tls, so the results are reproducible
+//  in the reproducible mode of the threading layer. The blocks do not call Blas<>, whose OpenBLAS
+//  backend runs in its own threads: the cross-products and the distances are computed by the loops
+//  of this file in the thread of the block.
+//
+//  The file is included by service_stat_mkl.h after the definitions of the __DAAL_VSL_SS_ constants.
+//--
+*/
+
+#ifndef __SERVICE_STAT_VEC_H__
+#define __SERVICE_STAT_VEC_H__
+
+#include <math.h>
+#include <limits>
+#include "service_defines.h"
+#include "service_memory.h"
+#include "service_utils.h"
+#include "service_math_vec.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace internal
+{
+namespace vec
+{
+
+/**
+ *  Selects the backend of the summary statistics functions for the CpuType.
+ *  The functions of this file are used for all the CpuTypes unless the library is built with DAAL_USE_MKL_VSL.
+ *  In that case Intel(R) MKL VSL is used for the CpuTypes where the value is false
+ */
+template<CpuType cpu>
+struct VecStatisticsEnabled
+{
+#if defined(DAAL_USE_MKL_VSL)
+    static const bool value = false;
+#else
+    static const bool value = true;
+#endif
+};
+
+/**
+ *  Sum of the weights, means and cross-product of the centered rows of the data accumulated over the blocks of rows.
+ *  Only the upper triangle of the cross-product is computed. If isFullCrossProduct is false, only the diagonal
+ *  of the cross-product, that is the sums of the squared deviations from the means, is computed.
+ *  If userMean is not NULL, the data is centered by userMean and the means are not updated
+ */
+template<typename fpType, CpuType cpu>
+class BlockMoments
+{
+public:
+    BlockMoments(size_t nFeatures, size_t blockSize, bool isFullCrossProduct, const fpType *userMean) :
+        weight(0), mean(0), cp(0), _nFeatures(nFeatures), _cpSize(isFullCrossProduct ? nFeatures * nFeatures : nFeatures),
+        _isFullCrossProduct(isFullCrossProduct), _isUserMean(userMean != 0), _buffer(0)
+    {
+        _buffer = daal::services::internal::service_calloc<fpType, cpu>(2 * (_nFeatures + _cpSize) + blockSize * _nFeatures);
+        if(!_buffer) { return; }
+
+        mean       = _buffer;
+        cp         = mean + _nFeatures;
+        _blockMean = cp + _cpSize;
+        _blockCP   = _blockMean + _nFeatures;
+        _diff      = _blockCP + _cpSize;
+
+        if(userMean)
+        {
+            for(size_t j = 0; j < _nFeatures; j++)
+            {
+                mean[j] = userMean[j];
+            }
+        }
+    }
+
+    ~BlockMoments()
+    {
+        daal::services::daal_free(_buffer);
+    }
+
+    bool isValid() const { return (_buffer != 0); }
+
+    /* Adds nRows rows of the data, weights are the weights of the rows or NULL */
+    void addBlock(const fpType *data, const fpType *weights, size_t nRows)
+    {
+        const size_t p = _nFeatures;
+        const fpType zero = 0.0;
+
+        fpType blockWeight = (fpType)nRows;
+        if(weights)
+        {
+            blockWeight = zero;
+            for(size_t i = 0; i < nRows; i++)
+            {
+                blockWeight += weights[i];
+            }
+        }
+        if(blockWeight == zero) { return; }
+
+        if(!_isUserMean)
+        {
+            daal::services::internal::service_memset<fpType, cpu>(_blockMean, zero, p);
+            for(size_t i = 0; i < nRows; i++)
+            {
+                const fpType w = (weights ? weights[i] : (fpType)1.0);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < p; j++)
+                {
+                    _blockMean[j] += w * data[i * p + j];
+                }
+            }
+            const fpType invWeight = (fpType)1.0 / blockWeight;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < p; j++)
+            {
+                _blockMean[j] *= invWeight;
+            }
+        }
+
+        const fpType *center = (_isUserMean ? mean : _blockMean);
+        for(size_t i = 0; i < nRows; i++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < p; j++)
+            {
+                _diff[i * p + j] = data[i * p + j] - center[j];
+            }
+        }
+
+        daal::services::internal::service_memset<fpType, cpu>(_blockCP, zero, _cpSize);
+        if(_isFullCrossProduct)
+        {
+            /* The row of the cross-product and the centered block stay in the cache */
+            for(size_t j1 = 0; j1 < p; j1++)
+            {
+                fpType *cpRow = _blockCP + j1 * p;
+                for(size_t i = 0; i < nRows; i++)
+                {
+                    const fpType *diffRow = _diff + i * p;
+                    const fpType d = (weights ? weights[i] * diffRow[j1] : diffRow[j1]);
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for(size_t j2 = j1; j2 < p; j2++)
+                    {
+                        cpRow[j2] += d * diffRow[j2];
+                    }
+                }
+            }
+        }
+        else
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                const fpType *diffRow = _diff + i * p;
+                const fpType w = (weights ? weights[i] : (fpType)1.0);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < p; j++)
+                {
+                    _blockCP[j] += w * diffRow[j] * diffRow[j];
+                }
+            }
+        }
+
+        merge(blockWeight, _blockMean, _blockCP);
+    }
+
+    /* Adds the moments accumulated by other */
+    void merge(const BlockMoments &other)
+    {
+        merge(other.weight, other.mean, other.cp);
+    }
+
+    /* Copies the moments to the arrays, the cross-product is returned as the full symmetric matrix */
+    void getResult(fpType &resultWeight, fpType *resultMean, fpType *resultCP) const
+    {
+        const size_t p = _nFeatures;
+        resultWeight = weight;
+        for(size_t j = 0; j < p; j++)
+        {
+            resultMean[j] = mean[j];
+        }
+
+        if(!_isFullCrossProduct)
+        {
+            for(size_t j = 0; j < p; j++)
+            {
+                resultCP[j] = cp[j];
+            }
+            return;
+        }
+
+        for(size_t j1 = 0; j1 < p; j1++)
+        {
+            for(size_t j2 = j1; j2 < p; j2++)
+            {
+                resultCP[j1 * p + j2] = cp[j1 * p + j2];
+                resultCP[j2 * p + j1] = cp[j1 * p + j2];
+            }
+        }
+    }
+
+    fpType weight;
+    fpType *mean;
+    fpType *cp;
+
+private:
+    void merge(fpType otherWeight, const fpType *otherMean, const fpType *otherCP)
+    {
+        const size_t p = _nFeatures;
+        if(otherWeight == (fpType)0) { return; }
+
+        if(_isUserMean)
+        {
+            for(size_t k = 0; k < _cpSize; k++)
+            {
+                cp[k] += otherCP[k];
+            }
+            weight += otherWeight;
+            return;
+        }
+
+        if(weight == (fpType)0)
+        {
+            for(size_t j = 0; j < p; j++)
+            {
+                mean[j] = otherMean[j];
+            }
+            for(size_t k = 0; k < _cpSize; k++)
+            {
+                cp[k] = otherCP[k];
+            }
+            weight = otherWeight;
+            return;
+        }
+
+        const fpType newWeight = weight + otherWeight;
+        const fpType factor = weight * otherWeight / newWeight;
+
+        /* The centered block is not used after the merge, its buffer keeps the differences of the means */
+        fpType *delta = _diff;
+        for(size_t j = 0; j < p; j++)
+        {
+            delta[j] = otherMean[j] - mean[j];
+        }
+
+        if(_isFullCrossProduct)
+        {
+            for(size_t j1 = 0; j1 < p; j1++)
+            {
+                const fpType d = factor * delta[j1];
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j2 = j1; j2 < p; j2++)
+                {
+                    cp[j1 * p + j2] += otherCP[j1 * p + j2] + d * delta[j2];
+                }
+            }
+        }
+        else
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < p; j++)
+            {
+                cp[j] += otherCP[j] + factor * delta[j] * delta[j];
+            }
+        }
+
+        const fpType meanFactor = otherWeight / newWeight;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < p; j++)
+        {
+            mean[j] += delta[j] * meanFactor;
+        }
+        weight = newWeight;
+    }
+
+    size_t _nFeatures;
+    size_t _cpSize;
+    bool _isFullCrossProduct;
+    bool _isUserMean;
+    fpType *_buffer;
+    fpType *_blockMean;
+    fpType *_blockCP;
+    fpType *_diff;
+};
+
+/* Unsigned integer of the size of the floating-point type used as the key of the radix sort */
+template<typename fpType> struct RadixKey {};
+template<> struct RadixKey<double> { typedef DAAL_UINT64 Type; };
+template<> struct RadixKey<float>  { typedef unsigned int Type; };
+
+template<typename fpType, CpuType cpu>
+struct VecStatKernels
+{
+    typedef typename RadixKey<fpType>::Type KeyType;
+
+    /* Computes the moments of the n rows of the data by the blocks of rows, in parallel if isParallel is true.
+       Returns false if the memory is not allocated */
+    static bool computeMoments(const fpType *data, size_t p, size_t n, const fpType *weights, bool isFullCrossProduct,
+                               const fpType *userMean, bool isParallel, fpType &weight, fpType *mean, fpType *cp)
+    {
+        typedef BlockMoments<fpType, cpu> Moments;
+
+        const size_t cpSize = (isFullCrossProduct ? p * p : p);
+        daal::services::internal::service_memset<fpType, cpu>(cp, (fpType)0, cpSize);
+        if(!userMean)
+        {
+            daal::services::internal::service_memset<fpType, cpu>(mean, (fpType)0, p);
+        }
+        weight = 0;
+        if(n == 0) { return true; }
+
+        if(!isParallel)
+        {
+            const size_t blockSize = daal::threader_get_block_size<fpType>(n, p, 0);
+            Moments moments(p, blockSize, isFullCrossProduct, userMean);
+            if(!moments.isValid()) { return false; }
+
+            for(size_t i = 0; i < n; i += blockSize)
+            {
+                const size_t nRowsInBlock = (i + blockSize > n ? n - i : blockSize);
+                moments.addBlock(data + i * p, (weights ? weights + i : 0), nRowsInBlock);
+            }
+            moments.getResult(weight, mean, cp);
+            return true;
+        }
+
+        const size_t blockSize = daal::threader_get_block_size<fpType>(n, p);
+        daal::partial_tls<Moments *> partialMoments( [=]()-> Moments *
+        {
+            return new Moments(p, blockSize, isFullCrossProduct, userMean);
+        } );
+
+        bool isValid = true;
+        partialMoments.for_row_blocks( n, blockSize, [&](size_t iStartRow, size_t nRowsInBlock, Moments *local)
+        {
+            if(!local || !local->isValid()) { isValid = false; return; }
+            local->addBlock(data + iStartRow * p, (weights ? weights + iStartRow : 0), nRowsInBlock);
+        } );
+
+        if(isValid)
+        {
+            Moments *merged = partialMoments.merge( [](Moments *dst, Moments *src) { dst->merge(*src); } );
+            if(merged) { merged->getResult(weight, mean, cp); }
+        }
+
+        partialMoments.reduce( [](Moments *local) { delete local; } );
+        return isValid;
+    }
+
+    /* Moves the k-th smallest of x[left], ..., x[right - 1] to x[k], the smaller values to the left of it
+       and the larger values to the right of it */
+    static void select(fpType *x, size_t left, size_t right, size_t k)
+    {
+        size_t l = left, ir = right - 1;
+        for(;;)
+        {
+            if(ir <= l + 1)
+            {
+                if(ir == l + 1 && x[ir] < x[l]) { daal::swap<fpType, cpu>(x[l], x[ir]); }
+                return;
+            }
+
+            const size_t mid = (l + ir) >> 1;
+            daal::swap<fpType, cpu>(x[mid], x[l + 1]);
+            if(x[l]     > x[ir])    { daal::swap<fpType, cpu>(x[l],     x[ir]);    }
+            if(x[l + 1] > x[ir])    { daal::swap<fpType, cpu>(x[l + 1], x[ir]);    }
+            if(x[l]     > x[l + 1]) { daal::swap<fpType, cpu>(x[l],     x[l + 1]); }
+
+            size_t i = l + 1, j = ir;
+            const fpType a = x[l + 1];
+            for(;;)
+            {
+                do { i++; } while(x[i] < a);
+                do { j--; } while(x[j] > a);
+                if(j < i) { break; }
+                daal::swap<fpType, cpu>(x[i], x[j]);
+            }
+            x[l + 1] = x[j];
+            x[j] = a;
+
+            if(j >= k) { ir = j - 1; }
+            if(j <= k) { l = i; }
+        }
+    }
+
+    /* Computes the quantiles of the orders quantOrder[orderIndices[0]] <= ... <= quantOrder[orderIndices[nOrders - 1]]
+       of the column of n values. The column is reordered */
+    static void columnQuantiles(fpType *x, size_t n, size_t nOrders, const fpType *quantOrder, const size_t *orderIndices,
+                                fpType *quants)
+    {
+        size_t left = 0;
+        for(size_t k = 0; k < nOrders; k++)
+        {
+            const size_t iOrder = orderIndices[k];
+            const fpType position = (fpType)(n - 1) * quantOrder[iOrder];
+            size_t index = (size_t)position;
+            fpType fraction = position - (fpType)index;
+            if(index >= n - 1) { index = n - 1; fraction = 0; }
+
+            select(x, left, n, index);
+
+            fpType next = x[index];
+            if(fraction > (fpType)0)
+            {
+                next = x[index + 1];
+                for(size_t i = index + 2; i < n; i++)
+                {
+                    next = (x[i] < next ? x[i] : next);
+                }
+            }
+            quants[iOrder] = x[index] + fraction * (next - x[index]);
+
+            /* The values left of index are not greater than the values of the following orders */
+            left = index;
+        }
+    }
+
+    /* Computes the quantiles of the nOrders orders of the p features of the n rows of the data in parallel
+       over the features. The quantiles of the feature j are quants[j * nOrders], ..., quants[j * nOrders + nOrders - 1] */
+    static bool computeQuantiles(const fpType *data, size_t p, size_t n, size_t nOrders, const fpType *quantOrder,
+                                 fpType *quants)
+    {
+        size_t *orderIndices = (size_t *)daal::services::daal_malloc(nOrders * sizeof(size_t));
+        if(!orderIndices) { return false; }
+
+        /* The orders are processed in the ascending order, so every selection is done in the part of the column
+           left by the previous one */
+        for(size_t k = 0; k < nOrders; k++)
+        {
+            size_t i = k;
+            for(; i > 0 && quantOrder[orderIndices[i - 1]] > quantOrder[k]; i--)
+            {
+                orderIndices[i] = orderIndices[i - 1];
+            }
+            orderIndices[i] = k;
+        }
+
+        daal::tls<fpType *> columnBuffer( [=]()-> fpType *
+        {
+            return (fpType *)daal::services::daal_malloc(n * sizeof(fpType));
+        } );
+
+        bool isValid = true;
+        daal::threader_for( (int)p, (int)p, [&](int j)
+        {
+            fpType *x = columnBuffer.local();
+            if(!x) { isValid = false; return; }
+
+            for(size_t i = 0; i < n; i++)
+            {
+                x[i] = data[i * p + j];
+            }
+            columnQuantiles(x, n, nOrders, quantOrder, orderIndices, quants + (size_t)j * nOrders);
+        } );
+
+        columnBuffer.reduce( [](fpType *x) { daal::services::daal_free(x); } );
+        daal::services::daal_free(orderIndices);
+        return isValid;
+    }
+
+    /* Key of the radix sort, the order of the keys as the unsigned integers is the order of the values */
+    static KeyType toKey(fpType value)
+    {
+        union { fpType f; KeyType k; } u;
+        u.f = value;
+        const KeyType signBit = (KeyType)1 << (8 * sizeof(KeyType) - 1);
+        return ((u.k & signBit) ? ~u.k : (u.k | signBit));
+    }
+
+    static fpType fromKey(KeyType key)
+    {
+        union { fpType f; KeyType k; } u;
+        const KeyType signBit = (KeyType)1 << (8 * sizeof(KeyType) - 1);
+        u.k = ((key & signBit) ? (key & ~signBit) : ~key);
+        return u.f;
+    }
+
+    /* Sorts the n keys by the least significant digit radix sort with the 8-bit digits.
+       The passes over the digits equal for all the keys are skipped. Returns the array with the sorted keys,
+       keys or buffer */
+    static KeyType *radixSort(KeyType *keys, KeyType *buffer, size_t n)
+    {
+        size_t histogram[256];
+        for(size_t shift = 0; shift < 8 * sizeof(KeyType); shift += 8)
+        {
+            for(size_t d = 0; d < 256; d++)
+            {
+                histogram[d] = 0;
+            }
+            for(size_t i = 0; i < n; i++)
+            {
+                histogram[(keys[i] >> shift) & 0xFF]++;
+            }
+            if(histogram[(keys[0] >> shift) & 0xFF] == n) { continue; }
+
+            size_t offset = 0;
+            for(size_t d = 0; d < 256; d++)
+            {
+                const size_t count = histogram[d];
+                histogram[d] = offset;
+                offset += count;
+            }
+            for(size_t i = 0; i < n; i++)
+            {
+                buffer[histogram[(keys[i] >> shift) & 0xFF]++] = keys[i];
+            }
+
+            KeyType *tmp = keys;
+            keys = buffer;
+            buffer = tmp;
+        }
+        return keys;
+    }
+
+    /* Merges the sorted src[begin], ..., src[middle - 1] and src[middle], ..., src[end - 1] into dst[begin], ..., dst[end - 1] */
+    static void mergeSorted(const KeyType *src, size_t begin, size_t middle, size_t end, KeyType *dst)
+    {
+        size_t i = begin, j = middle, k = begin;
+        while(i < middle && j < end)
+        {
+            dst[k++] = (src[j] < src[i] ? src[j++] : src[i++]);
+        }
+        while(i < middle) { dst[k++] = src[i++]; }
+        while(j < end)    { dst[k++] = src[j++]; }
+    }
+
+    /* Sorts the p features of the n rows of the data into the same layout of sortedData.
+       If there are less features than threads, the features are split into the parts of at least
+       minPartSize values that are sorted in parallel and merged pairwise in parallel */
+    static bool sortFeatures(const fpType *data, size_t p, size_t n, fpType *sortedData)
+    {
+        const size_t minPartSize = 4096;
+        const size_t nThreads = (size_t)daal::threader_get_threads_number();
+        size_t nParts = 1;
+        while(nParts * p < nThreads && n / (2 * nParts) >= minPartSize)
+        {
+            nParts *= 2;
+        }
+
+        KeyType *keys   = (KeyType *)daal::services::daal_malloc(2 * n * p * sizeof(KeyType));
+        if(!keys) { return false; }
+        KeyType *buffer = keys + n * p;
+
+        /* The keys of the feature j are keys[j * n], ..., keys[j * n + n - 1] */
+        daal::threader_for( (int)(p * nParts), (int)(p * nParts), [&](int iTask)
+        {
+            const size_t j = (size_t)iTask / nParts;
+            const size_t iPart = (size_t)iTask % nParts;
+            const size_t begin = n * iPart / nParts;
+            const size_t end   = n * (iPart + 1) / nParts;
+            if(begin == end) { return; }
+
+            KeyType *partKeys   = keys   + j * n + begin;
+            KeyType *partBuffer = buffer + j * n + begin;
+            for(size_t i = begin; i < end; i++)
+            {
+                partKeys[i - begin] = toKey(data[i * p + j]);
+            }
+
+            const KeyType *sorted = radixSort(partKeys, partBuffer, end - begin);
+            if(sorted != partKeys)
+            {
+                for(size_t i = 0; i < end - begin; i++)
+                {
+                    partKeys[i] = sorted[i];
+                }
+            }
+        } );
+
+        KeyType *src = keys, *dst = buffer;
+        for(size_t width = 1; width < nParts; width *= 2)
+        {
+            const size_t nMerges = nParts / (2 * width);
+            daal::threader_for( (int)(p * nMerges), (int)(p * nMerges), [&](int iTask)
+            {
+                const size_t j = (size_t)iTask / nMerges;
+                const size_t iMerge = (size_t)iTask % nMerges;
+                const size_t begin  = n * (2 * width * iMerge) / nParts;
+                const size_t middle = n * (2 * width * iMerge + width) / nParts;
+                const size_t end    = n * (2 * width * iMerge + 2 * width) / nParts;
+                mergeSorted(src + j * n, begin, middle, end, dst + j * n);
+            } );
+
+            KeyType *tmp = src;
+            src = dst;
+            dst = tmp;
+        }
+
+        daal::threader_for( (int)p, (int)p, [&](int j)
+        {
+            const KeyType *featureKeys = src + (size_t)j * n;
+            for(size_t i = 0; i < n; i++)
+            {
+                sortedData[i * p + j] = fromKey(featureKeys[i]);
+            }
+        } );
+
+        daal::services::daal_free(keys);
+        return true;
+    }
+
+    /* Regularized upper incomplete gamma function Q(a, x) */
+    static double upperGamma(double a, double x, double logGammaA)
+    {
+        if(x <= 0.0) { return 1.0; }
+
+        const double eps = 1e-16;
+        const double factor = ::exp(a * ::log(x) - x - logGammaA);
+        if(x < a + 1.0)
+        {
+            double term = 1.0 / a, sum = term;
+            for(int k = 1; k < 1000 && term > sum * eps; k++)
+            {
+                term *= x / (a + k);
+                sum  += term;
+            }
+            return 1.0 - sum * factor;
+        }
+
+        /* Continued fraction evaluated by the modified Lentz method */
+        const double tiny = 1e-300;
+        double b = x + 1.0 - a, c = 1.0 / tiny, d = 1.0 / b, h = d;
+        for(int k = 1; k < 1000; k++)
+        {
+            const double an = -k * (k - a);
+            b += 2.0;
+            d = an * d + b;
+            if(::fabs(d) < tiny) { d = tiny; }
+            c = b + an / c;
+            if(::fabs(c) < tiny) { c = tiny; }
+            d = 1.0 / d;
+            const double delta = d * c;
+            h *= delta;
+            if(::fabs(delta - 1.0) < eps) { break; }
+        }
+        return h * factor;
+    }
+
+    /* Quantile of order 1 - alpha of the chi-square distribution with nDegrees degrees of freedom.
+       The Wilson-Hilferty approximation is refined by the Newton iterations */
+    static double chiSquareUpperQuantile(double nDegrees, double alpha)
+    {
+        const double a = 0.5 * nDegrees;
+        const double logGammaA = ::lgamma(a);
+
+        const double z = 1.4142135623730951 * VecMathKernels<cpu>::erfInv(1.0 - 2.0 * alpha);
+        const double c = 2.0 / (9.0 * nDegrees);
+        const double t = 1.0 - c + z * ::sqrt(c);
+        double x = (t > 0.0 ? nDegrees * t * t * t : 1e-3 * nDegrees);
+
+        for(int k = 0; k < 100; k++)
+        {
+            const double f = upperGamma(a, 0.5 * x, logGammaA) - alpha;
+            const double density = 0.5 * ::exp((a - 1.0) * ::log(0.5 * x) - 0.5 * x - logGammaA);
+            if(!(density > 0.0)) { break; }
+
+            double xNew = x + f / density;
+            if(xNew <= 0.0) { xNew = 0.5 * x; }
+            const bool isConverged = (::fabs(xNew - x) <= 1e-12 * x);
+            x = xNew;
+            if(isConverged) { break; }
+        }
+        return x;
+    }
+
+    /* Cholesky decomposition L * L' of the symmetric p x p matrix a, L replaces the lower triangle of a.
+       The rows of L of the directions with no variance left are set to zero. Returns the number of such rows */
+    static size_t choleskyDecompose(fpType *a, size_t p)
+    {
+        const fpType tolerance = (fpType)p * std::numeric_limits<fpType>::epsilon();
+        size_t nDropped = 0;
+        for(size_t j = 0; j < p; j++)
+        {
+            fpType *rowJ = a + j * p;
+            fpType s = rowJ[j];
+            for(size_t k = 0; k < j; k++)
+            {
+                s -= rowJ[k] * rowJ[k];
+            }
+
+            if(!(s > tolerance * rowJ[j]) || !(s > (fpType)0))
+            {
+                for(size_t k = 0; k <= j; k++)
+                {
+                    rowJ[k] = 0;
+                }
+                for(size_t i = j + 1; i < p; i++)
+                {
+                    a[i * p + j] = 0;
+                }
+                nDropped++;
+                continue;
+            }
+
+            const fpType diag = (fpType)::sqrt((double)s);
+            const fpType invDiag = (fpType)1.0 / diag;
+            rowJ[j] = diag;
+            for(size_t i = j + 1; i < p; i++)
+            {
+                fpType *rowI = a + i * p;
+                fpType sum = rowI[j];
+                for(size_t k = 0; k < j; k++)
+                {
+                    sum -= rowI[k] * rowJ[k];
+                }
+                rowI[j] = sum * invDiag;
+            }
+        }
+        return nDropped;
+    }
+
+    /* Computes the squared Mahalanobis distances of the rows of the data to center with the Cholesky factor
+       of the covariance computed by choleskyDecompose(). The rows are processed in parallel */
+    static bool mahalanobisDistances(const fpType *data, size_t p, size_t n, const fpType *center, const fpType *factor,
+                                     fpType *distances)
+    {
+        daal::tls<fpType *> solution( [=]()-> fpType *
+        {
+            return (fpType *)daal::services::daal_malloc(p * sizeof(fpType));
+        } );
+
+        bool isValid = true;
+        const size_t blockSize = daal::threader_get_block_size<fpType>(n, p);
+        daal::threader_for_row_blocks( n, blockSize, daal::autoPartitioner, [&](size_t iStartRow, size_t nRowsInBlock)
+        {
+            fpType *y = solution.local();
+            if(!y) { isValid = false; return; }
+
+            for(size_t i = iStartRow; i < iStartRow + nRowsInBlock; i++)
+            {
+                const fpType *x = data + i * p;
+                fpType distance = 0;
+                for(size_t j = 0; j < p; j++)
+                {
+                    const fpType *row = factor + j * p;
+                    if(row[j] == (fpType)0) { y[j] = 0; continue; }
+
+                    fpType sum = x[j] - center[j];
+                    for(size_t k = 0; k < j; k++)
+                    {
+                        sum -= row[k] * y[k];
+                    }
+                    y[j] = sum / row[j];
+                    distance += y[j] * y[j];
+                }
+                distances[i] = distance;
+            }
+        } );
+
+        solution.reduce( [](fpType *y) { daal::services::daal_free(y); } );
+        return isValid;
+    }
+
+    /* Computes the squared Euclidean distances of the rows of the data to center in parallel */
+    static void euclideanDistances(const fpType *data, size_t p, size_t n, const fpType *center, fpType *distances)
+    {
+        const size_t blockSize = daal::threader_get_block_size<fpType>(n, p);
+        daal::threader_for_row_blocks( n, blockSize, daal::autoPartitioner, [&](size_t iStartRow, size_t nRowsInBlock)
+        {
+            for(size_t i = iStartRow; i < iStartRow + nRowsInBlock; i++)
+            {
+                const fpType *x = data + i * p;
+                fpType distance = 0;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < p; j++)
+                {
+                    distance += (x[j] - center[j]) * (x[j] - center[j]);
+                }
+                distances[i] = distance;
+            }
+        } );
+    }
+
+    /* Sets the weights of the m rows with the smallest distances (and of the rows with the same distance
+       as the largest of them) to 1 and the weights of the other rows to 0 */
+    static void selectNearest(const fpType *distances, size_t n, size_t m, fpType *buffer, fpType *weights)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            buffer[i] = distances[i];
+        }
+        select(buffer, 0, n, m - 1);
+        const fpType threshold = buffer[m - 1];
+        for(size_t i = 0; i < n; i++)
+        {
+            weights[i] = (distances[i] <= threshold ? (fpType)1.0 : (fpType)0.0);
+        }
+    }
+
+    /* Computes the mean and the Cholesky factor of the covariance of the rows with the weight 1.
+       Returns false if the memory is not allocated */
+    static bool subsetCovariance(const fpType *data, size_t p, size_t n, const fpType *weights,
+                                 fpType &subsetSize, fpType *mean, fpType *factor, size_t &nDropped)
+    {
+        if(!computeMoments(data, p, n, weights, true, 0, true, subsetSize, mean, factor)) { return false; }
+
+        const fpType invDegrees = (subsetSize > (fpType)1.0 ? (fpType)1.0 / (subsetSize - (fpType)1.0) : (fpType)0.0);
+        for(size_t k = 0; k < p * p; k++)
+        {
+            factor[k] *= invDegrees;
+        }
+        nDropped = choleskyDecompose(factor, p);
+        return true;
+    }
+
+    /* Detects the outliers by the BACON algorithm. The basic subset of m = 4 * p rows nearest to the median
+       or to the mean in the Mahalanobis distance grows until its covariance has full rank. Then the basic subset
+       is replaced by the rows with the Mahalanobis distance to it below the threshold of Billor, Hadi and Velleman
+       for the significance level alpha until its size changes by less than tolerance * size. The weights of the rows of the final subset are 1,
+       the weights of the outliers are 0 */
+    static int bacon(const fpType *data, size_t p, size_t n, int initMethod, double alpha, double tolerance, fpType *weights)
+    {
+        if(n == 0 || p == 0) { return 0; }
+
+        fpType *buffer = daal::services::internal::service_calloc<fpType, cpu>(2 * n + p + p * p);
+        if(!buffer) { return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE; }
+        fpType *distances = buffer;
+        fpType *work      = distances + n;
+        fpType *center    = work + n;
+        fpType *factor    = center + p;
+
+        bool isValid = true;
+        fpType subsetSize = 0;
+        size_t nDropped = 0;
+
+        /* Distances defining the initial basic subset */
+        if(initMethod == __DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT)
+        {
+            for(size_t i = 0; i < n; i++)
+            {
+                work[i] = 1.0;
+            }
+            isValid = subsetCovariance(data, p, n, work, subsetSize, center, factor, nDropped) &&
+                      mahalanobisDistances(data, p, n, center, factor, distances);
+        }
+        else
+        {
+            const fpType half = 0.5;
+            isValid = computeQuantiles(data, p, n, 1, &half, center);
+            if(isValid) { euclideanDistances(data, p, n, center, distances); }
+        }
+
+        size_t m = 4 * p;
+        for(;;)
+        {
+            if(!isValid) { break; }
+            if(m > n) { m = n; }
+            selectNearest(distances, n, m, work, weights);
+            isValid = subsetCovariance(data, p, n, weights, subsetSize, center, factor, nDropped);
+            if(nDropped == 0 || m == n) { break; }
+            m += p;
+        }
+
+        const double nDouble = (double)n, pDouble = (double)p;
+        const double h = ::floor(0.5 * (nDouble + pDouble + 1.0));
+        double cnp = 1.0;
+        if(nDouble > pDouble)              { cnp += (pDouble + 1.0) / (nDouble - pDouble); }
+        if(nDouble > 1.0 + 3.0 * pDouble)  { cnp += 2.0 / (nDouble - 1.0 - 3.0 * pDouble); }
+        /* The threshold of the distance is the quantile of order 1 - alpha / n of the chi-square distribution */
+        const double chiSquare = chiSquareUpperQuantile(pDouble, alpha / nDouble);
+
+        const size_t maxIterations = 100;
+        for(size_t iteration = 0; isValid && iteration < maxIterations; iteration++)
+        {
+            isValid = mahalanobisDistances(data, p, n, center, factor, distances);
+            if(!isValid) { break; }
+
+            const double r = (double)subsetSize;
+            const double chr = (h > r ? (h - r) / (h + r) : 0.0);
+            const double cnpr = cnp + chr;
+            const fpType threshold = (fpType)(cnpr * cnpr * chiSquare);
+
+            fpType newSubsetSize = 0;
+            for(size_t i = 0; i < n; i++)
+            {
+                weights[i] = (distances[i] < threshold ? (fpType)1.0 : (fpType)0.0);
+                newSubsetSize += weights[i];
+            }
+
+            const bool isConverged = (::fabs((double)newSubsetSize - r) <= tolerance * r);
+            if(isConverged || newSubsetSize <= (fpType)p) { break; }
+
+            isValid = subsetCovariance(data, p, n, weights, subsetSize, center, factor, nDropped);
+        }
+
+        daal::services::daal_free(buffer);
+        return (isValid ? 0 : __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE);
+    }
+};
+
+/*
+// Summary statistics functions
+*/
+
+template<typename fpType, CpuType cpu>
+struct VecStatistics
+{
+    typedef __int64 SizeType;
+    typedef __int64 MethodType;
+    typedef int     ErrorType;
+
+    typedef VecStatKernels<fpType, cpu> Kernels;
+
+    static int xcp(fpType *data, __int64 nFeatures, __int64 nVectors, fpType *nPreviousObservations, fpType *sum,
+                   fpType *crossProduct, __int64 method)
+    {
+        const size_t p = (size_t)nFeatures;
+        const bool isUserMean = (method == __DAAL_VSL_SS_METHOD_FAST_USER_MEAN);
+
+        fpType *mean = daal::services::internal::service_calloc<fpType, cpu>(p + p * p);
+        if(!mean) { return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE; }
+        fpType *cp = mean + p;
+
+        if(isUserMean)
+        {
+            const fpType invNVectors = (fpType)1.0 / (fpType)nVectors;
+            for(size_t j = 0; j < p; j++)
+            {
+                mean[j] = sum[j] * invNVectors;
+            }
+        }
+
+        fpType weight = 0;
+        if(!Kernels::computeMoments(data, p, (size_t)nVectors, 0, true, (isUserMean ? mean : 0), true, weight, mean, cp))
+        {
+            daal::services::daal_free(mean);
+            return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE;
+        }
+
+        /* The sums and the cross-product of the previous observations are updated by the block */
+        const fpType nPrevious = *nPreviousObservations;
+        if(nPrevious == (fpType)0 || isUserMean)
+        {
+            for(size_t k = 0; k < p * p; k++)
+            {
+                crossProduct[k] = (nPrevious == (fpType)0 ? cp[k] : crossProduct[k] + cp[k]);
+            }
+        }
+        else
+        {
+            const fpType factor = nPrevious * weight / (nPrevious + weight);
+            const fpType invNPrevious = (fpType)1.0 / nPrevious;
+            for(size_t j1 = 0; j1 < p; j1++)
+            {
+                const fpType delta1 = mean[j1] - sum[j1] * invNPrevious;
+                for(size_t j2 = 0; j2 < p; j2++)
+                {
+                    const fpType delta2 = mean[j2] - sum[j2] * invNPrevious;
+                    crossProduct[j1 * p + j2] += cp[j1 * p + j2] + factor * delta1 * delta2;
+                }
+            }
+        }
+
+        if(!isUserMean)
+        {
+            for(size_t j = 0; j < p; j++)
+            {
+                sum[j] = (nPrevious == (fpType)0 ? weight * mean[j] : sum[j] + weight * mean[j]);
+            }
+        }
+
+        daal::services::daal_free(mean);
+        return 0;
+    }
+
+    static int xxcp_weight(fpType *data, __int64 nFeatures, __int64 nVectors, fpType *weight, fpType *accumWeight, fpType *mean,
+                           fpType *crossProduct, __int64 method)
+    {
+        /* The function is called by the parallel loops of the algorithms and runs in the calling thread */
+        if(!Kernels::computeMoments(data, (size_t)nFeatures, (size_t)nVectors, weight, true, 0, false, *accumWeight, mean, crossProduct))
+        {
+            return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE;
+        }
+        return 0;
+    }
+
+    static int x2c_mom(fpType *data, __int64 nFeatures, __int64 nVectors, fpType *variance, __int64 method)
+    {
+        const size_t p = (size_t)nFeatures;
+        fpType *mean = daal::services::internal::service_calloc<fpType, cpu>(p);
+        if(!mean) { return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE; }
+
+        fpType weight = 0;
+        const bool isValid = Kernels::computeMoments(data, p, (size_t)nVectors, 0, false, 0, true, weight, mean, variance);
+        const fpType invDegrees = (weight > (fpType)1.0 ? (fpType)1.0 / (weight - (fpType)1.0) : (fpType)0.0);
+        for(size_t j = 0; j < p; j++)
+        {
+            variance[j] *= invDegrees;
+        }
+
+        daal::services::daal_free(mean);
+        return (isValid ? 0 : __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE);
+    }
+
+    static int xoutlierdetection(fpType *data, __int64 nFeatures, __int64 nVectors, __int64 nParams,
+                                 fpType *baconParams, fpType *baconWeights)
+    {
+        if(nParams < 3 || !(baconParams[1] > (fpType)0 && baconParams[1] < (fpType)1) || !(baconParams[2] >= (fpType)0))
+        {
+            return __DAAL_VSL_SS_ERROR_BAD_BACON_PARAMS;
+        }
+        return Kernels::bacon(data, (size_t)nFeatures, (size_t)nVectors, (int)baconParams[0], (double)baconParams[1],
+                              (double)baconParams[2], baconWeights);
+    }
+
+    static int xLowOrderMoments(fpType *data, __int64 nFeatures, __int64 nVectors, __int64 method,
+                                fpType *sum, fpType *mean, fpType *secondOrderRawMoment,
+                                fpType *variance, fpType *variation)
+    {
+        fpType nPreviousObservations = 0;
+        int errcode = xSumAndVariance(data, nFeatures, nVectors, &nPreviousObservations, method, sum, mean,
+                                      secondOrderRawMoment, variance);
+        if(errcode) { return errcode; }
+
+        for(size_t j = 0; j < (size_t)nFeatures; j++)
+        {
+            variation[j] = (fpType)::sqrt((double)variance[j]) / mean[j];
+        }
+        return 0;
+    }
+
+    static int xSumAndVariance(fpType *data, __int64 nFeatures, __int64 nVectors, fpType *nPreviousObservations,
+                               __int64 method, fpType *sum, fpType *mean, fpType *secondOrderRawMoment,
+                               fpType *variance)
+    {
+        const size_t p = (size_t)nFeatures;
+        const bool isUserMean = (method == __DAAL_VSL_SS_METHOD_FAST_USER_MEAN);
+
+        fpType *blockMean = daal::services::internal::service_calloc<fpType, cpu>(2 * p);
+        if(!blockMean) { return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE; }
+        fpType *blockSumSquares = blockMean + p;
+
+        if(isUserMean)
+        {
+            for(size_t j = 0; j < p; j++)
+            {
+                blockMean[j] = mean[j];
+            }
+        }
+
+        fpType weight = 0;
+        if(!Kernels::computeMoments(data, p, (size_t)nVectors, 0, false, (isUserMean ? blockMean : 0), true,
+                                    weight, blockMean, blockSumSquares))
+        {
+            daal::services::daal_free(blockMean);
+            return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE;
+        }
+
+        /* The moments of the previous observations are updated by the block */
+        const fpType nPrevious = *nPreviousObservations;
+        const fpType nTotal = nPrevious + weight;
+        const fpType invNTotal = (nTotal > (fpType)0 ? (fpType)1.0 / nTotal : (fpType)0.0);
+        const fpType invDegrees = (nTotal > (fpType)1.0 ? (fpType)1.0 / (nTotal - (fpType)1.0) : (fpType)0.0);
+        for(size_t j = 0; j < p; j++)
+        {
+            fpType sumSquares = blockSumSquares[j];
+            fpType rawSumSquares = blockSumSquares[j] + weight * blockMean[j] * blockMean[j];
+            fpType newMean = blockMean[j];
+            if(nPrevious > (fpType)0)
+            {
+                const fpType previousMean = sum[j] / nPrevious;
+                const fpType delta = blockMean[j] - previousMean;
+                sumSquares += variance[j] * (nPrevious - (fpType)1.0) + delta * delta * nPrevious * weight * invNTotal;
+                rawSumSquares += secondOrderRawMoment[j] * nPrevious;
+                newMean = previousMean + delta * weight * invNTotal;
+            }
+
+            if(!isUserMean)
+            {
+                sum[j]  = (nPrevious > (fpType)0 ? sum[j] : (fpType)0.0) + weight * blockMean[j];
+                mean[j] = newMean;
+            }
+            secondOrderRawMoment[j] = rawSumSquares * invNTotal;
+            variance[j] = sumSquares * invDegrees;
+        }
+
+        daal::services::daal_free(blockMean);
+        return 0;
+    }
+
+    static int xQuantiles(fpType *data, __int64 nFeatures, __int64 nVectors, __int64 quantOrderN, fpType *quantOrder, fpType *quants)
+    {
+        for(size_t k = 0; k < (size_t)quantOrderN; k++)
+        {
+            if(!(quantOrder[k] >= (fpType)0 && quantOrder[k] <= (fpType)1)) { return __DAAL_VSL_SS_ERROR_BAD_QUANT_ORDER; }
+        }
+        if(nVectors <= 0) { return 0; }
+
+        if(!Kernels::computeQuantiles(data, (size_t)nFeatures, (size_t)nVectors, (size_t)quantOrderN, quantOrder, quants))
+        {
+            return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE;
+        }
+        return 0;
+    }
+
+    static int xSort(fpType *data, __int64 nFeatures, __int64 nVectors, fpType *sortedData)
+    {
+        if(nVectors <= 0) { return 0; }
+
+        if(!Kernels::sortFeatures(data, (size_t)nFeatures, (size_t)nVectors, sortedData))
+        {
+            return __DAAL_VSL_SS_ERROR_ALLOCATION_FAILURE;
+        }
+        return 0;
+    }
+};
+
+} // namespace vec
+} // namespace internal
+} // namespace daal
+
+#endif
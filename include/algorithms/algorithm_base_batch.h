@@ -24,7 +24,10 @@
 #ifndef __ALGORITHM_BASE_BATCH_H__
 #define __ALGORITHM_BASE_BATCH_H__
 
+#include <typeinfo>
 #include "services/daal_memory.h"
+#include "services/daal_profiler.h"
+#include "services/daal_thread_arena.h"
 
 namespace daal
 {
@@ -48,7 +51,7 @@ template<> class AlgorithmContainerIface<batch>
 public:
     /** Default constructor */
     AlgorithmContainerIface(daal::services::Environment::env *daalEnv = 0): _par(0), _in(0), _res(0), _env(daalEnv),
-        _errors(new services::ErrorCollection()), _kernel(NULL) {};
+        _errors(new services::ErrorCollection()), _kernel(NULL), _arena(NULL) {};
 
     virtual ~AlgorithmContainerIface() {}
 
@@ -61,6 +64,15 @@ public:
         _env = daalEnv;
     }
 
+    /**
+     * Sets the arena of threads that runs the computations of the algorithm
+     * \param[in] arena   Pointer to the arena, NULL to run the computations by all threads of the library
+     */
+    void setThreadArena(services::ThreadArena *arena)
+    {
+        _arena = arena;
+    }
+
     /**
      * Sets arguments of the algorithm
      * \param[in] in    Pointer to the input arguments of the algorithm
@@ -176,6 +188,25 @@ protected:
     services::SharedPtr<services::ErrorCollection> _errors;
 
     Kernel *_kernel;
+    services::ThreadArena *_arena;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ALGORITHMCONTAINERTASK"></a>
+ * \brief Runs the method compute() of the container of the %batch processing algorithm in the arena of threads
+ */
+template<> class AlgorithmContainerTask<batch> : public services::ThreadArenaTask
+{
+public:
+    AlgorithmContainerTask(AlgorithmContainerIface<batch> *container) : _container(container) {}
+
+    virtual void run()
+    {
+        _container->compute();
+    }
+
+private:
+    AlgorithmContainerIface<batch> *_container;
 };
 
 /**
@@ -209,8 +240,15 @@ public:
 
     virtual void compute()
     {
+        DAAL_PROFILER_CPU_TASK(profilerAlgorithmCompute, typeid(*_cntr).name(), this->_env->cpuid);
         _cntr->setArguments(this->_in, this->_res, this->_par);
         _cntr->setErrorCollection(this->_errors);
+        if(this->_arena)
+        {
+            AlgorithmContainerTask<batch> task(_cntr);
+            this->_arena->execute(task);
+            return;
+        }
         _cntr->compute();
     }
 
@@ -253,6 +291,24 @@ public:
         return _errors;
     }
 
+    /**
+     * Sets the arena of threads that runs the computations of the algorithm
+     * \param[in] arena   Arena of threads, empty pointer to run the computations by all threads of the library
+     */
+    void setThreadArena(const services::SharedPtr<services::ThreadArena> &arena)
+    {
+        _threadArena = arena;
+    }
+
+    /**
+     * Returns the arena of threads that runs the computations of the algorithm
+     * \return Arena of threads
+     */
+    services::SharedPtr<services::ThreadArena> getThreadArena() const
+    {
+        return _threadArena;
+    }
+
 protected:
     void allocateInputMemory()
     {
@@ -298,6 +354,7 @@ protected:
     Input     *_in;
     Result    *_res;
     services::SharedPtr<services::ErrorCollection> _errors;
+    services::SharedPtr<services::ThreadArena> _threadArena;
 };
 } // namespace interface1
 using interface1::AlgorithmContainerIface;
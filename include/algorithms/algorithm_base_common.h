@@ -24,7 +24,10 @@
 #ifndef __ALGORITHM_BASE_COMMON_H__
 #define __ALGORITHM_BASE_COMMON_H__
 
+#include <typeinfo>
 #include "services/daal_memory.h"
+#include "services/daal_profiler.h"
+#include "services/daal_thread_arena.h"
 
 namespace daal
 {
@@ -76,7 +79,7 @@ public:
     /** Default constructor. Constructs empty container */
     AlgorithmContainerIface(daal::services::Environment::env *daalEnv = 0) : _in(0), _pres(0), _res(0), _par(0),
         _env(daalEnv), _errors(new services::ErrorCollection()),
-        _kernel(NULL) {};
+        _kernel(NULL), _arena(NULL) {};
 
     virtual ~AlgorithmContainerIface() {}
 
@@ -124,6 +127,15 @@ public:
         }
     }
 
+    /**
+     * Sets the arena of threads that runs the computations of the algorithm
+     * \param[in] arena   Pointer to the arena, NULL to run the computations by all threads of the library
+     */
+    void setThreadArena(services::ThreadArena *arena)
+    {
+        _arena = arena;
+    }
+
     /**
      * Sets partial results of the algorithm
      * \param[in] pres   Pointer to the partial results of the algorithm
@@ -229,6 +241,36 @@ protected:
     services::SharedPtr<services::ErrorCollection> _errors;
 
     Kernel *_kernel;
+    services::ThreadArena *_arena;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ALGORITHMCONTAINERTASK"></a>
+ * \brief Runs the method compute() or finalizeCompute() of the container in the arena of threads
+ * \tparam mode Computation mode of the algorithm, \ref ComputeMode
+ */
+template<ComputeMode mode>
+class AlgorithmContainerTask : public services::ThreadArenaTask
+{
+public:
+    AlgorithmContainerTask(AlgorithmContainerIface<mode> *container, bool isFinalizeCompute = false) :
+        _container(container), _isFinalizeCompute(isFinalizeCompute) {}
+
+    virtual void run()
+    {
+        if(_isFinalizeCompute)
+        {
+            _container->finalizeCompute();
+        }
+        else
+        {
+            _container->compute();
+        }
+    }
+
+private:
+    AlgorithmContainerIface<mode> *_container;
+    bool _isFinalizeCompute;
 };
 
 /**
@@ -262,16 +304,30 @@ public:
 
     virtual void compute()
     {
+        DAAL_PROFILER_CPU_TASK(profilerAlgorithmCompute, typeid(*_cntr).name(), this->_env->cpuid);
         _cntr->setArguments(this->_in, this->_pres, this->_par);
         _cntr->setErrorCollection(this->_errors);
+        if(this->_arena)
+        {
+            AlgorithmContainerTask<mode> task(_cntr);
+            this->_arena->execute(task);
+            return;
+        }
         _cntr->compute();
     }
 
     virtual void finalizeCompute()
     {
+        DAAL_PROFILER_CPU_TASK(profilerAlgorithmFinalizeCompute, typeid(*_cntr).name(), this->_env->cpuid);
         _cntr->setArguments(this->_in, this->_pres, this->_par);
         _cntr->setResult(this->_res);
         _cntr->setErrorCollection(this->_errors);
+        if(this->_arena)
+        {
+            AlgorithmContainerTask<mode> task(_cntr, true);
+            this->_arena->execute(task);
+            return;
+        }
         _cntr->finalizeCompute();
     }
 
@@ -369,6 +425,24 @@ public:
         return _errors;
     }
 
+    /**
+     * Sets the arena of threads that runs the computations of the algorithm
+     * \param[in] arena   Arena of threads, empty pointer to run the computations by all threads of the library
+     */
+    void setThreadArena(const services::SharedPtr<services::ThreadArena> &arena)
+    {
+        _threadArena = arena;
+    }
+
+    /**
+     * Returns the arena of threads that runs the computations of the algorithm
+     * \return Arena of threads
+     */
+    services::SharedPtr<services::ThreadArena> getThreadArena() const
+    {
+        return _threadArena;
+    }
+
 protected:
     PartialResult *allocatePartialResultMemory()
     {
@@ -436,10 +510,12 @@ protected:
     Result        *_res;
     Parameter     *_par;
     services::SharedPtr<services::ErrorCollection> _errors;
+    services::SharedPtr<services::ThreadArena> _threadArena;
 };
 } // namespace interface1
 using interface1::Kernel;
 using interface1::AlgorithmContainerIface;
+using interface1::AlgorithmContainerTask;
 using interface1::AlgorithmDispatchContainer;
 using interface1::AlgorithmIface;
 using interface1::Algorithm;
@@ -91,6 +91,7 @@ public:
 
         this->_ac->setArguments(this->_in,  this->_pres, this->_par);
         this->_ac->setErrorCollection(this->_errors);
+        this->_ac->setThreadArena(this->_threadArena.get());
         this->_pres->setErrorCollection(this->_errors);
 
 #if defined(DAAL_CHECK_PARAMETER)
@@ -134,6 +135,7 @@ public:
         this->_ac->setPartialResult(this->_pres);
         this->_ac->setResult(this->_res);
         this->_ac->setErrorCollection(this->_errors);
+        this->_ac->setThreadArena(this->_threadArena.get());
 
         if(this->_res)
         {
@@ -293,6 +295,7 @@ public:
 
         this->_ac->setArguments(this->_in, this->_res, this->_par);
         this->_ac->setErrorCollection(this->_errors);
+        this->_ac->setThreadArena(this->_threadArena.get());
 
         this->_res->setErrorCollection(this->_errors);
 
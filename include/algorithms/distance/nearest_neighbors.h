@@ -0,0 +1,175 @@
+/* file: nearest_neighbors.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the nearest neighbors search algorithm.
+//--
+*/
+
+#ifndef __NEAREST_NEIGHBORS_H__
+#define __NEAREST_NEIGHBORS_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/distance/nearest_neighbors_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace nearest_neighbors
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEAREST_NEIGHBORS__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the nearest neighbors search algorithm.
+ *        This class is associated with daal::algorithms::nearest_neighbors::Batch class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the nearest neighbors search, double or float
+ * \tparam method           Nearest neighbors search method, \ref Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    ~BatchContainer();
+    /**
+     * Runs implementation of the nearest neighbors search algorithm in the batch processing mode
+     */
+    virtual void compute();
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEAREST_NEIGHBORS__BATCH"></a>
+ * \brief Searches the k nearest reference vectors for every query vector in the batch processing mode.
+ *        The distances between the query and the reference vectors are computed by tiles
+ *        and only k nearest neighbors per query vector are kept, so the full matrix of distances is never stored
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the nearest neighbors search, double or float
+ * \tparam method           Nearest neighbors search method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Nearest neighbors search methods
+ *      - \ref InputId  Identifiers of nearest neighbors search input objects
+ *      - \ref ResultId Identifiers of nearest neighbors search results
+ *
+ * \par References
+ *      - Parameter class
+ *      - Input class
+ *      - Result class
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    /**
+     * Constructs the nearest neighbors search algorithm
+     * \param[in] k Number of nearest neighbors to search for every query vector
+     */
+    Batch(size_t k = 1) : parameter(k)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the nearest neighbors search algorithm by copying input objects and parameters
+     * of another nearest neighbors search algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(queryData,     other.input.get(queryData));
+        input.set(referenceData, other.input.get(referenceData));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the nearest neighbors
+     * \return Structure that contains the nearest neighbors
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Sets the memory to store results of the nearest neighbors search algorithm
+     * \param[in] res  Structure to store results of the algorithm
+     */
+    void setResult(services::SharedPtr<Result> res)
+    {
+        _result = res;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated nearest neighbors search algorithm with a copy of input objects
+     * and parameters of this nearest neighbors search algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult()
+    {
+        _result->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< %Parameters of the algorithm */
+
+private:
+    services::SharedPtr<Result> _result;
+};
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace nearest_neighbors
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,267 @@
+/* file: nearest_neighbors_types.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the nearest neighbors search algorithm.
+//--
+*/
+
+#ifndef __NEAREST_NEIGHBORS_TYPES_H__
+#define __NEAREST_NEIGHBORS_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+* \brief Contains classes for the search of the nearest neighbors of query vectors among reference vectors
+*/
+namespace nearest_neighbors
+{
+
+/**
+ * <a name="DAAL-ENUM-NEAREST_NEIGHBORS__METHOD"></a>
+ * Available methods for the search of the nearest neighbors
+ */
+enum Method
+{
+    defaultDense     = 0,   /*!< Default: neighbors in terms of the cosine distance */
+    correlationDense = 1    /*!< Neighbors in terms of the correlation distance */
+};
+
+/**
+ * <a name="DAAL-ENUM-NEAREST_NEIGHBORS__INPUTID"></a>
+ * Available identifiers of input objects for the nearest neighbors search algorithm
+ */
+enum InputId
+{
+    queryData     = 0,      /*!< %Input table with the query feature vectors */
+    referenceData = 1       /*!< %Input table with the reference feature vectors */
+};
+
+/**
+ * <a name="DAAL-ENUM-NEAREST_NEIGHBORS__RESULTID"></a>
+ * Available identifiers of results for the nearest neighbors search algorithm
+ */
+enum ResultId
+{
+    indices   = 0,          /*!< Table of size nQueries x k with indices of the nearest reference vectors */
+    distances = 1           /*!< Table of size nQueries x k with distances to the nearest reference vectors */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-NEAREST_NEIGHBORS__PARAMETER"></a>
+ * \brief Parameters of the nearest neighbors search algorithm
+ *
+ * \snippet distance/nearest_neighbors_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Constructs parameters of the nearest neighbors search algorithm
+     *  \param[in] k    Number of nearest neighbors to search for every query vector
+     */
+    Parameter(size_t k = 1) : k(k) {}
+
+    size_t k;           /*!< Number of nearest neighbors to search for every query vector */
+
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if(k == 0) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-NEAREST_NEIGHBORS__INPUT"></a>
+ * \brief %Input objects for the nearest neighbors search algorithm
+ */
+class Input : public daal::algorithms::Input
+{
+public:
+    Input() : daal::algorithms::Input(2) {}
+
+    virtual ~Input() {}
+
+    /**
+    * Returns the input object of the nearest neighbors search algorithm
+    * \param[in] id    Identifier of the input object
+    * \return          %Input object that corresponds to the given identifier
+    */
+    services::SharedPtr<data_management::NumericTable> get(InputId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+    * Sets the input object for the nearest neighbors search algorithm
+    * \param[in] id    Identifier of the input object
+    * \param[in] ptr   Pointer to the object
+    */
+    void set(InputId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+    * Checks the input objects of the nearest neighbors search algorithm
+    * \param[in] par     %Parameter of the algorithm
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 2) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        services::SharedPtr<data_management::NumericTable> queryTable = get(queryData);
+        if(queryTable.get() == 0)                 { this->_errors->add(services::ErrorNullInputNumericTable); return;         }
+        if(queryTable->getNumberOfRows() == 0)    { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(queryTable->getNumberOfColumns() == 0) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
+
+        services::SharedPtr<data_management::NumericTable> referenceTable = get(referenceData);
+        if(referenceTable.get() == 0)                 { this->_errors->add(services::ErrorNullInputNumericTable); return;         }
+        if(referenceTable->getNumberOfRows() == 0)    { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(referenceTable->getNumberOfColumns() != queryTable->getNumberOfColumns())
+        { this->_errors->add(services::ErrorInconsistentNumberOfColumns); return; }
+
+        const Parameter *algParameter = static_cast<const Parameter *>(par);
+        if(algParameter->k > referenceTable->getNumberOfRows()) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-NEAREST_NEIGHBORS__RESULT"></a>
+ * \brief Results obtained with the compute() method of the nearest neighbors search algorithm in the batch processing mode
+ */
+class Result : public daal::algorithms::Result
+{
+public:
+    Result() : daal::algorithms::Result(2) {}
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store results of the nearest neighbors search algorithm
+     * \param[in] input  Pointer to input structure
+     * \param[in] par    Pointer to parameter structure
+     * \param[in] method Computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
+    {
+        const Input *algInput = static_cast<const Input *>(input);
+        const Parameter *algParameter = static_cast<const Parameter *>(par);
+        size_t nQueries = algInput->get(queryData)->getNumberOfRows();
+
+        Argument::set(indices, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<int>(algParameter->k, nQueries,
+                                                                        data_management::NumericTable::doAllocate)));
+        Argument::set(distances, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(algParameter->k, nQueries,
+                                                                                    data_management::NumericTable::doAllocate)));
+    }
+
+    /**
+     * Returns the result of the nearest neighbors search algorithm
+     * \param[in] id   Identifier of the result
+     * \return         %Result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(ResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the result of the nearest neighbors search algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] ptr   Pointer to the result object
+     */
+    void set(ResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+    * Checks the result of the nearest neighbors search algorithm
+    * \param[in] input   %Input of the algorithm
+    * \param[in] par     %Parameter of the algorithm
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par,
+               int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 2) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+
+        const Input *algInput = static_cast<const Input *>(input);
+        const Parameter *algParameter = static_cast<const Parameter *>(par);
+        size_t nQueries = algInput->get(queryData)->getNumberOfRows();
+
+        for(size_t i = 0; i < 2; i++)
+        {
+            services::SharedPtr<data_management::NumericTable> resTable = get((ResultId)i);
+            if(resTable.get() == 0) { this->_errors->add(services::ErrorNullOutputNumericTable); return; }
+            if(resTable->getNumberOfRows() != nQueries || resTable->getNumberOfColumns() != algParameter->k)
+            {
+                this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return;
+            }
+        }
+    }
+
+    int getSerializationTag() { return SERIALIZATION_NEAREST_NEIGHBORS_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+
+} // namespace nearest_neighbors
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,240 @@
+/* file: gbt_model.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the gradient boosted trees model.
+//--
+*/
+
+#ifndef __GBT_MODEL_H__
+#define __GBT_MODEL_H__
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/model.h"
+#include "algorithms/classifier/classifier_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * \brief Contains classes of the gradient boosted trees algorithm
+ */
+namespace gbt
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__LOSSFUNCTIONID"></a>
+ * Available loss functions of the gradient boosted trees algorithm
+ */
+enum LossFunctionId
+{
+    squaredLoss  = 0,   /*!< Squared loss, used for regression */
+    logisticLoss = 1    /*!< Logistic loss, used for binary classification */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__NODEATTRIBUTEID"></a>
+ * Columns of the numeric table that stores the nodes of the trees
+ */
+enum NodeAttributeId
+{
+    splitFeature    = 0,    /*!< Index of the feature used in the split of the node, -1 for leaves */
+    splitValue      = 1,    /*!< Observations with the feature value less than the split value go to the left child */
+    leftChild       = 2,    /*!< Index of the left child of the node. The right child follows the left one */
+    response        = 3,    /*!< Response of the leaf */
+    nNodeAttributes = 4     /*!< Number of the columns in the table of nodes */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__PARAMETER"></a>
+ * \brief Optional parameters of the gradient boosted trees algorithm.
+ *        With the logistic loss the labels are expected to be -1 and 1, as for other binary classifiers
+ *
+ * \snippet gbt/gbt_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct Parameter : public classifier::Parameter
+{
+    Parameter(LossFunctionId lossFunction = logisticLoss,
+              size_t nIterations = 100,
+              size_t maxTreeDepth = 6,
+              double shrinkage = 0.3,
+              double lambda = 1.0,
+              size_t minObservationsInLeafNode = 5,
+              size_t maxBins = 256) :
+        lossFunction(lossFunction), nIterations(nIterations), maxTreeDepth(maxTreeDepth), shrinkage(shrinkage),
+        lambda(lambda), minObservationsInLeafNode(minObservationsInLeafNode), maxBins(maxBins) {}
+
+    LossFunctionId lossFunction;        /*!< Loss function minimized by the algorithm */
+    size_t nIterations;                 /*!< Number of trees in the model */
+    size_t maxTreeDepth;                /*!< Maximal depth of a tree */
+    double shrinkage;                   /*!< Learning rate the responses of the leaves are multiplied by */
+    double lambda;                      /*!< L2 regularization of the responses of the leaves */
+    size_t minObservationsInLeafNode;   /*!< Minimal number of observations in a leaf */
+    size_t maxBins;                     /*!< Maximal number of bins the values of a feature are quantized into, from 2 to 256 */
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual void check() const
+    {
+        if(nIterations == 0)               { addIncorrectParameterError("nIterations"); }
+        if(shrinkage <= 0.0)               { addIncorrectParameterError("shrinkage"); }
+        if(lambda < 0.0)                   { addIncorrectParameterError("lambda"); }
+        if(minObservationsInLeafNode == 0) { addIncorrectParameterError("minObservationsInLeafNode"); }
+        if(maxBins < 2 || maxBins > 256)   { addIncorrectParameterError("maxBins"); }
+    }
+
+private:
+    void addIncorrectParameterError(const char *name) const
+    {
+        services::SharedPtr<services::Error> error(new services::Error());
+        error->setId(services::ErrorIncorrectParameter);
+        error->addStringDetail(services::ArgumentName, name);
+        this->_errors->add(error);
+    }
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__MODEL"></a>
+ * \brief %Model of the gradient boosted trees trained by the gbt::training::Batch algorithm.
+ *        The nodes of all trees are stored in one numeric table, one node per row, see \ref NodeAttributeId
+ *
+ * \par References
+ *      - Parameter class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class Model : public classifier::Model
+{
+public:
+    /**
+     * Constructs the gradient boosted trees model
+     * \tparam modelFPType  Data type to store the model data, double or float
+     * \param[in] dummy     Dummy variable for the templated constructor
+     * \param[in] nFeatures Number of features in the training data set
+     */
+    template<typename modelFPType>
+    Model(modelFPType dummy, size_t nFeatures) :
+        classifier::Model(), _nFeatures(nFeatures), _lossFunction(logisticLoss), _baseResponse(0.0)
+    {
+        _nodes = services::SharedPtr<data_management::NumericTable>(
+                     new data_management::HomogenNumericTable<modelFPType>(NULL, nNodeAttributes, 0));
+        _treeRoots = services::SharedPtr<data_management::NumericTable>(
+                         new data_management::HomogenNumericTable<int>(NULL, 1, 0));
+    }
+
+    /**
+     * Empty constructor for deserialization
+     */
+    Model() : _nodes(), _treeRoots(), _nFeatures(0), _lossFunction(logisticLoss), _baseResponse(0.0) {}
+
+    virtual ~Model() {}
+
+    /**
+     * Returns the nodes of the trees
+     * \return Numeric table of size nNodes x \ref nNodeAttributes
+     */
+    services::SharedPtr<data_management::NumericTable> getNodes() { return _nodes; }
+
+    /**
+     * Returns the indices of the root nodes of the trees
+     * \return Numeric table of size nTrees x 1
+     */
+    services::SharedPtr<data_management::NumericTable> getTreeRoots() { return _treeRoots; }
+
+    /**
+     * Returns the number of trees in the model
+     * \return Number of trees
+     */
+    size_t getNumberOfTrees() { return (_treeRoots ? _treeRoots->getNumberOfRows() : 0); }
+
+    /**
+     * Returns the response the responses of the trees are added to
+     * \return Base response of the model
+     */
+    double getBaseResponse() { return _baseResponse; }
+
+    /**
+     * Sets the response the responses of the trees are added to
+     * \param[in] baseResponse  Base response of the model
+     */
+    void setBaseResponse(double baseResponse) { _baseResponse = baseResponse; }
+
+    /**
+     * Returns the loss function the model was trained with
+     * \return Loss function
+     */
+    LossFunctionId getLossFunction() { return _lossFunction; }
+
+    /**
+     * Sets the loss function the model was trained with
+     * \param[in] lossFunction  Loss function
+     */
+    void setLossFunction(LossFunctionId lossFunction) { _lossFunction = lossFunction; }
+
+    virtual size_t getNFeatures() DAAL_C11_OVERRIDE { return _nFeatures; }
+
+    int getSerializationTag() { return SERIALIZATION_GBT_MODEL_ID; }
+    /**
+     *  Serializes the model object
+     *  \param[in]  archive  Storage for the serialized object or data structure
+     */
+    void serializeImpl(data_management::InputDataArchive *archive)
+    {serialImpl<data_management::InputDataArchive, false>(archive);}
+
+    /**
+     *  Deserializes the model object
+     *  \param[in]  archive  Storage for the deserialized object or data structure
+     */
+    void deserializeImpl(data_management::OutputDataArchive *archive)
+    {serialImpl<data_management::OutputDataArchive, true>(archive);}
+
+protected:
+    services::SharedPtr<data_management::NumericTable> _nodes;      /*!< \private Nodes of the trees */
+    services::SharedPtr<data_management::NumericTable> _treeRoots;  /*!< \private Indices of the root nodes */
+    size_t _nFeatures;                                              /*!< \private Number of features */
+    LossFunctionId _lossFunction;                                   /*!< \private Loss function */
+    double _baseResponse;                                           /*!< \private Base response */
+
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::classifier::Model::serialImpl<Archive, onDeserialize>(arch);
+
+        arch->setSharedPtrObj(_nodes);
+        arch->setSharedPtrObj(_treeRoots);
+        arch->set(_nFeatures);
+        arch->set(_lossFunction);
+        arch->set(_baseResponse);
+    }
+};
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Model;
+
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
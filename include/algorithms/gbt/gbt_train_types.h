@@ -0,0 +1,126 @@
+/* file: gbt_train_types.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of the result of the gradient boosted trees training algorithm
+//--
+*/
+
+#ifndef __GBT_TRAIN_TYPES_H__
+#define __GBT_TRAIN_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/gbt/gbt_model.h"
+#include "algorithms/classifier/classifier_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+/**
+ * \brief Contains classes to train the gradient boosted trees model
+ */
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__METHOD"></a>
+ * Available methods to train the gradient boosted trees model
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Histogram-based method: the features are quantized into bins once
+                             and the splits are searched in the histograms of the gradients */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the
+ *        gradient boosted trees training algorithm in the batch processing mode
+ */
+class Result : public classifier::training::Result
+{
+public:
+    Result() : classifier::training::Result() {}
+
+    virtual ~Result() {}
+
+    /**
+     * Returns the model trained with the gradient boosted trees algorithm
+     * \param[in] id    Identifier of the result, \ref classifier::training::ResultId
+     * \return          Model trained with the gradient boosted trees algorithm
+     */
+    services::SharedPtr<daal::algorithms::gbt::Model> get(classifier::training::ResultId id) const
+    {
+        return services::staticPointerCast<daal::algorithms::gbt::Model, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Allocates memory for storing results of the gradient boosted trees training
+     * \param[in] input     Pointer to input structure
+     * \param[in] parameter Pointer to parameter structure
+     * \param[in] method    Algorithm method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const classifier::training::Input *algInput = static_cast<const classifier::training::Input *>(input);
+
+        algorithmFPType dummy = 1.0;
+        set(classifier::training::model, services::SharedPtr<gbt::Model>(
+                new gbt::Model(dummy, algInput->get(classifier::training::data)->getNumberOfColumns())));
+    }
+
+    int getSerializationTag() { return SERIALIZATION_GBT_TRAINING_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+} // namespace interface1
+using interface1::Result;
+
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -53,6 +53,8 @@ enum Method
     defaultDense = 0,      /*!< Default: performance-oriented method. Works with all types of numeric tables */
     sumDense     = 1,      /*!< Precomputed sum: implementation of algorithm in the case of a precomputed sum.
                                      Works with all types of numeric tables */
+    fusedDense   = 2       /*!< Fused: means and standard deviations are computed in one parallel pass over the data
+                                     without the low order moments algorithm. Works with all types of numeric tables */
 };
 
 /**
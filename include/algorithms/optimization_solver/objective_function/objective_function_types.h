@@ -61,7 +61,9 @@ enum ResultToComputeId
 {
     gradient = 0x00000001ULL, /*!< Numeric table of size 1 x p with the gradient of the objective function in the given argument */
     value    = 0x00000002ULL, /*!< Numeric table of size 1 x 1 with the value    of the objective function in the given argument */
-    hessian  = 0x00000004ULL  /*!< Numeric table of size p x p with the hessian  of the objective function in the given argument */
+    hessian  = 0x00000004ULL, /*!< Numeric table of size p x p with the hessian  of the objective function in the given argument */
+    hessianVectorProduct = 0x00000008ULL /*!< Numeric table of size 1 x p with the hessian of the objective function in the given argument
+                                              multiplied by the vector set in the result collection at hessianVectorIdx */
 };
 
 /**
@@ -81,7 +83,11 @@ enum ResultCollectionId
 {
     gradientIdx = 0, /*!< Index of the gradient numeric table in the result collection */
     valueIdx = 1,    /*!< Index of the value numeric table in the result collection */
-    hessianIdx = 2   /*!< Index of the hessian numeric table in the result collection */
+    hessianIdx = 2,  /*!< Index of the hessian numeric table in the result collection */
+    hessianVectorProductIdx = 3, /*!< Index of the hessian-vector product numeric table in the result collection */
+    hessianVectorIdx = 4         /*!< Index of the numeric table of size 1 x p with the vector the hessian is multiplied by.
+                                      The table is set in the result collection before the hessian-vector product is computed
+                                      and is kept when the result is allocated */
 };
 
 /**
@@ -224,7 +230,8 @@ public:
 
         size_t nCols = algInput->get(argument)->getNumberOfColumns();
 
-        SharedPtr<DataCollection> collection = SharedPtr<DataCollection>(new DataCollection(3));
+        SharedPtr<DataCollection> collection = SharedPtr<DataCollection>(new DataCollection(5));
+        (*collection)[(int)hessianVectorIdx] = getHessianVector();
 
         if(algParameter->resultsToCompute & gradient)
         {
@@ -241,6 +248,11 @@ public:
             (*collection)[(int)hessianIdx] =
                 SharedPtr<SerializationIface>(new HomogenNumericTable<algorithmFPType>(nCols, nCols, NumericTable::doAllocate, 0));
         }
+        if(algParameter->resultsToCompute & hessianVectorProduct)
+        {
+            (*collection)[(int)hessianVectorProductIdx] =
+                SharedPtr<SerializationIface>(new HomogenNumericTable<algorithmFPType>(nCols, 1, NumericTable::doAllocate, 0));
+        }
 
         Argument::set(resultCollection, staticPointerCast<DataCollection, SerializationIface>(collection));
     }
@@ -314,6 +326,14 @@ public:
             error = checkTable(get(resultCollection, hessianIdx), "hessian", nFeatures, nFeatures);
             if(error->id() != NoErrorMessageFound) { this->_errors->add(error); return; }
         }
+        if(algParameter->resultsToCompute & hessianVectorProduct)
+        {
+            error = checkHessianVector(staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(getHessianVector()),
+                                       1, nFeatures);
+            if(error->id() != NoErrorMessageFound) { this->_errors->add(error); return; }
+            error = checkTable(get(resultCollection, hessianVectorProductIdx), "hessianVectorProduct", 1, nFeatures);
+            if(error->id() != NoErrorMessageFound) { this->_errors->add(error); return; }
+        }
     }
 
     /**
@@ -361,6 +381,37 @@ protected:
         if(error->id() != services::NoErrorMessageFound)     { error->addStringDetail(services::ArgumentName, argumentName); }
         return error;
     }
+
+    /**
+     * Returns the vector the hessian is multiplied by from the current result collection
+     * \return Pointer to the vector, NULL if it is not set
+     */
+    services::SharedPtr<data_management::SerializationIface> getHessianVector() const
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(resultCollection);
+        if(!collection || collection->size() <= (size_t)hessianVectorIdx)
+        {
+            return services::SharedPtr<data_management::SerializationIface>();
+        }
+        return (*collection)[(int)hessianVectorIdx];
+    }
+
+    /**
+     * Checks the correctness of the vector the hessian is multiplied by
+     * \param[in] nt              Pointer to the numeric table with the vector
+     * \param[in] requiredRows    Number of required rows
+     * \param[in] requiredColumns Number of required columns
+     */
+    services::SharedPtr<services::Error> checkHessianVector(services::SharedPtr<data_management::NumericTable> nt,
+                                                            size_t requiredRows, size_t requiredColumns) const
+    {
+        services::SharedPtr<services::Error> error(new services::Error());
+        if(!nt)                                              { error->setId(services::ErrorNullInputNumericTable); }
+        else if(nt->getNumberOfRows()    != requiredRows)    { error->setId(services::ErrorIncorrectNumberOfObservations); }
+        else if(nt->getNumberOfColumns() != requiredColumns) { error->setId(services::ErrorInconsistentNumberOfColumns); }
+        if(error->id() != services::NoErrorMessageFound)     { error->addStringDetail(services::ArgumentName, "hessianVector"); }
+        return error;
+    }
 };
 } // namespace interface1
 using interface1::Parameter;
@@ -41,7 +41,10 @@ namespace quantiles
  */
 enum Method
 {
-    defaultDense = 0    /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    defaultDense = 0    /*!< Default: performance-oriented method. Works with all types of input numeric tables.
+                             In the batch processing mode the quantiles are the exact order statistics of the features.
+                             In the online and distributed processing modes the quantiles are estimated
+                             from the sketches of the features of bounded size */
 };
 
 /**
@@ -62,6 +65,31 @@ enum ResultId
     quantiles = 0       /*!< Values of quantiles */
 };
 
+const size_t nPartialResults = 4;
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantiles algorithm.
+ * The partial results are the t-digest sketches of the features, one row per feature.
+ * A sketch is the sequence of the centroids ordered by their means, the unused centroids have zero weights
+ */
+enum PartialResultId
+{
+    partialCentroidMeans   = 0,     /*!< Means of the centroids of the sketches */
+    partialCentroidWeights = 1,     /*!< Numbers of the observations represented by the centroids of the sketches */
+    partialMinimum         = 2,     /*!< Partial minimum */
+    partialMaximum         = 3      /*!< Partial maximum */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__MASTERINPUTID"></a>
+ * \brief Available identifiers of input objects for the quantiles algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults = 0  /*!< Collection of partial results computed on local nodes */
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -73,8 +101,9 @@ namespace interface1
  */
 struct Parameter : public daal::algorithms::Parameter
 {
-    Parameter(const services::SharedPtr<data_management::NumericTable> quantileOrders = services::SharedPtr<data_management::NumericTable>())
-        : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+    Parameter(const services::SharedPtr<data_management::NumericTable> quantileOrders = services::SharedPtr<data_management::NumericTable>(),
+              size_t compression = 100)
+        : daal::algorithms::Parameter(), quantileOrders(quantileOrders), compression(compression)
     {
         if(quantileOrders.get() == NULL)
         {
@@ -84,20 +113,64 @@ struct Parameter : public daal::algorithms::Parameter
     }
 
     services::SharedPtr<data_management::NumericTable> quantileOrders;    /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    size_t compression;     /*!< Compression of the sketches of the features in the online and distributed processing modes.
+                                 The error of the rank of a quantile of order b is about 1 / compression of the number of observations
+                                 at the median and decreases as b (1 - b) towards the tails */
+
+    /**
+     * Returns the maximal number of the centroids in the sketch of a feature
+     * \return Maximal number of the centroids
+     */
+    size_t getMaxNumberOfCentroids() const { return 2 * compression; }
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if(compression == 0) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT_IFACE"></a>
+ * \brief Abstract class that specifies interface of the input objects for the quantiles algorithm
+ */
+class InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    virtual size_t getNumberOfFeatures() const = 0;
+    virtual ~InputIface() {}
 };
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT"></a>
  * \brief %Input objects for the quantiles algorithm
  */
-class Input : public daal::algorithms::Input
+class Input : public InputIface
 {
 public:
-    Input() : daal::algorithms::Input(1)
+    Input() : InputIface(1)
     {}
 
     virtual ~Input() {}
 
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features in the input data set
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::NumericTable> ntPtr = get(data);
+        if(ntPtr)
+        {
+            return ntPtr->getNumberOfColumns();
+        }
+        this->_errors->add(services::ErrorNullInputNumericTable);
+        return 0;
+    }
+
     /**
      * Returns an input object for the quantiles algorithm
      * \param[in] id    Identifier of the %input object
@@ -141,6 +214,150 @@ public:
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the
+ *        quantiles algorithm in the online or distributed processing mode
+ */
+class PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    PartialResult() : daal::algorithms::PartialResult(nPartialResults)
+    {}
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the quantiles algorithm.
+     * The sketches are empty, all the values of the partial results are zero
+     * \param[in] input     Input objects for the quantiles algorithm
+     * \param[in] parameter Parameters of the quantiles algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+        size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+        size_t nCentroids = par->getMaxNumberOfCentroids();
+
+        Argument::set(partialCentroidMeans, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nCentroids, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialCentroidWeights, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nCentroids, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialMinimum, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialMaximum, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+    }
+
+    /**
+     * Returns the number of features in the partial results of the quantiles algorithm
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const
+    {
+        services::SharedPtr<data_management::NumericTable> ntPtr = get(partialMinimum);
+        if(ntPtr)
+        {
+            return ntPtr->getNumberOfRows();
+        }
+        this->_errors->add(services::ErrorNullPartialResult);
+        return 0;
+    }
+
+    /**
+     * Returns the partial result of the quantiles algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(PartialResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the partial result of the quantiles algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        checkSketches(getNumberOfFeatures(), static_cast<const Parameter *>(parameter));
+    }
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] input     Pointer to the input objects
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        checkSketches(static_cast<const InputIface *>(input)->getNumberOfFeatures(), static_cast<const Parameter *>(parameter));
+    }
+
+    /**
+     * Checks that the partial result has the sketches of nFeatures features
+     * \param[in] nFeatures Number of features
+     * \param[in] parameter Pointer to the parameters structure
+     */
+    void checkSketches(size_t nFeatures, const Parameter *parameter) const
+    {
+        if(nFeatures == 0) { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+        for(size_t i = 0; i < nPartialResults; i++)
+        {
+            services::SharedPtr<data_management::NumericTable> presTable = get((PartialResultId)i);
+            if(!presTable) { this->_errors->add(services::ErrorNullPartialResult); return; }
+
+            size_t nColumns = (i == partialMinimum || i == partialMaximum ? 1 : parameter->getMaxNumberOfCentroids());
+            if(presTable->getNumberOfRows() != nFeatures || presTable->getNumberOfColumns() != nColumns)
+            {
+                this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+                return;
+            }
+        }
+    }
+
+    int getSerializationTag() { return SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
@@ -174,6 +391,26 @@ public:
                                                                                     data_management::NumericTable::doAllocate)));
     }
 
+    /**
+     * Allocates memory to store final results of the quantile algorithms in the online and distributed processing modes
+     * \param[in] partialResult Partial results of the quantiles algorithm
+     * \param[in] parameter     Parameters of the quantiles algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+
+        size_t nFeatures = pres->getNumberOfFeatures();
+        size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+        Argument::set(quantiles, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nQuantileOrders, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate)));
+    }
+
     /**
      * Returns the final result of the quantiles algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -231,6 +468,37 @@ public:
 
     }
 
+    /**
+     * Checks the correctness of the Result object in the online and distributed processing modes
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] par           Pointer to the parameters structure
+     * \param[in] method        Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        size_t nFeatures = static_cast<const PartialResult *>(partialResult)->getNumberOfFeatures();
+
+        const Parameter *parameter = static_cast<const Parameter *>(par);
+        if(parameter->quantileOrders.get() == NULL)
+        {
+            this->_errors->add(services::ErrorNullParameterNotSupported);
+            return;
+        }
+
+        services::SharedPtr<data_management::NumericTable> quantilesTable = get(quantiles);
+        if(quantilesTable.get() == NULL)
+        {
+            this->_errors->add(services::ErrorNullOutputNumericTable);
+            return;
+        }
+        if(quantilesTable->getNumberOfRows() != nFeatures ||
+           quantilesTable->getNumberOfColumns() != parameter->quantileOrders->getNumberOfColumns())
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable);
+            return;
+        }
+    }
+
     int getSerializationTag() { return SERIALIZATION_QUANTILES_RESULT_ID; }
 
     /**
@@ -255,10 +523,128 @@ protected:
         daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief Local-node input objects for the quantiles algorithm in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input()
+    {}
+
+    virtual ~DistributedInput()
+    {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode on master node
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public InputIface
+{
+public:
+    DistributedInput() : InputIface(1)
+    {
+        Argument::set(partialResults, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
+    }
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of features in the partial results computed on local nodes
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        if(collection && collection->size() > 0)
+        {
+            services::SharedPtr<PartialResult> partialResult =
+                services::staticPointerCast<PartialResult, data_management::SerializationIface>((*collection)[0]);
+            if(partialResult)
+            {
+                return partialResult->getNumberOfFeatures();
+            }
+        }
+        this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables);
+        return 0;
+    }
+
+    /**
+     * Adds a partial result to the collection of input objects of the quantiles algorithm on master node
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const services::SharedPtr<PartialResult> &partialResult)
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(id);
+        collection->push_back(services::staticPointerCast<data_management::SerializationIface, PartialResult>(partialResult));
+    }
+
+    /**
+     * Sets the input object of the quantiles algorithm on master node
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const services::SharedPtr<data_management::DataCollection> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns the collection of partial results computed on local nodes
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return         Collection of partial results
+     */
+    services::SharedPtr<data_management::DataCollection> get(MasterInputId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Checks the correctness of the input objects on master node
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        if(!collection || collection->size() == 0) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        size_t nFeatures = getNumberOfFeatures();
+        for(size_t i = 0; i < collection->size(); i++)
+        {
+            services::SharedPtr<PartialResult> partialResult =
+                services::dynamicPointerCast<PartialResult, data_management::SerializationIface>((*collection)[i]);
+            if(!partialResult) { this->_errors->add(services::ErrorNullPartialResult); return; }
+
+            partialResult->setErrorCollection(this->_errors);
+            partialResult->checkSketches(nFeatures, static_cast<const Parameter *>(parameter));
+            if(this->_errors->size() != 0) { return; }
+        }
+    }
+};
+
 } // namespace interface1
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
 using interface1::Result;
+using interface1::DistributedInput;
 
 } // namespace daal::algorithms::quantiles
 } // namespace daal::algorithms
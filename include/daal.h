@@ -22,6 +22,8 @@
 #include "services/base.h"
 #include "services/env_detect.h"
 #include "services/library_version_info.h"
+#include "services/daal_profiler.h"
+#include "services/daal_thread_arena.h"
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
@@ -31,6 +33,7 @@
 #include "data_management/data_source/csv_feature_manager.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/data_source_utils.h"
+#include "data_management/data_source/data_source_pipeline.h"
 #include "data_management/data_source/file_data_source.h"
 #include "data_management/data_source/string_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
@@ -119,6 +122,11 @@
 #include "algorithms/svm/svm_predict.h"
 #include "algorithms/svm/svm_quality_metric_set_batch.h"
 #include "algorithms/svm/svm_quality_metric_set_types.h"
+#include "algorithms/gbt/gbt_model.h"
+#include "algorithms/gbt/gbt_train_types.h"
+#include "algorithms/gbt/gbt_train.h"
+#include "algorithms/gbt/gbt_predict_types.h"
+#include "algorithms/gbt/gbt_predict.h"
 #include "algorithms/em/em_gmm.h"
 #include "algorithms/em/em_gmm_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
@@ -148,6 +156,8 @@
 #include "algorithms/distance/correlation_distance_types.h"
 #include "algorithms/distance/cosine_distance.h"
 #include "algorithms/distance/cosine_distance_types.h"
+#include "algorithms/distance/nearest_neighbors.h"
+#include "algorithms/distance/nearest_neighbors_types.h"
 #include "algorithms/boosting/adaboost_model.h"
 #include "algorithms/boosting/adaboost_predict.h"
 #include "algorithms/boosting/adaboost_training_batch.h"
@@ -165,6 +175,8 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -216,9 +216,237 @@ private:
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
+
+/**
+ * <a name="DAAL-CLASS-PARALLELCOMPRESSIONSTREAM"></a>
+ * \brief %ParallelCompressionStream class splits input raw data into independent chunks
+ *        of a fixed size and compresses the chunks concurrently.
+ *
+ * The compressed data is a chunked stream that consists of a header, a chunk index and
+ * the compressed chunks in the order of the input data:
+ *      - header: two 64-bit unsigned integers, the stream signature and the number of chunks
+ *      - chunk index: for every chunk, two 64-bit unsigned integers, the size of the raw chunk
+ *        and the size of the compressed chunk in bytes
+ *      - compressed chunks, each produced by an independent instance of Compressor<method>
+ *
+ * The chunked stream can only be decompressed by the \ref ParallelDecompressionStream class.
+ *
+ * \tparam method   Compression method, \ref CompressionMethod
+ *
+ * \par References
+ *      - <a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref Compressor class
+ */
+template<CompressionMethod method>
+class DAAL_EXPORT ParallelCompressionStream : public Base
+{
+public:
+    /**
+     * %ParallelCompressionStream constructor
+     * \param compr     Pointer to a specific Compressor. Its parameters are used for compression of every chunk
+     * \param chunkSize Optional parameter, size of raw data chunks compressed independently
+     */
+    ParallelCompressionStream(Compressor<method> *compr, size_t chunkSize = 1024 * 1024 * 4);
+    virtual ~ParallelCompressionStream();
+
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream.
+     * Complete chunks of the input data are compressed in parallel
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void push_back(DataBlock *inBlock);
+
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void operator << (DataBlock *inBlock)
+    {
+        push_back(inBlock);
+    }
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream
+     * \param[in] inBlock  Next DataBlock to be compressed
+     */
+    virtual void operator << (DataBlock inBlock)
+    {
+        push_back(&inBlock);
+    }
+    /**
+     * Provides access to the chunked stream stored in %ParallelCompressionStream.
+     * The first block of the collection contains the header and the chunk index,
+     * each of the following blocks contains one compressed chunk
+     * \return Pointer to an internal \ref DataBlockCollection
+     */
+    virtual services::SharedPtr<DataBlockCollection> getCompressedBlocksCollection();
+    /**
+     * Returns the size of the chunked stream stored in %ParallelCompressionStream
+     * \return Size in bytes
+     */
+    virtual size_t getCompressedDataSize();
+    /**
+     * Copies the chunked stream stored in %ParallelCompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where compressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte *outPtr, size_t outSize);
+    /**
+     * Copies the chunked stream stored in %ParallelCompressionStream to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where compressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(DataBlock &outBlock)
+    {
+        return copyCompressedArray(outBlock.getPtr(), outBlock.getSize());
+    }
+    /**
+     * Returns the number of chunks stored in %ParallelCompressionStream
+     * \return Number of chunks
+     */
+    virtual size_t getNumberOfChunks();
+
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    void *pending;
+    void *chunks;
+    void *rawSizes;
+    void *header;
+
+    Compressor<method> *compressor;
+    size_t _chunkSize;
+
+    size_t readPos;
+    size_t readOffset;
+    bool _isValid;
+
+    void compressPendingChunks();
+    void finalizeStream();
+    void resetStream();
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-PARALLELDECOMPRESSIONSTREAM"></a>
+ * \brief %ParallelDecompressionStream class decompresses a chunked stream produced
+ *        by \ref ParallelCompressionStream. The chunks are decompressed concurrently
+ *        or one by one on request.
+ *
+ * \tparam method   Compression method, \ref CompressionMethod
+ *
+ * \par References
+ *      - <a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref Decompressor class
+ */
+template<CompressionMethod method>
+class DAAL_EXPORT ParallelDecompressionStream : public Base
+{
+public:
+    /**
+     * %ParallelDecompressionStream constructor
+     * \param decompr Pointer to a specific Decompressor. Its parameters are used for decompression of every chunk
+     */
+    ParallelDecompressionStream(Decompressor<method> *decompr);
+    virtual ~ParallelDecompressionStream();
+
+    /**
+     * Writes the next part of the chunked stream to %ParallelDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock of the chunked stream
+     */
+    virtual void push_back(DataBlock *inBlock);
+    /**
+     * Writes the next part of the chunked stream to %ParallelDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock of the chunked stream
+     */
+    virtual void operator << (DataBlock *inBlock)
+    {
+        push_back(inBlock);
+    }
+    /**
+     * Writes the next part of the chunked stream to %ParallelDecompressionStream
+     * \param[in] inBlock  Next DataBlock of the chunked stream
+     */
+    virtual void operator << (DataBlock inBlock)
+    {
+        push_back(&inBlock);
+    }
+    /**
+     * Returns the number of chunks in the chunked stream
+     * \return Number of chunks, 0 if the chunk index is not received yet
+     */
+    virtual size_t getNumberOfChunks();
+    /**
+     * Returns the size of the decompressed chunk
+     * \param[in] chunk Index of the chunk
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedChunkSize(size_t chunk);
+    /**
+     * Decompresses one chunk of the chunked stream to an external array
+     * \param[in]  chunk   Index of the chunk
+     * \param[out] outPtr  Pointer to the array where decompressed data is stored
+     * \param[in]  outSize Number of bytes available in external memory.
+     *                     Must be at least getDecompressedChunkSize(chunk) bytes
+     * \return Size of decompressed data in bytes
+     */
+    virtual size_t decompressChunk(size_t chunk, byte *outPtr, size_t outSize);
+    /**
+     * Returns the size of decompressed data of the whole chunked stream
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+    /**
+     * Decompresses all chunks in parallel and copies decompressed data to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes available in external memory.
+     *                    Must be at least getDecompressedDataSize() bytes
+     * \return Size of decompressed data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte *outPtr, size_t outSize);
+    /**
+     * Decompresses all chunks in parallel and copies decompressed data to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where decompressed data is stored.
+     *                      Size of DataBlock must be at least getDecompressedDataSize() bytes
+     * \return Size of decompressed data in bytes
+     */
+    virtual size_t copyDecompressedArray(DataBlock &outBlock)
+    {
+        return copyDecompressedArray(outBlock.getPtr(), outBlock.getSize());
+    }
+
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    byte *_data;
+    size_t _dataSize;
+    size_t _dataCapacity;
+
+    size_t _nChunks;
+    size_t *_rawOffsets;
+    size_t *_chunkOffsets;
+
+    Decompressor<method> *decompressor;
+
+    bool readIndex();
+    bool decompressChunkImpl(size_t chunk, byte *outPtr);
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
 } // namespace interface1
 using interface1::CompressionStream;
 using interface1::DecompressionStream;
+using interface1::ParallelCompressionStream;
+using interface1::ParallelDecompressionStream;
 
 } //namespace data_management
 } //namespace daal
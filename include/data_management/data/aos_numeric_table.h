@@ -310,8 +310,18 @@ private:
 
         if( !(rwFlag & (int)readOnly) ) return;
 
+        DAAL_PROFILER_TASK(profilerDataConversion, "AOSNumericTable::getBlockOfRows");
+
         char *ptr = (char *)_ptr + _structSize * idx;
 
+        data_feature_utils::IndexNumType indexType;
+        if( getCommonFeatureIndexType( indexType ) )
+        {
+            data_feature_utils::vectorGatherFromStructsUpCast[indexType][data_feature_utils::getInternalNumType<T>()]
+            ( nrows, ncols, ptr, _structSize, _offsets, block.getBlockPtr() );
+            return;
+        }
+
         for( size_t j = 0 ; j < ncols ; j++ )
         {
             NumericTableFeature &f = (*_ddict)[j];
@@ -334,6 +344,14 @@ private:
 
             char *ptr = (char *)_ptr + _structSize * idx;
 
+            data_feature_utils::IndexNumType indexType;
+            if( getCommonFeatureIndexType( indexType ) )
+            {
+                data_feature_utils::vectorScatterToStructsDownCast[indexType][data_feature_utils::getInternalNumType<T>()]
+                ( nrows, ncols, buf, ptr, _structSize, _offsets );
+                return;
+            }
+
             size_t j;
 
             for( j = 0 ; j < ncols ; j++ )
@@ -353,20 +371,31 @@ private:
     {
         if(block.getRWFlag() & (int)writeOnly)
         {
+            DAAL_PROFILER_TASK(profilerDataConversion, "AOSNumericTable::releaseBlockOfRows");
+
             size_t ncols = getNumberOfColumns();
 
             char *ptr = (char *)_ptr + _structSize * block.getRowsOffset();
 
             T* blockPtr = block.getBlockPtr();
 
-            for( size_t j = 0 ; j < ncols ; j++ )
+            data_feature_utils::IndexNumType indexType;
+            if( getCommonFeatureIndexType( indexType ) )
             {
-                NumericTableFeature &f = (*_ddict)[j];
+                data_feature_utils::vectorScatterToStructsDownCast[indexType][data_feature_utils::getInternalNumType<T>()]
+                ( block.getNumberOfRows(), ncols, blockPtr, ptr, _structSize, _offsets );
+            }
+            else
+            {
+                for( size_t j = 0 ; j < ncols ; j++ )
+                {
+                    NumericTableFeature &f = (*_ddict)[j];
 
-                char *location = ptr + _offsets[j];
+                    char *location = ptr + _offsets[j];
 
-                data_feature_utils::vectorStrideDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-                ( block.getNumberOfRows(), blockPtr + j, sizeof(T)*ncols, location, _structSize );
+                    data_feature_utils::vectorStrideDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
+                    ( block.getNumberOfRows(), blockPtr + j, sizeof(T)*ncols, location, _structSize );
+                }
             }
         }
         block.setDetails( 0, 0, 0 );
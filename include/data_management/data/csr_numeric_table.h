@@ -371,6 +371,12 @@ public:
         _memStatus  = userAllocated;
     }
 
+    /**
+     *  Gets a block of rows converted to the dense layout.
+     *  The block takes vector_num * getNumberOfColumns() values regardless of the number of non-zero values,
+     *  so algorithms that support the CSR layout access the data with getSparseBlock()
+     *  and use this method only as the fallback
+     */
     void getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
     {
         return getTBlock<double>(vector_idx, vector_num, rwflag, block);
@@ -589,6 +595,8 @@ protected:
             return;
         }
 
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
         NumericTableFeature &f = (*_ddict)[0];
 
         T *buffer;
@@ -39,9 +39,75 @@ namespace data_management
 
 namespace interface1
 {
-class CategoricalFeatureDictionary : public std::map<std::string, std::pair<int, int> >
+/**
+ *  <a name="DAAL-CLASS-CATEGORICALFEATUREDICTIONARY"></a>
+ *  \brief Dictionary that maps values of a categorical feature to pairs of the index of the category
+ *         and the number of occurrences of the category counted by the methods of std::map.
+ *         In addition to the methods of std::map, the dictionary provides insert() and find() that take values
+ *         as pointers with lengths. They look the values up in a hash table without creating string objects
+ *         and may be called concurrently from several threads
+ *
+ *  \note The methods of std::map must not be called concurrently with other methods of the dictionary.
+ *        Categories added by insert(value, length) have the number of occurrences 1.
+ *        Categories found by insert(value, length) or find(value, length) must not be erased or renumbered
+ *        by the methods of std::map, the indices of such categories are cached in the hash table
+ */
+class DAAL_EXPORT CategoricalFeatureDictionary : public std::map<std::string, std::pair<int, int> >
 {
 public:
+    typedef std::map<std::string, std::pair<int, int> > MapType;
+
+    using MapType::insert;
+    using MapType::find;
+
+    /**
+     *  Constructs an empty dictionary
+     */
+    CategoricalFeatureDictionary();
+
+    /**
+     *  Constructs a copy of the dictionary
+     *  \param[in] other  Dictionary to copy
+     */
+    CategoricalFeatureDictionary(const CategoricalFeatureDictionary &other);
+
+    /**
+     *  Copies the categories of the dictionary
+     *  \param[in] other  Dictionary to copy
+     */
+    CategoricalFeatureDictionary &operator= (const CategoricalFeatureDictionary &other);
+
+    /** \private */
+    ~CategoricalFeatureDictionary();
+
+    /**
+     *  Returns the index of the category, the category is added to the dictionary if it is not there yet.
+     *  Categories are added with the index equal to the number of categories in the dictionary.
+     *  If categories are added from several threads, the order of their indices is not defined
+     *  \param[in] value   Pointer to the characters of the value of the feature
+     *  \param[in] length  Number of characters in the value
+     *  \return Index of the category, -1 if the memory for the category cannot be allocated
+     */
+    int insert(const char *value, size_t length);
+
+    /**
+     *  Returns the index of the category
+     *  \param[in] value   Pointer to the characters of the value of the feature
+     *  \param[in] length  Number of characters in the value
+     *  \return Index of the category, -1 if the category is not in the dictionary
+     */
+    int find(const char *value, size_t length) const;
+
+    /**
+     *  \private
+     *  Creates the dictionary in dict if dict is NULL. If it is called concurrently, one dictionary is created
+     *  \param[in,out] dict  Pointer to the dictionary
+     *  \return Pointer to the dictionary
+     */
+    static CategoricalFeatureDictionary *create(CategoricalFeatureDictionary *&dict);
+
+private:
+    void *_ptr;
 };
 
 /**
@@ -170,14 +236,16 @@ public:
     }
 
     /**
-     *  Gets a categorical features dictionary
-     *  \return Pointer to the categorical features dictionary
+     *  Gets a categorical features dictionary, the dictionary is created on the first call.
+     *  Feature managers create the dictionaries of categorical features when they fill the data dictionary,
+     *  before the rows are parsed
+     *  \return Pointer to the categorical features dictionary, NULL if the dictionary cannot be created
      */
     CategoricalFeatureDictionary *getCategoricalDictionary()
     {
         if( !cat_dict )
         {
-            cat_dict = new CategoricalFeatureDictionary;
+            return CategoricalFeatureDictionary::create( cat_dict );
         }
 
         return cat_dict;
@@ -153,6 +153,114 @@ static void vectorStrideConvertFunc(size_t n, void *src, size_t srcByteStride, v
     }
 }
 
+const size_t transposeTileRows = 64;   /* Number of rows in a tile of the blocked transposition */
+const size_t transposeTileCols = 8;    /* Number of columns in a tile of the blocked transposition */
+
+typedef void(*vectorTransposeFromColumnsFuncType)(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *dst);
+typedef void(*vectorTransposeToColumnsFuncType)(size_t nRows, size_t nCols, void *src, void **columns, size_t rowOffset);
+typedef void(*vectorGatherFromStructsFuncType)(size_t nRows, size_t nCols, void *src, size_t structSize, const size_t *offsets, void *dst);
+typedef void(*vectorScatterToStructsFuncType)(size_t nRows, size_t nCols, void *src, void *dst, size_t structSize, const size_t *offsets);
+
+/* Converts rows [rowOffset, rowOffset + nRows) of the columns of the same type into the row-major block.
+   The block is processed by tiles that fit into L1 cache: the reads of a tile are contiguous
+   and its writes share the cache lines of the tile rows */
+template<typename T1, typename T2>
+static void vectorTransposeFromColumnsFunc(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *dst)
+{
+    T2 *rows = (T2 *)dst;
+    for(size_t i0 = 0; i0 < nRows; i0 += transposeTileRows)
+    {
+        size_t i1 = (i0 + transposeTileRows < nRows ? i0 + transposeTileRows : nRows);
+        for(size_t j0 = 0; j0 < nCols; j0 += transposeTileCols)
+        {
+            size_t j1 = (j0 + transposeTileCols < nCols ? j0 + transposeTileCols : nCols);
+            for(size_t j = j0; j < j1; j++)
+            {
+                const T1 *column = (const T1 *)columns[j] + rowOffset;
+                for(size_t i = i0; i < i1; i++)
+                {
+                    rows[i * nCols + j] = static_cast<T2>(column[i]);
+                }
+            }
+        }
+    }
+}
+
+/* Converts the row-major block into rows [rowOffset, rowOffset + nRows) of the columns of the same type */
+template<typename T1, typename T2>
+static void vectorTransposeToColumnsFunc(size_t nRows, size_t nCols, void *src, void **columns, size_t rowOffset)
+{
+    const T1 *rows = (const T1 *)src;
+    for(size_t i0 = 0; i0 < nRows; i0 += transposeTileRows)
+    {
+        size_t i1 = (i0 + transposeTileRows < nRows ? i0 + transposeTileRows : nRows);
+        for(size_t j0 = 0; j0 < nCols; j0 += transposeTileCols)
+        {
+            size_t j1 = (j0 + transposeTileCols < nCols ? j0 + transposeTileCols : nCols);
+            for(size_t j = j0; j < j1; j++)
+            {
+                T2 *column = (T2 *)columns[j] + rowOffset;
+                for(size_t i = i0; i < i1; i++)
+                {
+                    column[i] = static_cast<T2>(rows[i * nCols + j]);
+                }
+            }
+        }
+    }
+}
+
+/* Returns true if the fields of the structure are the array of nCols values of type T */
+template<typename T>
+static bool isPackedStruct(size_t nCols, size_t structSize, const size_t *offsets)
+{
+    if(structSize != nCols * sizeof(T)) { return false; }
+    for(size_t j = 0; j < nCols; j++)
+    {
+        if(offsets[j] != j * sizeof(T)) { return false; }
+    }
+    return true;
+}
+
+/* Converts the fields of the same type of nRows consecutive structures into the row-major block */
+template<typename T1, typename T2>
+static void vectorGatherFromStructsFunc(size_t nRows, size_t nCols, void *src, size_t structSize, const size_t *offsets, void *dst)
+{
+    if(isPackedStruct<T1>(nCols, structSize, offsets))
+    {
+        vectorConvertFunc<T1, T2>(nRows * nCols, src, dst);
+        return;
+    }
+    const char *structPtr = (const char *)src;
+    T2 *rows = (T2 *)dst;
+    for(size_t i = 0; i < nRows; i++, structPtr += structSize, rows += nCols)
+    {
+        for(size_t j = 0; j < nCols; j++)
+        {
+            rows[j] = static_cast<T2>(*(const T1 *)(structPtr + offsets[j]));
+        }
+    }
+}
+
+/* Converts the row-major block into the fields of the same type of nRows consecutive structures */
+template<typename T1, typename T2>
+static void vectorScatterToStructsFunc(size_t nRows, size_t nCols, void *src, void *dst, size_t structSize, const size_t *offsets)
+{
+    if(isPackedStruct<T2>(nCols, structSize, offsets))
+    {
+        vectorConvertFunc<T1, T2>(nRows * nCols, src, dst);
+        return;
+    }
+    const T1 *rows = (const T1 *)src;
+    char *structPtr = (char *)dst;
+    for(size_t i = 0; i < nRows; i++, structPtr += structSize, rows += nCols)
+    {
+        for(size_t j = 0; j < nCols; j++)
+        {
+            *(T2 *)(structPtr + offsets[j]) = static_cast<T2>(rows[j]);
+        }
+    }
+}
+
 #undef  DAAL_TABLE_UP_ENTRY
 #define DAAL_TABLE_UP_ENTRY(F,T) {F<T, float>, F<T, double>, F<T, int> }
 
@@ -193,6 +301,16 @@ static data_feature_utils::vectorConvertFuncType vectorDownCast[NumOfIndexNumTyp
 static data_feature_utils::vectorStrideConvertFuncType vectorStrideUpCast[NumOfIndexNumTypes][3] = DAAL_CONVERT_UP_TABLE(vectorStrideConvertFunc);
 static data_feature_utils::vectorStrideConvertFuncType vectorStrideDownCast[NumOfIndexNumTypes][3] = DAAL_CONVERT_DOWN_TABLE(vectorStrideConvertFunc);
 
+static data_feature_utils::vectorTransposeFromColumnsFuncType vectorTransposeFromColumnsUpCast[NumOfIndexNumTypes][3] =
+    DAAL_CONVERT_UP_TABLE(vectorTransposeFromColumnsFunc);
+static data_feature_utils::vectorTransposeToColumnsFuncType vectorTransposeToColumnsDownCast[NumOfIndexNumTypes][3] =
+    DAAL_CONVERT_DOWN_TABLE(vectorTransposeToColumnsFunc);
+
+static data_feature_utils::vectorGatherFromStructsFuncType vectorGatherFromStructsUpCast[NumOfIndexNumTypes][3] =
+    DAAL_CONVERT_UP_TABLE(vectorGatherFromStructsFunc);
+static data_feature_utils::vectorScatterToStructsFuncType vectorScatterToStructsDownCast[NumOfIndexNumTypes][3] =
+    DAAL_CONVERT_DOWN_TABLE(vectorScatterToStructsFunc);
+
 } // namespace data_feature_utils
 #define DataFeatureUtils data_feature_utils
 }
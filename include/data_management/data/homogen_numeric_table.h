@@ -316,6 +316,7 @@ public:
             this->_errors->add(services::ErrorMemoryAllocationFailed);
             return;
         }
+        daal::services::daal_first_touch( _ptr, getNumberOfRows(), getNumberOfColumns() * sizeof(DataType) );
 
         _memStatus = internallyAllocated;
     }
@@ -379,6 +380,8 @@ private:
         }
         else
         {
+            DAAL_PROFILER_TASK(profilerDataConversion, "HomogenNumericTable::repack");
+
             size_t i, j;
 
             for(i = 0; i < n; i++)
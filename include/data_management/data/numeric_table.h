@@ -28,6 +28,7 @@
 #include "services/base.h"
 #include "services/daal_defines.h"
 #include "services/daal_memory.h"
+#include "services/daal_profiler.h"
 #include "services/error_handling.h"
 #include "algorithms/algorithm_types.h"
 #include "data_management/data/data_collection.h"
@@ -651,6 +652,24 @@ public:
     BasicStatisticsDataCollection basicStatistics; /** Basic statistics container */
 
 protected:
+    /**
+     *  Returns the type of the features if all features of the numeric table have the same type
+     *  \param[out] indexType  Type of the features
+     *  \return True if all features have the same type supported by the conversion functions, false otherwise
+     */
+    bool getCommonFeatureIndexType(data_feature_utils::IndexNumType &indexType) const
+    {
+        size_t ncols = getNumberOfColumns();
+        if(ncols == 0 || !_ddict) { return false; }
+
+        indexType = (*_ddict)[0].indexType;
+        for(size_t j = 1; j < ncols; j++)
+        {
+            if((*_ddict)[j].indexType != indexType) { return false; }
+        }
+        return ((int)indexType < data_feature_utils::NumOfIndexNumTypes);
+    }
+
     services::SharedPtr<NumericTableDictionary> _ddict;
 
     size_t _obsnum;
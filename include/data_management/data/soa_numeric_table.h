@@ -363,12 +363,22 @@ private:
 
         if( !(block.getRWFlag() & (int)readOnly) ) return;
 
+        DAAL_PROFILER_TASK(profilerDataConversion, "SOANumericTable::getBlockOfRows");
+
+        T* buffer = block.getBlockPtr();
+
+        data_feature_utils::IndexNumType indexType;
+        if( getCommonFeatureIndexType( indexType ) )
+        {
+            data_feature_utils::vectorTransposeFromColumnsUpCast[indexType][data_feature_utils::getInternalNumType<T>()]
+            ( nrows, ncols, _arrays, idx, buffer );
+            return;
+        }
+
         T lbuf[32];
 
         size_t di = 32;
 
-        T* buffer = block.getBlockPtr();
-
         for( size_t i = 0 ; i < nrows ; i += di )
         {
             if( i + di > nrows ) { di = nrows - i; }
@@ -396,6 +406,15 @@ private:
         if (rwFlag & (int)writeOnly)
         {
             size_t ncols = getNumberOfColumns();
+
+            data_feature_utils::IndexNumType indexType;
+            if( getCommonFeatureIndexType( indexType ) )
+            {
+                data_feature_utils::vectorTransposeToColumnsDownCast[indexType][data_feature_utils::getInternalNumType<T>()]
+                ( nrows, ncols, buf, _arrays, idx );
+                return;
+            }
+
             T lbuf[32];
 
             size_t i, ii, j;
@@ -430,6 +449,8 @@ private:
     {
         if(block.getRWFlag() & (int)writeOnly)
         {
+            DAAL_PROFILER_TASK(profilerDataConversion, "SOANumericTable::releaseBlockOfRows");
+
             size_t ncols = getNumberOfColumns();
             size_t nrows = block.getNumberOfRows();
             size_t idx   = block.getRowsOffset();
@@ -439,23 +460,32 @@ private:
 
             T* blockPtr = block.getBlockPtr();
 
-            for( size_t i = 0 ; i < nrows ; i += di )
+            data_feature_utils::IndexNumType indexType;
+            if( getCommonFeatureIndexType( indexType ) )
             {
-                if( i + di > nrows ) { di = nrows - i; }
-
-                for( size_t j = 0 ; j < ncols ; j++ )
+                data_feature_utils::vectorTransposeToColumnsDownCast[indexType][data_feature_utils::getInternalNumType<T>()]
+                ( nrows, ncols, blockPtr, _arrays, idx );
+            }
+            else
+            {
+                for( size_t i = 0 ; i < nrows ; i += di )
                 {
-                    NumericTableFeature &f = (*_ddict)[j];
+                    if( i + di > nrows ) { di = nrows - i; }
 
-                    char *ptr = (char *)_arrays[j] + (idx + i) * f.typeSize;
-
-                    for( size_t ii = 0 ; ii < di; ii++ )
+                    for( size_t j = 0 ; j < ncols ; j++ )
                     {
-                        lbuf[ii] = blockPtr[ (i + ii) * ncols + j ];
-                    }
+                        NumericTableFeature &f = (*_ddict)[j];
 
-                    data_feature_utils::vectorDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-                    ( di, lbuf, ptr );
+                        char *ptr = (char *)_arrays[j] + (idx + i) * f.typeSize;
+
+                        for( size_t ii = 0 ; ii < di; ii++ )
+                        {
+                            lbuf[ii] = blockPtr[ (i + ii) * ncols + j ];
+                        }
+
+                        data_feature_utils::vectorDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
+                        ( di, lbuf, ptr );
+                    }
                 }
             }
         }
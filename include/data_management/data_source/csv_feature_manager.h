@@ -27,6 +27,10 @@
 #include <sstream>
 #include <fstream>
 #include <list>
+#include <cstring>
+#include <cstdlib>
+#include <clocale>
+#include <cmath>
 
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
@@ -49,12 +53,13 @@ class CSVFeatureManager : public StringRowFeatureManagerIface
 {
 protected:
     char _delimiter;
+    services::SharedPtr<services::ErrorCollection> _errors;
 
 public:
     /**
      *  Default constructor
      */
-    CSVFeatureManager() : _delimiter(',') {}
+    CSVFeatureManager() : _delimiter(','), _errors(new services::ErrorCollection()) {}
 
     /**
      *  Sets a new character as a delimiter for parsing CSV data (default ',')
@@ -64,22 +69,33 @@ public:
         _delimiter = delimiter;
     }
 
+    /**
+     *  Returns errors during the parsing of the data
+     *  \return Errors during the parsing of the data
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
 public:
     virtual void parseRowAsDictionary( char *rawRowData, size_t rawDataSize,
                                        DataSourceDictionary *dict ) DAAL_C11_OVERRIDE
     {
-        std::stringstream ssLine(rawRowData);
-        char *word = new char[rawDataSize];
-
         std::list<DataSourceFeature> featureList;
 
+        const char *end = getEndOfRow( rawRowData, rawDataSize );
+        const char *word = rawRowData;
+
         bool isEmpty = false;
         size_t nCols = 0;
-        while( ssLine.getline( word, rawDataSize, _delimiter ) )
+        while( word < end )
         {
+            const char *wordEnd = getEndOfWord( word, end );
+
             double f;
-            isEmpty = (word[0] == 0 || word[0] == '\r' || word[0] == '\n');
-            bool isNumeric = readNumeric<>( word, f );
+            isEmpty = (word == wordEnd || word[0] == '\r' || word[0] == '\n');
+            bool isNumeric = parseNumber( word, wordEnd, f );
 
             DataSourceFeature feat;
 
@@ -96,18 +112,23 @@ public:
             featureList.push_back(feat);
 
             nCols++;
+            word = wordEnd + 1;
         }
 
         if(isEmpty) { nCols--; }
 
-        delete[] word;
-
         dict->setNumberOfFeatures(nCols);
 
         size_t idx = 0;
         for( std::list<DataSourceFeature>::iterator it = featureList.begin() ; it != featureList.end() ; it++ )
         {
             dict->setFeature( *it, idx );
+
+            /* The dictionary of categories is created before the rows are parsed, possibly in parallel */
+            if( it->ntFeature.featureType == data_feature_utils::DAAL_CATEGORICAL )
+            {
+                (*dict)[idx].getCategoricalDictionary();
+            }
             idx++;
             if( idx == nCols ) { break; }
         }
@@ -124,71 +145,270 @@ public:
     virtual void parseRowIn ( char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict,
                               NumericTable *nt, size_t  ntRowIndex  ) DAAL_C11_OVERRIDE
     {
-        std::stringstream ssLine( rawRowData );
-        char *word = new char[rawDataSize];
-
         size_t nCols = nt->getNumberOfColumns();
 
         BlockDescriptor<double> block;
         nt->getBlockOfRows( ntRowIndex, 1, writeOnly, block );
         double *row = block.getBlockPtr();
 
+        bool isParsed = parseRow<double>( rawRowData, rawDataSize, dict, nCols, row );
+
+        nt->releaseBlockOfRows( block );
+        if( !isParsed ) { _errors->add(services::ErrorMemoryAllocationFailed); }
+    }
+
+    /**
+     *  Parses a batch of strings that represent feature vectors and converts them into a numeric representation.
+     *  All strings are written into one block of rows of the Numeric Table.
+     *  The block is of float or int type if all features in the dictionary are of this type, and of double type otherwise
+     *  \param[in]  rawRowsData   Array of pointers to the strings that represent the feature vectors
+     *  \param[in]  rawRowsSizes  Array of sizes of the strings
+     *  \param[in]  nRows         Number of strings in the batch
+     *  \param[in]  dict          Pointer to the dictionary
+     *  \param[out] nt            Pointer to a Numeric Table to store the result of parsing
+     *  \param[in]  ntRowIndex    Position in the Numeric Table at which to store the result of parsing of the first string
+     */
+    virtual void parseRowsIn ( char **rawRowsData, const size_t *rawRowsSizes, size_t nRows, DataSourceDictionary *dict,
+                               NumericTable *nt, size_t ntRowIndex ) DAAL_C11_OVERRIDE
+    {
+        size_t nCols = nt->getNumberOfColumns();
+
+        data_feature_utils::IndexNumType blockType = (nCols > 0 ? (*dict)[0].ntFeature.indexType : data_feature_utils::DAAL_FLOAT64);
+        for( size_t i = 1; i < nCols; i++ )
+        {
+            if( (*dict)[i].ntFeature.indexType != blockType ) { blockType = data_feature_utils::DAAL_FLOAT64; break; }
+        }
+
+        switch( blockType )
+        {
+        case data_feature_utils::DAAL_FLOAT32:
+            parseRowsInBlock<float >( rawRowsData, rawRowsSizes, nRows, dict, nt, ntRowIndex );
+            break;
+        case data_feature_utils::DAAL_INT32_S:
+            parseRowsInBlock<int   >( rawRowsData, rawRowsSizes, nRows, dict, nt, ntRowIndex );
+            break;
+        default:
+            parseRowsInBlock<double>( rawRowsData, rawRowsSizes, nRows, dict, nt, ntRowIndex );
+            break;
+        }
+    }
+
+protected:
+    template<class T>
+    bool readNumeric(char *text, T &f)
+    {
+        double value;
+        bool isNumeric = parseNumber( text, text + strlen(text), value );
+        f = (T)value;
+        return isNumeric;
+    }
+
+    template<typename T>
+    void parseRowsInBlock( char **rawRowsData, const size_t *rawRowsSizes, size_t nRows, DataSourceDictionary *dict,
+                           NumericTable *nt, size_t ntRowIndex )
+    {
+        size_t nCols = nt->getNumberOfColumns();
+
+        BlockDescriptor<T> block;
+        nt->getBlockOfRows( ntRowIndex, nRows, writeOnly, block );
+        T *rows = block.getBlockPtr();
+
+        bool isParsed = true;
+        for( size_t i = 0; i < nRows; i++ )
+        {
+            isParsed &= parseRow<T>( rawRowsData[i], rawRowsSizes[i], dict, nCols, rows + i * nCols );
+        }
+
+        nt->releaseBlockOfRows( block );
+        if( !isParsed ) { _errors->add(services::ErrorMemoryAllocationFailed); }
+    }
+
+    /**
+     *  Splits the string into words in place and converts them into the row of the Numeric Table.
+     *  Features that are missing in the string are set to zero.
+     *  Returns false if a category cannot be added to the dictionary, the feature is set to zero in this case
+     */
+    template<typename T>
+    bool parseRow( const char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, size_t nCols, T *row )
+    {
+        bool isParsed = true;
+        const char *end = getEndOfRow( rawRowData, rawDataSize );
+        const char *word = rawRowData;
+
         size_t i;
-        for( i = 0; i < nCols; i++ )
+        for( i = 0; i < nCols && word < end; i++ )
         {
-            ssLine.getline( word, rawDataSize, _delimiter );
-            if( ssLine.fail() ) { break; }
+            const char *wordEnd = getEndOfWord( word, end );
 
             DataSourceFeature   &dsFeat = (*dict)[i];
             NumericTableFeature &ntFeat = dsFeat.ntFeature;
             if( ntFeat.featureType == data_feature_utils::DAAL_CONTINUOUS )
             {
                 double f;
-                if( readNumeric<>( word, f ) )
-                {
-                    row[ i ] = f;
-                }
-                else
-                {
-                    /* NonNumeric data in NumericTable is invalid */
-                    row[ i ] = 0;
-                }
+                /* NonNumeric data in NumericTable is invalid and is replaced with zero */
+                row[ i ] = (parseNumber( word, wordEnd, f ) ? (T)f : (T)0);
             }
             else
             {
-                std::string sWord(word);
-
                 CategoricalFeatureDictionary *catDict = dsFeat.getCategoricalDictionary();
-                CategoricalFeatureDictionary::iterator it = catDict->find( sWord );
+                int index = (catDict ? catDict->insert( word, (size_t)(wordEnd - word) ) : -1);
+                isParsed &= (index >= 0);
+                row[ i ] = (index >= 0 ? (T)index : (T)0);
+            }
+
+            word = wordEnd + 1;
+        }
 
-                if( it != catDict->end() )
+        for( ; i < nCols; i++ )
+        {
+            row[ i ] = (T)0;
+        }
+        return isParsed;
+    }
+
+    static const char *getEndOfRow( const char *rawRowData, size_t rawDataSize )
+    {
+        const char *end = (const char *)memchr( rawRowData, '\0', rawDataSize );
+        return (end ? end : rawRowData + rawDataSize);
+    }
+
+    const char *getEndOfWord( const char *word, const char *end ) const
+    {
+        const char *wordEnd = (const char *)memchr( word, _delimiter, (size_t)(end - word) );
+        return (wordEnd ? wordEnd : end);
+    }
+
+    /**
+     *  Converts the text into a floating-point number without creating stream objects and without dependence on the locale.
+     *  Leading whitespaces are skipped, characters that follow the number are ignored
+     *  \param[in]  begin  Pointer to the first character of the text
+     *  \param[in]  end    Pointer to the character that follows the last character of the text
+     *  \param[out] value  Resulting number
+     *  \return true if the text starts with a number, false otherwise
+     */
+    static bool parseNumber( const char *begin, const char *end, double &value )
+    {
+        const char *p = begin;
+        while( p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' || *p == '\v' || *p == '\f') ) { p++; }
+
+        bool isNegative = false;
+        if( p < end && (*p == '-' || *p == '+') ) { isNegative = (*p == '-'); p++; }
+
+        /* Up to 19 significant digits are accumulated exactly in the 64-bit mantissa */
+        const int maxMantissaDigits = 19;
+        unsigned long long mantissa = 0;
+        int nMantissaDigits = 0;
+        int exponent = 0;
+        bool hasDigits = false;
+
+        for( ; p < end && *p >= '0' && *p <= '9'; p++ )
+        {
+            hasDigits = true;
+            if( nMantissaDigits < maxMantissaDigits )
+            {
+                mantissa = mantissa * 10 + (unsigned long long)(*p - '0');
+                if( mantissa != 0 ) { nMantissaDigits++; }
+            }
+            else
+            {
+                exponent++;
+            }
+        }
+
+        if( p < end && *p == '.' )
+        {
+            for( p++; p < end && *p >= '0' && *p <= '9'; p++ )
+            {
+                hasDigits = true;
+                if( nMantissaDigits < maxMantissaDigits )
                 {
-                    row[ i ] = it->second.first;
-                    it->second.second++;
+                    mantissa = mantissa * 10 + (unsigned long long)(*p - '0');
+                    if( mantissa != 0 ) { nMantissaDigits++; }
+                    exponent--;
                 }
-                else
+            }
+        }
+
+        if( !hasDigits ) { return false; }
+
+        const char *numberEnd = p;
+        if( p < end && (*p == 'e' || *p == 'E') )
+        {
+            const char *q = p + 1;
+            bool isExponentNegative = false;
+            if( q < end && (*q == '-' || *q == '+') ) { isExponentNegative = (*q == '-'); q++; }
+            if( q < end && *q >= '0' && *q <= '9' )
+            {
+                int e = 0;
+                for( ; q < end && *q >= '0' && *q <= '9'; q++ )
                 {
-                    int index = (int)(catDict->size());
-                    catDict->insert( std::pair<std::string, std::pair<int, int> >( sWord, std::pair<int, int>(index, 1) ) );
-                    row[ i ] = index;
+                    if( e < 100000 ) { e = e * 10 + (*q - '0'); }
                 }
+                exponent += (isExponentNegative ? -e : e);
+                numberEnd = q;
             }
         }
 
-        delete[] word;
+        static const double powersOf10[] =
+        {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
 
-        nt->releaseBlockOfRows( block );
+        if( nMantissaDigits <= 15 && exponent >= -22 && exponent <= 22 )
+        {
+            /* The mantissa and the power of 10 are exact doubles, so the result is correctly rounded */
+            double result = (double)mantissa;
+            result = (exponent < 0 ? result / powersOf10[-exponent] : result * powersOf10[exponent]);
+            value = (isNegative ? -result : result);
+        }
+        else
+        {
+            /* Rare long or large numbers are converted by the C library */
+            value = convertByLibrary( begin, numberEnd, mantissa, exponent, isNegative );
+        }
+        return true;
     }
 
-protected:
-    template<class T>
-    bool readNumeric(char *text, T &f)
+    /**
+     *  Converts the number that occupies the text by strtod. The decimal point of the text is replaced
+     *  with the decimal point of the current locale, so the result does not depend on the locale.
+     *  The numbers that do not fit into the buffer are computed from the first 19 significant digits
+     */
+    static double convertByLibrary( const char *begin, const char *end, unsigned long long mantissa, int exponent,
+                                    bool isNegative )
     {
-        std::istringstream iss(text);
-        iss >> f;
-        return !(iss.fail());
-    }
+        const size_t bufferSize = 128;
+        char buffer[bufferSize];
+
+        const char *localePoint = localeconv()->decimal_point;
+        const size_t localePointLength = (localePoint && localePoint[0] ? strlen( localePoint ) : 0);
+
+        size_t length = 0;
+        for( const char *p = begin; p < end; p++ )
+        {
+            if( *p == '.' && localePointLength > 0 )
+            {
+                if( length + localePointLength >= bufferSize ) { length = bufferSize; break; }
+                memcpy( buffer + length, localePoint, localePointLength );
+                length += localePointLength;
+            }
+            else
+            {
+                if( length + 1 >= bufferSize ) { length = bufferSize; break; }
+                buffer[length++] = *p;
+            }
+        }
 
+        if( length < bufferSize )
+        {
+            buffer[length] = '\0';
+            return strtod( buffer, NULL );
+        }
+
+        double result = (double)mantissa * pow( 10.0, (double)exponent );
+        return (isNegative ? -result : result);
+    }
 };
 } // namespace interface1
 using interface1::CSVFeatureManager;
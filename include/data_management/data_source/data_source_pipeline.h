@@ -0,0 +1,221 @@
+/* file: data_source_pipeline.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration and implementation of the pipeline that streams data blocks
+//  from a data source to an algorithm in the online processing mode.
+//--
+*/
+
+#ifndef __DATA_SOURCE_PIPELINE_H__
+#define __DATA_SOURCE_PIPELINE_H__
+
+#include "services/base.h"
+#include "services/error_handling.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data_source/data_source.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ *  <a name="DAAL-CLASS-PIPELINESTEPIFACE"></a>
+ *  \brief Abstract interface class for the processing step of the data source pipeline.
+ *         The step is called for every data block loaded from the data source
+ */
+class PipelineStepIface
+{
+public:
+    /**
+     *  Processes the next block of data
+     *  \param[in] block Numeric table that contains the next block of data.
+     *                   The table is reused by the pipeline once the step returns
+     */
+    virtual void compute(const services::SharedPtr<NumericTable> &block) = 0;
+
+    /**
+     *  Returns errors of the processing step. The pipeline stops once the step adds an error
+     *  \return Errors of the processing step
+     */
+    virtual services::SharedPtr<services::ErrorCollection> getErrors() = 0;
+
+    virtual ~PipelineStepIface() {}
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONLINEALGORITHMSTEP"></a>
+ *  \brief Processing step that sets the data block as an input of the algorithm
+ *         in the online processing mode and computes partial results
+ *
+ *  \tparam Algorithm     Algorithm in the online processing mode
+ *  \tparam InputIdType   Type of the identifier of the algorithm input
+ */
+template<typename Algorithm, typename InputIdType>
+class OnlineAlgorithmStep : public PipelineStepIface
+{
+public:
+    /**
+     *  Constructs the processing step
+     *  \param[in] algorithm Algorithm in the online processing mode
+     *  \param[in] inputId   Identifier of the algorithm input the data block is set to
+     */
+    OnlineAlgorithmStep(Algorithm &algorithm, InputIdType inputId) : _algorithm(algorithm), _inputId(inputId) {}
+
+    void compute(const services::SharedPtr<NumericTable> &block) DAAL_C11_OVERRIDE
+    {
+        _algorithm.input.set(_inputId, block);
+        _algorithm.compute();
+    }
+
+    services::SharedPtr<services::ErrorCollection> getErrors() DAAL_C11_OVERRIDE
+    {
+        return _algorithm.getErrors();
+    }
+
+protected:
+    Algorithm &_algorithm;
+    InputIdType _inputId;
+};
+
+/**
+ *  Streams blocks of data from a data source to the processing step.
+ *  The next block is loaded into one of the buffers while the current block stored in the other buffer is processed.
+ *  The loading and the processing are two tasks of the threading layer of the library, so they overlap only
+ *  if at least two threads are available; otherwise the tasks run one after another.
+ *  The pipeline stops at the first error of the data source or of the processing step
+ *  \param[in]  dataSource  Data source
+ *  \param[in]  blockSize   Maximum number of rows in a data block
+ *  \param[in]  buffer0     Numeric table used as the first buffer
+ *  \param[in]  buffer1     Numeric table used as the second buffer
+ *  \param[in]  step        Processing step
+ *  \param[out] errors      Errors that stopped the pipeline
+ *  \return Number of rows processed
+ */
+DAAL_EXPORT size_t runDataSourcePipeline(DataSource &dataSource, size_t blockSize,
+                                         const services::SharedPtr<NumericTable> &buffer0,
+                                         const services::SharedPtr<NumericTable> &buffer1,
+                                         PipelineStepIface &step, services::KernelErrorCollection &errors);
+
+/**
+ *  <a name="DAAL-CLASS-DATASOURCEPIPELINE"></a>
+ *  \brief Drives an algorithm in the online processing mode from a data source.
+ *         Loading and parsing of the next data block overlaps with the processing of the current one
+ *         when at least two threads are available to the library.
+ *         Two homogeneous numeric tables are allocated once and reused for all data blocks
+ *
+ *  \tparam FPType  Type of the data stored in the buffers
+ */
+template<typename FPType = double>
+class DataSourcePipeline : public Base
+{
+public:
+    /**
+     *  Constructs the pipeline
+     *  \param[in] dataSource  Data source. The data dictionary must be available or created from the context
+     *  \param[in] blockSize   Maximum number of rows in a data block
+     */
+    DataSourcePipeline(DataSource &dataSource, size_t blockSize) :
+        _dataSource(dataSource), _blockSize(blockSize), _errors(new services::ErrorCollection())
+    {
+        if(blockSize == 0)
+        {
+            _errors->add(services::ErrorIncorrectParameter);
+            return;
+        }
+
+        size_t nFeatures = dataSource.getNumberOfColumns();
+        if(nFeatures == 0)
+        {
+            _errors->add(services::ErrorDictionaryNotAvailable);
+            return;
+        }
+
+        for(size_t i = 0; i < 2; i++)
+        {
+            _buffers[i] = services::SharedPtr<NumericTable>(
+                              new HomogenNumericTable<FPType>(nFeatures, blockSize, NumericTableIface::doAllocate));
+        }
+    }
+
+    virtual ~DataSourcePipeline() {}
+
+    /**
+     *  Streams all data available in the data source to the processing step.
+     *  Stops at the first error of the data source or of the processing step
+     *  \param[in] step Processing step
+     *  \return Number of rows processed
+     */
+    size_t run(PipelineStepIface &step)
+    {
+        if(_errors->size() != 0) { return 0; }
+
+        services::SharedPtr<services::KernelErrorCollection> errors(new services::KernelErrorCollection());
+        size_t nProcessed = runDataSourcePipeline(_dataSource, _blockSize, _buffers[0], _buffers[1], step, *errors);
+        if(errors->size() != 0)
+        {
+            services::SharedPtr<services::ErrorCollection> pipelineErrors(new services::ErrorCollection());
+            pipelineErrors->getErrors()->add(errors);
+            _errors->add(pipelineErrors);
+        }
+        return nProcessed;
+    }
+
+    /**
+     *  Streams all data available in the data source to the algorithm in the online processing mode
+     *  \param[in] algorithm Algorithm in the online processing mode
+     *  \param[in] inputId   Identifier of the algorithm input the data blocks are set to
+     *  \return Number of rows processed
+     */
+    template<typename Algorithm, typename InputIdType>
+    size_t run(Algorithm &algorithm, InputIdType inputId)
+    {
+        OnlineAlgorithmStep<Algorithm, InputIdType> step(algorithm, inputId);
+        return run(step);
+    }
+
+    /**
+     * Returns errors during the construction and the run of the pipeline
+     * \return Errors during the construction and the run of the pipeline
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+protected:
+    DataSource &_dataSource;
+    size_t _blockSize;
+    services::SharedPtr<NumericTable> _buffers[2];
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+} // namespace interface1
+using interface1::PipelineStepIface;
+using interface1::OnlineAlgorithmStep;
+using interface1::DataSourcePipeline;
+using interface1::runDataSourcePipeline;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
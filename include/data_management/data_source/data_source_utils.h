@@ -60,9 +60,55 @@ public:
      */
     virtual void parseRowIn ( char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, NumericTable *nt,
                               size_t  ntRowIndex  ) = 0;
+
+    /**
+     *  Parses a batch of strings that represent feature vectors and converts them into a numeric representation
+     *  \param[in]  rawRowsData   Array of pointers to the strings that represent the feature vectors
+     *  \param[in]  rawRowsSizes  Array of sizes of the strings
+     *  \param[in]  nRows         Number of strings in the batch
+     *  \param[in]  dict          Pointer to the dictionary
+     *  \param[out] nt            Pointer to a Numeric Table to store the result of parsing
+     *  \param[in]  ntRowIndex    Position in the Numeric Table at which to store the result of parsing of the first string
+     */
+    virtual void parseRowsIn ( char **rawRowsData, const size_t *rawRowsSizes, size_t nRows, DataSourceDictionary *dict,
+                               NumericTable *nt, size_t ntRowIndex )
+    {
+        for( size_t i = 0; i < nRows; i++ )
+        {
+            parseRowIn( rawRowsData[i], rawRowsSizes[i], dict, nt, ntRowIndex + i );
+        }
+    }
+};
+
+/**
+ *  <a name="DAAL-CLASS-CONCURRENTTASKIFACE"></a>
+ *  \brief Abstract interface class for the task of the data source that can run concurrently with another task
+ */
+class ConcurrentTaskIface
+{
+public:
+    /**
+     *  Runs the task
+     */
+    virtual void run() = 0;
+
+    virtual ~ConcurrentTaskIface() {}
 };
+
+/**
+ *  Runs two tasks concurrently and returns when both tasks are completed.
+ *  Used by data sources to overlap fetching of the next block of data with the conversion of the current one.
+ *  The tasks are run by the threading layer of the library, so they overlap only if at least two threads are available,
+ *  otherwise they run one after another
+ *  \param[in] task0  First task
+ *  \param[in] task1  Second task
+ */
+DAAL_EXPORT void runConcurrently(ConcurrentTaskIface &task0, ConcurrentTaskIface &task1);
+
 } // namespace interface1
 using interface1::StringRowFeatureManagerIface;
+using interface1::ConcurrentTaskIface;
+using interface1::runConcurrently;
 
 }
 }
@@ -25,6 +25,7 @@
 #define __FILE_DATA_SOURCE_H__
 
 #include <sstream>
+#include <vector>
 #include <fstream>
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
@@ -148,14 +149,20 @@ public:
 
         nt->setNormalizationFlag(NumericTable::nonNormalized);
 
-        for( j = 0; j < maxRows && !_fileStream.eof() ; j++ )
+        for( j = 0; j < maxRows; )
         {
-            readLine();
-            if (_rawLineLength == 0) { break; }
-            if(this->_errors->size() != 0) { break; }
-            featureManager.parseRowIn( _rawLineBuffer, _rawLineLength, _dict, nt, j );
+            size_t nRowsToRead = maxRows - j;
+            if( nRowsToRead > rowsBatchSize ) { nRowsToRead = rowsBatchSize; }
+            size_t nRowsRead = readLines( nRowsToRead );
+            if( nRowsRead == 0 ) { break; }
 
-            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt );
+            featureManager.parseRowsIn( &_batchRows[0], &_batchRowSizes[0], nRowsRead, _dict, nt, j );
+
+            for( size_t k = 0; k < nRowsRead; k++, j++ )
+            {
+                DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt );
+            }
+            if( nRowsRead < nRowsToRead ) { break; }
         }
 
         nt->setNumberOfRows( j );
@@ -326,6 +333,38 @@ protected:
         _rawLineLength = (size_t)_istream->gcount();
     }
 
+    /**
+     *  Reads up to maxRows lines and stores them one after another in the batch buffer,
+     *  so that the batch is parsed into one block of the Numeric Table
+     */
+    size_t readLines( size_t maxRows )
+    {
+        _batchData.clear();
+        _batchRowSizes.clear();
+
+        size_t nRows;
+        for( nRows = 0; nRows < maxRows && !_fileStream.eof(); nRows++ )
+        {
+            readLine();
+            if (_rawLineLength == 0) { break; }
+            if(this->_errors->size() != 0) { break; }
+
+            _batchData.insert( _batchData.end(), _rawLineBuffer, _rawLineBuffer + _rawLineLength );
+            _batchData.push_back( '\0' );
+            _batchRowSizes.push_back( _rawLineLength );
+        }
+
+        _batchRows.resize( nRows );
+        size_t offset = 0;
+        for( size_t i = 0; i < nRows; i++ )
+        {
+            _batchRows[i] = &_batchData[offset];
+            offset += _batchRowSizes[i] + 1;
+        }
+
+        return nRows;
+    }
+
 private:
     std::string  _fileName;
     std::fstream _fileStream;
@@ -336,6 +375,11 @@ private:
 
     size_t _rawLineLength;
 
+    static const size_t rowsBatchSize = 256;
+    std::vector<char>   _batchData;
+    std::vector<size_t> _batchRowSizes;
+    std::vector<char *> _batchRows;
+
     bool _contextDictFlag;
 };
 } // namespace interface1
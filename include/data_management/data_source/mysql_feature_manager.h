@@ -24,11 +24,14 @@
 #define __MYSQL_FEATURE_MANAGER_H__
 
 #include <sstream>
+#include <cstring>
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
+#include "data_management/data_source/data_source_utils.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -54,10 +57,31 @@ namespace interface1
 class MySQLFeatureManager
 {
 public:
-    MySQLFeatureManager() : _errors(new services::ErrorCollection()) {}
+    MySQLFeatureManager() : _errors(new services::ErrorCollection()), _fetchBlockSize(1024) {}
 
     /**
-     *  Executes an SQL statement from an ODBC statement handle and writes it to a Numeric Table
+     *  Sets the number of rows fetched from the ODBC driver at once
+     *  \param[in]  fetchBlockSize  Number of rows in the block of fetched rows
+     */
+    void setFetchBlockSize(size_t fetchBlockSize)
+    {
+        _fetchBlockSize = (fetchBlockSize > 0 ? fetchBlockSize : 1);
+    }
+
+    /**
+     *  Returns the number of rows fetched from the ODBC driver at once
+     *  \return Number of rows in the block of fetched rows
+     */
+    size_t getFetchBlockSize() const
+    {
+        return _fetchBlockSize;
+    }
+
+    /**
+     *  Executes an SQL statement from an ODBC statement handle and writes it to a Numeric Table.
+     *  Rows are fetched in blocks into column-wise bound arrays. Columns of a SOANumericTable are bound directly,
+     *  so the driver writes values into the arrays of the table. The next block is fetched while the current block
+     *  is written into the Numeric Table
      *
      *  \param[in]   hdlStmt ODBC statement handle that contains an SQL query
      *  \param[out]  nt      Numeric Table to store query results
@@ -161,6 +185,137 @@ public:
 
 private:
     services::SharedPtr<services::ErrorCollection> _errors;
+    size_t _fetchBlockSize;
+
+    /* Arrays bound to the result set columns for one block of fetched rows */
+    struct FetchBlock
+    {
+        SQLLEN   *indicators;   /* Length or NULL indicators, nFeatures x fetchBlockSize */
+        double   *values;       /* Values of the columns that are not bound to the Numeric Table, nFeatures x fetchBlockSize */
+        SQLULEN   nFetched;
+        SQLRETURN ret;
+    };
+
+    /* Binding of the result set column */
+    struct ColumnBinding
+    {
+        byte       *columnPtr;     /* Array of the SOANumericTable the column is bound to, NULL if the column is fetched into FetchBlock::values */
+        SQLSMALLINT targetType;
+        size_t      elementSize;
+    };
+
+    /* State shared by the fetch and store tasks of one call of statementResultsNumericTable */
+    struct FetchContext
+    {
+        SQLHSTMT       hdlStmt;
+        NumericTable  *nt;
+        size_t         nFeatures;
+        size_t         maxRows;
+        size_t         fetchBlockSize;
+        ColumnBinding *columns;
+        double        *ntBuffer;    /* Rows of the Numeric Table if the columns are not bound directly, NULL otherwise */
+    };
+
+    /* Binds the columns to the arrays of the block and fetches up to fetchBlockSize rows */
+    class FetchTask : public ConcurrentTaskIface
+    {
+    public:
+        FetchTask(FetchContext &ctx, FetchBlock &block, size_t rowOffset) : _ctx(ctx), _block(block), _rowOffset(rowOffset) {}
+
+        void run() DAAL_C11_OVERRIDE
+        {
+            _block.nFetched = 0;
+            size_t nRows = _ctx.maxRows - _rowOffset;
+            if (nRows > _ctx.fetchBlockSize) { nRows = _ctx.fetchBlockSize; }
+
+            _block.ret = SQLSetStmtAttr(_ctx.hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)nRows, 0);
+            if (!SQL_SUCCEEDED(_block.ret)) { return; }
+            _block.ret = SQLSetStmtAttr(_ctx.hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, (SQLPOINTER)&_block.nFetched, 0);
+            if (!SQL_SUCCEEDED(_block.ret)) { return; }
+
+            for (size_t j = 0; j < _ctx.nFeatures; j++)
+            {
+                ColumnBinding &column = _ctx.columns[j];
+                SQLLEN *indicators = _block.indicators + j * _ctx.fetchBlockSize;
+                if (column.columnPtr)
+                {
+                    _block.ret = SQLBindCol(_ctx.hdlStmt, (SQLUSMALLINT)(j + 1), column.targetType,
+                                            (SQLPOINTER)(column.columnPtr + _rowOffset * column.elementSize),
+                                            (SQLLEN)column.elementSize, indicators);
+                }
+                else
+                {
+                    _block.ret = SQLBindCol(_ctx.hdlStmt, (SQLUSMALLINT)(j + 1), SQL_C_DOUBLE,
+                                            (SQLPOINTER)(_block.values + j * _ctx.fetchBlockSize), sizeof(double), indicators);
+                }
+                if (!SQL_SUCCEEDED(_block.ret)) { return; }
+            }
+
+            _block.ret = SQLFetchScroll(_ctx.hdlStmt, SQL_FETCH_NEXT, 0);
+            if (!SQL_SUCCEEDED(_block.ret)) { _block.nFetched = 0; }
+        }
+
+    private:
+        FetchContext &_ctx;
+        FetchBlock &_block;
+        size_t _rowOffset;
+    };
+
+    /* Writes the fetched block into the Numeric Table, NULL values are replaced with zeros */
+    class StoreTask : public ConcurrentTaskIface
+    {
+    public:
+        StoreTask(FetchContext &ctx, FetchBlock &block, size_t rowOffset, size_t nRows) :
+            _ctx(ctx), _block(block), _rowOffset(rowOffset), _nRows(nRows) {}
+
+        void run() DAAL_C11_OVERRIDE
+        {
+            const size_t nFeatures = _ctx.nFeatures;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const SQLLEN *indicators = _block.indicators + j * _ctx.fetchBlockSize;
+                const double *values     = _block.values     + j * _ctx.fetchBlockSize;
+                ColumnBinding &column = _ctx.columns[j];
+
+                if (column.columnPtr)
+                {
+                    byte *columnPtr = column.columnPtr + _rowOffset * column.elementSize;
+                    for (size_t i = 0; i < _nRows; i++)
+                    {
+                        if (indicators[i] == SQL_NULL_DATA)
+                        {
+                            memset(columnPtr + i * column.elementSize, 0, column.elementSize);
+                        }
+                    }
+                }
+                else if (_ctx.ntBuffer)
+                {
+                    double *ntBuffer = _ctx.ntBuffer + _rowOffset * nFeatures + j;
+                    for (size_t i = 0; i < _nRows; i++)
+                    {
+                        ntBuffer[i * nFeatures] = (indicators[i] == SQL_NULL_DATA ? 0.0 : values[i]);
+                    }
+                }
+                else
+                {
+                    BlockDescriptor<double> block;
+                    _ctx.nt->getBlockOfColumnValues(j, _rowOffset, _nRows, writeOnly, block);
+                    double *ntColumn = block.getBlockPtr();
+                    for (size_t i = 0; i < _nRows; i++)
+                    {
+                        ntColumn[i] = (indicators[i] == SQL_NULL_DATA ? 0.0 : values[i]);
+                    }
+                    _ctx.nt->releaseBlockOfColumnValues(block);
+                }
+            }
+        }
+
+    private:
+        FetchContext &_ctx;
+        FetchBlock &_block;
+        size_t _rowOffset;
+        size_t _nRows;
+    };
 
     size_t      getStrictureSize(NumericTableDictionary *dict);
     size_t      typeSize(data_feature_utils::IndexNumType indexNumType);
@@ -202,52 +357,115 @@ DataSourceIface::DataSourceStatus MySQLFeatureManager::statementResultsNumericTa
     SQLRETURN ret;
     size_t nFeatures = nt->getNumberOfColumns();
     nt->setNumberOfRows(maxRows);
-    services::SharedPtr<NumericTableDictionary> dict = nt->getDictionarySharedPtr();
-    data_feature_utils::IndexNumType indexNumType = data_feature_utils::getIndexNumType<double>();
+    if (maxRows == 0 || nFeatures == 0) { return DataSourceIface::readyForLoad; }
+
+    /* Drivers that do not support arrays of rows keep the size of the array equal to one */
+    SQLULEN fetchBlockSize = (_fetchBlockSize < maxRows ? _fetchBlockSize : maxRows);
+    ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)fetchBlockSize, 0);
+    if (ret == SQL_SUCCESS_WITH_INFO)
+    {
+        ret = SQLGetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)&fetchBlockSize, 0, NULL);
+    }
+    if (!SQL_SUCCEEDED(ret) || fetchBlockSize == 0) { fetchBlockSize = 1; }
+
+    ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+    if (!SQL_SUCCEEDED(ret)) { _errors->add(services::ErrorODBC); return DataSource::notReady; }
+
+    FetchContext ctx;
+    ctx.hdlStmt        = hdlStmt;
+    ctx.nt             = nt;
+    ctx.nFeatures      = nFeatures;
+    ctx.maxRows        = maxRows;
+    ctx.fetchBlockSize = fetchBlockSize;
+    ctx.ntBuffer       = NULL;
+    ctx.columns        = (ColumnBinding *)daal::services::daal_malloc(sizeof(ColumnBinding) * nFeatures);
+
+    FetchBlock blocks[2];
+    for (size_t k = 0; k < 2; k++)
+    {
+        blocks[k].indicators = (SQLLEN *)daal::services::daal_malloc(sizeof(SQLLEN) * nFeatures * fetchBlockSize);
+        blocks[k].values     = (double *)daal::services::daal_malloc(sizeof(double) * nFeatures * fetchBlockSize);
+        blocks[k].nFetched   = 0;
+        blocks[k].ret        = SQL_SUCCESS;
+    }
 
-    SQLLEN *bindInd     = (SQLLEN *)daal::services::daal_malloc(sizeof(SQLLEN) * nFeatures);
-    double *fetchBuffer = (double *)daal::services::daal_malloc(sizeof(double) * nFeatures);
-    for (int j = 0; j < nFeatures; j++)
+    if (!ctx.columns || !blocks[0].indicators || !blocks[0].values || !blocks[1].indicators || !blocks[1].values)
     {
-        if (indexNumType != data_feature_utils::DAAL_OTHER_T)
+        _errors->add(services::ErrorMemoryAllocationFailed);
+        for (size_t k = 0; k < 2; k++)
         {
-            ret = SQLBindCol(hdlStmt, j + 1, getTargetType(indexNumType), (SQLPOINTER)&fetchBuffer[j], 0, &bindInd[j]);
-            if (!SQL_SUCCEEDED(ret)) { _errors->add(services::ErrorODBC); return DataSource::notReady; }
+            daal::services::daal_free(blocks[k].indicators);
+            daal::services::daal_free(blocks[k].values);
         }
-        else
+        daal::services::daal_free(ctx.columns);
+        return DataSource::notReady;
+    }
+
+    /* Columns of the structure of arrays are bound to the arrays of the table, other tables receive rows of doubles */
+    bool isSOA = (nt->getDataLayout() == NumericTableIface::soa);
+    NumericTableDictionary *ntDict = nt->getDictionary();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        ColumnBinding &column = ctx.columns[j];
+        column.columnPtr   = NULL;
+        column.targetType  = SQL_C_DOUBLE;
+        column.elementSize = sizeof(double);
+        if (isSOA)
         {
-            bindInd[j] = 0;
+            data_feature_utils::IndexNumType indexNumType = (*ntDict)[j].indexType;
+            byte *columnPtr = (byte *)(static_cast<SOANumericTable *>(nt)->getArray(j));
+            if (columnPtr && indexNumType != data_feature_utils::DAAL_OTHER_T)
+            {
+                column.columnPtr   = columnPtr;
+                column.targetType  = getTargetType(indexNumType);
+                column.elementSize = typeSize(indexNumType);
+            }
         }
     }
-    size_t read = 0;
 
     BlockDescriptor<double> block;
-    nt->getBlockOfRows(0, maxRows, writeOnly, block);
-    double *ntBuffer = block.getBlockPtr();
+    if (!isSOA)
+    {
+        nt->getBlockOfRows(0, maxRows, writeOnly, block);
+        ctx.ntBuffer = block.getBlockPtr();
+    }
 
-    while (SQL_SUCCEEDED(ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 1)))
+    size_t read = 0;
+    size_t current = 0;
+    FetchTask firstFetch(ctx, blocks[current], 0);
+    firstFetch.run();
+
+    while (blocks[current].nFetched > 0 && read < maxRows)
     {
-        for (int j = 0; j < nFeatures; j++)
+        size_t nRows = (size_t)blocks[current].nFetched;
+        if (nRows > maxRows - read) { nRows = maxRows - read; }
+
+        const size_t next = 1 - current;
+        StoreTask store(ctx, blocks[current], read, nRows);
+        if (read + nRows < maxRows)
         {
-            if (bindInd[j] == SQL_NULL_DATA)
-            {
-                ntBuffer[read * nFeatures + j] = 0.0;
-                continue;
-            }
-            indexNumType = (*dict)[j].indexType;
-            if (indexNumType != data_feature_utils::DAAL_OTHER_T)
-            {
-                ntBuffer[read * nFeatures + j] = *((double *) & (fetchBuffer[j]));
-            }
-            else
-            {
-                ntBuffer[read * nFeatures + j] = 0.0;
-            }
+            FetchTask fetch(ctx, blocks[next], read + nRows);
+            runConcurrently(store, fetch);
         }
-        read++;
+        else
+        {
+            store.run();
+            blocks[next].nFetched = 0;
+            blocks[next].ret      = SQL_SUCCESS;
+        }
+
+        read += nRows;
+        current = next;
+    }
+    ret = blocks[current].ret;
+
+    if (!isSOA)
+    {
+        nt->releaseBlockOfRows(block);
     }
     nt->setNumberOfRows(read);
-    nt->releaseBlockOfRows(block);
+
+    SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, NULL, 0);
 
     DataSourceIface::DataSourceStatus status = DataSourceIface::readyForLoad;
     if (ret != SQL_NO_DATA)
@@ -265,8 +483,13 @@ DataSourceIface::DataSourceStatus MySQLFeatureManager::statementResultsNumericTa
             status = DataSourceIface::endOfData;
         }
     }
-    daal::services::daal_free(fetchBuffer);
-    daal::services::daal_free(bindInd);
+
+    for (size_t k = 0; k < 2; k++)
+    {
+        daal::services::daal_free(blocks[k].indicators);
+        daal::services::daal_free(blocks[k].values);
+    }
+    daal::services::daal_free(ctx.columns);
     return status;
 }
 
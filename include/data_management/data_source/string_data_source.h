@@ -25,6 +25,7 @@
 #define __STRING_DATA_SOURCE_H__
 
 #include <sstream>
+#include <vector>
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data/data_dictionary.h"
@@ -165,14 +166,20 @@ public:
 
         nt->setNormalizationFlag(NumericTable::nonNormalized);
 
-        for( j = 0; j < maxRows && !_istream.eof() ; j++ )
+        for( j = 0; j < maxRows; )
         {
-            readLine();
-            if (_rawLineLength == 0) { break; }
-            if(this->_errors->size() != 0) { break; }
-            featureManager.parseRowIn( _rawLineBuffer, _rawLineLength, _dict, nt, j );
+            size_t nRowsToRead = maxRows - j;
+            if( nRowsToRead > rowsBatchSize ) { nRowsToRead = rowsBatchSize; }
+            size_t nRowsRead = readLines( nRowsToRead );
+            if( nRowsRead == 0 ) { break; }
+
+            featureManager.parseRowsIn( &_batchRows[0], &_batchRowSizes[0], nRowsRead, _dict, nt, j );
 
-            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt );
+            for( size_t k = 0; k < nRowsRead; k++, j++ )
+            {
+                DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt );
+            }
+            if( nRowsRead < nRowsToRead ) { break; }
         }
 
         nt->setNumberOfRows( j );
@@ -212,14 +219,20 @@ public:
 
         size_t j;
 
-        for( j = 0; j < maxRows && !_istream.eof() ; j++ )
+        for( j = 0; j < maxRows; )
         {
-            readLine();
-            if (_rawLineLength == 0) { break; }
-            if(this->_errors->size() != 0) { break; }
-            featureManager.parseRowIn( _rawLineBuffer, _rawLineLength, _dict, nt, rowOffset + j );
+            size_t nRowsToRead = maxRows - j;
+            if( nRowsToRead > rowsBatchSize ) { nRowsToRead = rowsBatchSize; }
+            size_t nRowsRead = readLines( nRowsToRead );
+            if( nRowsRead == 0 ) { break; }
+
+            featureManager.parseRowsIn( &_batchRows[0], &_batchRowSizes[0], nRowsRead, _dict, nt, rowOffset + j );
 
-            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( rowOffset + j, nt );
+            for( size_t k = 0; k < nRowsRead; k++, j++ )
+            {
+                DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( rowOffset + j, nt );
+            }
+            if( nRowsRead < nRowsToRead ) { break; }
         }
 
         NumericTableDictionary *ntDict = nt->getDictionary();
@@ -379,6 +392,38 @@ protected:
         _rawLineLength = (size_t)_istream.gcount();
     }
 
+    /**
+     *  Reads up to maxRows lines and stores them one after another in the batch buffer,
+     *  so that the batch is parsed into one block of the Numeric Table
+     */
+    size_t readLines( size_t maxRows )
+    {
+        _batchData.clear();
+        _batchRowSizes.clear();
+
+        size_t nRows;
+        for( nRows = 0; nRows < maxRows && !_istream.eof(); nRows++ )
+        {
+            readLine();
+            if (_rawLineLength == 0) { break; }
+            if(this->_errors->size() != 0) { break; }
+
+            _batchData.insert( _batchData.end(), _rawLineBuffer, _rawLineBuffer + _rawLineLength );
+            _batchData.push_back( '\0' );
+            _batchRowSizes.push_back( _rawLineLength );
+        }
+
+        _batchRows.resize( nRows );
+        size_t offset = 0;
+        for( size_t i = 0; i < nRows; i++ )
+        {
+            _batchRows[i] = &_batchData[offset];
+            offset += _batchRowSizes[i] + 1;
+        }
+
+        return nRows;
+    }
+
 private:
     std::istringstream _istream;
 
@@ -387,6 +432,11 @@ private:
 
     size_t _rawLineLength;
 
+    static const size_t rowsBatchSize = 256;
+    std::vector<char>   _batchData;
+    std::vector<size_t> _batchRowSizes;
+    std::vector<char *> _batchRows;
+
     bool _contextDictFlag;
 };
 } // namespace interface1
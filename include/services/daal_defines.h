@@ -183,6 +183,7 @@ const int SERIALIZATION_CHOLESKY_RESULT_ID                                     =
 
 const int SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID                         = 101900;
 const int SERIALIZATION_COSINE_DISTANCE_RESULT_ID                              = 101910;
+const int SERIALIZATION_NEAREST_NEIGHBORS_RESULT_ID                            = 101920;
 
 const int SERIALIZATION_EM_GMM_INIT_RESULT_ID                                  = 102000;
 const int SERIALIZATION_EM_GMM_RESULT_ID                                       = 102010;
@@ -200,6 +201,7 @@ const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID                       =
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID                 = 102430;
 
 const int SERIALIZATION_QUANTILES_RESULT_ID                                    = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID                            = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID                                 = 102600;
 
@@ -208,6 +210,9 @@ const int SERIALIZATION_SVD_ONLINE_PARTIAL_RESULT_ID                           =
 const int SERIALIZATION_SVD_DISTRIBUTED_PARTIAL_RESULT_ID                      = 102720;
 const int SERIALIZATION_SVD_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID                = 102730;
 
+const int SERIALIZATION_GBT_MODEL_ID                                           = 102800;
+const int SERIALIZATION_GBT_TRAINING_RESULT_ID                                 = 102810;
+
 const int SERIALIZATION_RELU_RESULT_ID                                         = 103000;
 
 const int SERIALIZATION_SORTING_RESULT_ID                                      = 103100;
@@ -49,6 +49,19 @@ DAAL_EXPORT void *daal_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAUL
  */
 DAAL_EXPORT void  daal_free(void *ptr);
 
+/**
+ * Writes zeros to a large block of memory of rows by the threads of the bound ThreadArena the calling
+ * thread works in, if the first touch is enabled for the arena. The rows are split into contiguous ranges,
+ * one range per thread of the arena, that are written in parallel, so the operating system places the pages
+ * of the block on the NUMA nodes of the processors of the arena. Which thread writes which range is not defined,
+ * so the pages of a range are not guaranteed to be on the NUMA node of the thread that later computes on it.
+ * Otherwise, and for the blocks smaller than several pages, the block is not changed
+ * \param[in] ptr      Pointer to the beginning of a block of memory
+ * \param[in] nRows    Number of rows in the block
+ * \param[in] rowSize  Size of a row in bytes
+ */
+DAAL_EXPORT void  daal_first_touch(void *ptr, size_t nRows, size_t rowSize);
+
 /**
  * Copies bytes between buffers
  * \param[out] dest               Pointer to new buffer
@@ -0,0 +1,292 @@
+/* file: daal_profiler.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the classes used for the profiling of the library.
+//--
+*/
+
+#ifndef __DAAL_PROFILER_H__
+#define __DAAL_PROFILER_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace services
+{
+
+/**
+ * <a name="DAAL-ENUM-SERVICES__PROFILEREVENTTYPE"></a>
+ * \brief Types of the operations measured by the profiler
+ */
+enum ProfilerEventType
+{
+    profilerAlgorithmCompute         = 0,   /*!< Method compute() of the algorithm container */
+    profilerAlgorithmFinalizeCompute = 1,   /*!< Method finalizeCompute() of the algorithm container */
+    profilerKernel                   = 2,   /*!< Call of the method of the CPU-specific kernel */
+    profilerDataConversion           = 3,   /*!< Conversion of a block of a numeric table to or from the requested data type */
+    profilerBlas                     = 4,   /*!< Call of a BLAS function */
+    profilerLapack                   = 5,   /*!< Call of a LAPACK function */
+    profilerMemory                   = 6,   /*!< Memory allocation */
+    lastProfilerEventType            = profilerMemory
+};
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-SERVICES__PROFILEREVENT"></a>
+ * \brief Measurement of one operation
+ */
+struct ProfilerEvent
+{
+    ProfilerEventType type;     /*!< Type of the operation */
+    const char *name;           /*!< Name of the operation */
+    int cpu;                    /*!< CPU type of the implementation, \ref CpuType, or -1 if not applicable */
+    size_t threadId;            /*!< Number of the thread that executed the operation */
+    size_t size;                /*!< Number of bytes for the memory allocations, 0 otherwise */
+    unsigned long long start;   /*!< Start time of the operation in nanoseconds since the profiler was enabled */
+    unsigned long long time;    /*!< Duration of the operation in nanoseconds */
+};
+
+/**
+ * <a name="DAAL-STRUCT-SERVICES__PROFILERSTATISTICS"></a>
+ * \brief Measurements aggregated over the operations of the same type and name executed on the same CPU type
+ */
+struct ProfilerStatistics
+{
+    ProfilerEventType type;     /*!< Type of the operations */
+    const char *name;           /*!< Name of the operations */
+    int cpu;                    /*!< CPU type of the implementation, \ref CpuType, or -1 if not applicable */
+    size_t count;               /*!< Number of the operations */
+    size_t size;                /*!< Total number of bytes for the memory allocations */
+    unsigned long long totalTime;   /*!< Total duration of the operations in nanoseconds */
+    unsigned long long minTime;     /*!< Minimal duration of the operation in nanoseconds */
+    unsigned long long maxTime;     /*!< Maximal duration of the operation in nanoseconds */
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__PROFILERCALLBACK"></a>
+ * \brief Abstract class that receives the measurements of the profiler.
+ *        Calls of onEvent() are serialized by the profiler. The operations of the library
+ *        executed from onEvent() are not measured
+ */
+class DAAL_EXPORT ProfilerCallback
+{
+public:
+    virtual ~ProfilerCallback() {}
+
+    /**
+     *  Processes the measurement of an operation
+     *  \param[in] event    Measurement of the operation
+     */
+    virtual void onEvent(const ProfilerEvent &event) = 0;
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__CHROMETRACEWRITER"></a>
+ * \brief Profiler callback that stores the measurements and writes them in the Trace Event Format
+ *        of the Chrome* trace viewer (chrome://tracing)
+ */
+class DAAL_EXPORT ChromeTraceWriter : public ProfilerCallback
+{
+public:
+    /**
+     *  Constructs the callback
+     *  \param[in] capacity     Maximal number of the stored measurements. Next measurements are dropped
+     */
+    ChromeTraceWriter(size_t capacity = 1048576);
+
+    virtual ~ChromeTraceWriter();
+
+    virtual void onEvent(const ProfilerEvent &event);
+
+    /**
+     *  Returns the number of the stored measurements
+     *  \return Number of the stored measurements
+     */
+    size_t getNumberOfEvents() const { return _size; }
+
+    /**
+     *  Writes the stored measurements to a file
+     *  \param[in] fileName     Name of the file
+     *  \return true if the file is written successfully
+     */
+    bool write(const char *fileName) const;
+
+private:
+    ChromeTraceWriter(const ChromeTraceWriter &);
+    ChromeTraceWriter &operator=(const ChromeTraceWriter &);
+
+    ProfilerEvent *_events;
+    size_t _capacity;
+    size_t _size;
+    size_t _bufferSize;
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__PROFILER"></a>
+ * \brief Collects the durations of the operations of the library aggregated by the algorithm, method and CPU type.
+ *        The operations are measured only if the library is built with the DAAL_PROFILER macro defined
+ *        and the profiler is enabled with Profiler::enable()
+ */
+class DAAL_EXPORT Profiler
+{
+public:
+    /**
+     *  Starts the measurements and resets the start time of the profiler
+     */
+    static void enable();
+
+    /**
+     *  Stops the measurements
+     */
+    static void disable();
+
+    /**
+     *  Returns true if the measurements are enabled
+     *  \return true if the measurements are enabled
+     */
+    static bool isEnabled();
+
+    /**
+     *  Removes the collected statistics
+     */
+    static void reset();
+
+    /**
+     *  Registers the callback that receives every measurement
+     *  \param[in] callback     Pointer to the callback, NULL to unregister the current callback
+     */
+    static void setCallback(ProfilerCallback *callback);
+
+    /**
+     *  Returns the number of the collected statistics records
+     *  \return Number of the collected statistics records
+     */
+    static size_t getNumberOfStatistics();
+
+    /**
+     *  Returns the collected statistics record
+     *  \param[in]  index       Index of the statistics record
+     *  \param[out] statistics  Statistics record
+     *  \return false if the index is out of range
+     */
+    static bool getStatistics(size_t index, ProfilerStatistics &statistics);
+
+    /**
+     *  Writes the collected statistics to a file in the JSON format
+     *  \param[in] fileName     Name of the file
+     *  \return true if the file is written successfully
+     */
+    static bool writeJSON(const char *fileName);
+
+    /**
+     *  Returns the current time of the profiler
+     *  \return Time in nanoseconds since the profiler was enabled
+     */
+    static unsigned long long getTime();
+
+    /**
+     *  Returns the readable name of the method of a class that can be used as the name of the operation
+     *  \param[in] typeName    Name of the class returned by std::type_info::name()
+     *  \param[in] methodName  Name of the method
+     *  \return Name of the operation. The string is deallocated at the exit of the application
+     */
+    static const char *getMethodName(const char *typeName, const char *methodName);
+
+    /**
+     *  Adds the measurement of an operation
+     *  \param[in] type     Type of the operation
+     *  \param[in] name     Name of the operation. The string must not be deallocated while the profiler is used
+     *  \param[in] cpu      CPU type of the implementation, or -1 if not applicable
+     *  \param[in] start    Start time of the operation returned by getTime()
+     *  \param[in] size     Number of bytes for the memory allocations, 0 otherwise
+     */
+    static void addEvent(ProfilerEventType type, const char *name, int cpu, unsigned long long start, size_t size = 0);
+
+    /** \private True if the library is built with the DAAL_PROFILER macro defined and the measurements are enabled */
+    static volatile bool _isActive;
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__PROFILERTASK"></a>
+ * \brief Measures the duration of the operation from the construction of the object to its destruction.
+ *        The object reads the state of the profiler from the library, so the measurement does not depend
+ *        on the macros defined in the application. If the profiler is disabled, the object costs one load
+ *        and one branch
+ */
+class DAAL_EXPORT ProfilerTask
+{
+public:
+    /**
+     *  Starts the measurement of the operation if the profiler is enabled
+     *  \param[in] type     Type of the operation
+     *  \param[in] name     Name of the operation. The string must not be deallocated while the profiler is used
+     *  \param[in] cpu      CPU type of the implementation, or -1 if not applicable
+     *  \param[in] size     Number of bytes for the memory allocations, 0 otherwise
+     */
+    ProfilerTask(ProfilerEventType type, const char *name, int cpu = -1, size_t size = 0) :
+        _type(type), _name(name), _cpu(cpu), _size(size), _isEnabled(Profiler::_isActive), _start(0)
+    {
+        if (_isEnabled) { _start = Profiler::getTime(); }
+    }
+
+    /**
+     *  Adds the measurement of the operation to the profiler
+     */
+    ~ProfilerTask()
+    {
+        if (_isEnabled) { Profiler::addEvent(_type, _name, _cpu, _start, _size); }
+    }
+
+private:
+    ProfilerTask(const ProfilerTask &);
+    ProfilerTask &operator=(const ProfilerTask &);
+
+    ProfilerEventType _type;
+    const char *_name;
+    int _cpu;
+    size_t _size;
+    bool _isEnabled;
+    unsigned long long _start;
+};
+
+} // namespace interface1
+
+using interface1::ProfilerEvent;
+using interface1::ProfilerStatistics;
+using interface1::ProfilerCallback;
+using interface1::ChromeTraceWriter;
+using interface1::Profiler;
+using interface1::ProfilerTask;
+
+}
+}
+
+/**
+ * Measures the operation until the end of the current scope.
+ * The macros expand to the same code in all translation units, the operation is measured
+ * only if the library is built with the DAAL_PROFILER macro defined
+ */
+#define DAAL_PROFILER_TASK(type, name) \
+    daal::services::ProfilerTask __daalProfilerTask(daal::services::type, name)
+#define DAAL_PROFILER_CPU_TASK(type, name, cpu) \
+    daal::services::ProfilerTask __daalProfilerTask(daal::services::type, name, (int)(cpu))
+
+#endif
@@ -0,0 +1,140 @@
+/* file: daal_thread_arena.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that limits and places the threads used by the algorithms.
+//--
+*/
+
+#ifndef __DAAL_THREAD_ARENA_H__
+#define __DAAL_THREAD_ARENA_H__
+
+#include "services/base.h"
+#include "services/collection.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__THREADARENATASK"></a>
+ * \brief Abstract class for the work executed by the threads of the ThreadArena
+ */
+class ThreadArenaTask
+{
+public:
+    virtual ~ThreadArenaTask() {}
+
+    /**
+     *  Runs the work. Parallel computations started from this method use the threads of the arena only
+     */
+    virtual void run() = 0;
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__THREADARENA"></a>
+ * \brief Set of threads that executes the computations of the algorithms.
+ *        The arena limits the number of threads used by the computations and, if the list of the processors
+ *        is specified, binds every thread of the arena to the whole list: a thread may run on any of
+ *        these processors. Memory first written by the threads of the bound arena is placed by the operating
+ *        system on the NUMA nodes of its processors, so an arena bound to the processors of one NUMA node,
+ *        see getNumaNodeCpus(), keeps the memory of the numeric tables it first writes on that node,
+ *        see setFirstTouch().
+ *        The arena is set for the algorithm using the method setThreadArena() of the algorithm.
+ *
+ * \ref opt_notice
+ */
+class DAAL_EXPORT ThreadArena : public Base
+{
+public:
+    /**
+     *  Constructs the arena
+     *  \param[in] maxThreads   Maximal number of the threads in the arena including the calling thread.
+     *                          0 means the number of the processors of the arena
+     */
+    ThreadArena(size_t maxThreads = 0);
+
+    /**
+     *  Constructs the arena that binds its threads to the processors
+     *  \param[in] maxThreads   Maximal number of the threads in the arena including the calling thread.
+     *                          0 means the number of the processors in the list
+     *  \param[in] cpus         Operating system indices of the processors
+     */
+    ThreadArena(size_t maxThreads, const Collection<size_t> &cpus);
+
+    virtual ~ThreadArena();
+
+    /**
+     *  Returns the maximal number of the threads in the arena
+     *  \return The maximal number of the threads in the arena
+     */
+    size_t getMaxThreads() const;
+
+    /**
+     *  Enables the first touch of the memory of the numeric tables allocated inside the arena: the threads
+     *  of the arena write zeros to equal contiguous ranges of the rows of the table in parallel, so that
+     *  the pages are placed on the NUMA nodes of the processors of the arena rather than on the node
+     *  of the allocating thread. The ranges are not assigned to the threads that later compute on them.
+     *  Has effect only for the arena that binds its threads to the processors. Disabled by default
+     *  \param[in] firstTouch  Flag that enables the first touch
+     */
+    void setFirstTouch(bool firstTouch);
+
+    /**
+     *  Returns the flag that enables the first touch of the memory of the numeric tables allocated inside the arena
+     *  \return The flag that enables the first touch
+     */
+    bool getFirstTouch() const;
+
+    /**
+     *  Executes the task by the threads of the arena and waits for its completion
+     *  \param[in] task  Task to execute
+     */
+    void execute(ThreadArenaTask &task);
+
+    /**
+     *  Returns the number of the NUMA nodes of the system
+     *  \return The number of the NUMA nodes, 1 if the information is not available
+     */
+    static size_t getNumberOfNumaNodes();
+
+    /**
+     *  Returns the operating system indices of the processors of the NUMA node
+     *  \param[in] node  Index of the NUMA node
+     *  \return The indices of the processors, empty if the information is not available
+     */
+    static Collection<size_t> getNumaNodeCpus(size_t node);
+
+private:
+    ThreadArena(const ThreadArena &);
+    ThreadArena &operator=(const ThreadArena &);
+
+    void *_arena;
+};
+
+} // namespace interface1
+
+using interface1::ThreadArenaTask;
+using interface1::ThreadArena;
+
+}
+}
+#endif
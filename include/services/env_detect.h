@@ -129,6 +129,20 @@ public:
     */
     size_t getNumberOfThreads() const;
 
+    /**
+    *  Enables or disables the reproducible mode of the parallel reductions. In this mode the results of the algorithms
+    *  that merge the partial results of the threads do not depend on the number of threads.
+    *  The mode applies to the computations started after the call
+    *  \param[in] enable   True to enable the reproducible mode
+    */
+    void setReproducibleReductions(bool enable);
+
+    /**
+    *  Returns the mode of the parallel reductions
+    *  \return True if the reproducible mode is enabled
+    */
+    bool getReproducibleReductions() const;
+
 private:
     Environment();
     Environment(const Environment &e);
@@ -254,6 +254,12 @@ enum ErrorID
     ErrorRleDataFormatNotFullBlock = -9022,                             /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
 
+    ErrorChunkedStreamDataFormat = -9023,                               /*!< Input chunked compressed stream is in wrong format or corrupted */
+    ErrorChunkedStreamNotFull = -9024,                                  /*!< Input chunked compressed stream does not contain
+                                                                         *   all compressed chunks listed in the chunk index */
+    ErrorChunkedStreamInvalid = -9025,                                  /*!< Chunked compression stream does not accept data
+                                                                         *   after compression of a chunk failed */
+
     // Quantile error: -10000..-11000
     ErrorQuantileOrderValueIsInvalid = -10001,                          /*!< Quantile order value is invalid */
     ErrorQuantilesInternal = -10002,                                    /*!< Quantile internal error */
@@ -62,7 +62,7 @@ public class Batch extends AnalysisBatch {
 
         this.method = method;
 
-        if (method != Method.defaultDense && method != Method.sumDense) {
+        if (method != Method.defaultDense && method != Method.sumDense && method != Method.fusedDense) {
             throw new IllegalArgumentException("method unsupported");
         }
         if (cls != Double.class && cls != Float.class) {
@@ -46,9 +46,13 @@ public final class Method {
 
     private static final int   DefaultDense = 0;
     private static final int   SumDense = 1;
+    private static final int   FusedDense = 2;
     public static final Method defaultDense       = new Method(DefaultDense); /*!< Default: performance-oriented method.
                                                                               Works with all types  of input numeric tables */
     public static final Method sumDense           = new Method(SumDense);    /*!< Precomputed sum: implementation of computation
                                                                               algorithm in the case of a precomputed sum.
                                                                               Works with all types of input numeric tables */
+    public static final Method fusedDense         = new Method(FusedDense);  /*!< Fused: means and standard deviations are computed
+                                                                              in one parallel pass over the data without the low order
+                                                                              moments algorithm. Works with all types of input numeric tables */
 }
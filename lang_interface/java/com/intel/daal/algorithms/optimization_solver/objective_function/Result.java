@@ -79,7 +79,9 @@ public final class Result extends com.intel.daal.algorithms.Result {
         }
         if(index != ResultCollectionId.gradientIdx &&
            index != ResultCollectionId.valueIdx &&
-           index != ResultCollectionId.hessianIdx) {
+           index != ResultCollectionId.hessianIdx &&
+           index != ResultCollectionId.hessianVectorProductIdx &&
+           index != ResultCollectionId.hessianVectorIdx) {
             throw new IllegalArgumentException("index argument for this id unsupported");
         }
         return (NumericTable)Factory.instance().createObject(getContext(), cGetResultTable(cObject, id.getValue(), index.getValue()));
@@ -43,6 +43,8 @@ public final class ResultCollectionId {
     private static final int gradientIdxId = 0;
     private static final int valueIdxId    = 1;
     private static final int hessianIdxId  = 2;
+    private static final int hessianVectorProductIdxId = 3;
+    private static final int hessianVectorIdxId = 4;
 
     public static final ResultCollectionId gradientIdx  = new ResultCollectionId(gradientIdxId); /*!< Objective function gradient
                                                                                                       index in result collection*/
@@ -50,4 +52,10 @@ public final class ResultCollectionId {
                                                                                                       index in result collection*/
     public static final ResultCollectionId hessianIdx  = new ResultCollectionId(hessianIdxId);   /*!< Objective function hessian
                                                                                                       index in result collection*/
+    public static final ResultCollectionId hessianVectorProductIdx = new ResultCollectionId(hessianVectorProductIdxId);
+                                                                  /*!< Objective function hessian-vector product
+                                                                       index in result collection*/
+    public static final ResultCollectionId hessianVectorIdx = new ResultCollectionId(hessianVectorIdxId);
+                                                                  /*!< Index of the vector the objective function hessian
+                                                                       is multiplied by in result collection*/
 }
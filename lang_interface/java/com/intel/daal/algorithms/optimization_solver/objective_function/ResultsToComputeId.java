@@ -26,4 +26,5 @@ public final class ResultsToComputeId {
     public static final long gradient = 0x0000000000000001L; /*!< Objective function gradient compute flag */
     public static final long value    = 0x0000000000000002L; /*!< Objective function value compute flag */
     public static final long hessian  = 0x0000000000000004L; /*!< Objective function hessian compute flag */
+    public static final long hessianVectorProduct = 0x0000000000000008L; /*!< Objective function hessian-vector product compute flag */
 }
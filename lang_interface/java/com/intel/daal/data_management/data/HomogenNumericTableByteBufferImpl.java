@@ -148,6 +148,13 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public DoubleBuffer getBlockOfRows(long vectorIndex, long vectorNum, DoubleBuffer buf) {
         checkCObject();
 
+        // Returns the view of the rows of C++ NumericTable object if the types match
+        ByteBuffer viewBuf = getDoubleBlockView(getCObject(), vectorIndex, vectorNum);
+        if (viewBuf != null) {
+            viewBuf.order(ByteOrder.nativeOrder());
+            return viewBuf.asDoubleBuffer();
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -166,6 +173,13 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public FloatBuffer getBlockOfRows(long vectorIndex, long vectorNum, FloatBuffer buf) {
         checkCObject();
 
+        // Returns the view of the rows of C++ NumericTable object if the types match
+        ByteBuffer viewBuf = getFloatBlockView(getCObject(), vectorIndex, vectorNum);
+        if (viewBuf != null) {
+            viewBuf.order(ByteOrder.nativeOrder());
+            return viewBuf.asFloatBuffer();
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -184,6 +198,13 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public IntBuffer getBlockOfRows(long vectorIndex, long vectorNum, IntBuffer buf) {
         checkCObject();
 
+        // Returns the view of the rows of C++ NumericTable object if the types match
+        ByteBuffer viewBuf = getIntBlockView(getCObject(), vectorIndex, vectorNum);
+        if (viewBuf != null) {
+            viewBuf.order(ByteOrder.nativeOrder());
+            return viewBuf.asIntBuffer();
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -256,6 +277,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public void releaseBlockOfRows(long vectorIndex, long vectorNum, DoubleBuffer buf) {
         checkCObject();
 
+        // Direct buffers are written to C++ NumericTable object without intermediate copies
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder()) {
+            releaseDoubleBlockView(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -278,6 +305,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public void releaseBlockOfRows(long vectorIndex, long vectorNum, FloatBuffer buf) {
         checkCObject();
 
+        // Direct buffers are written to C++ NumericTable object without intermediate copies
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder()) {
+            releaseFloatBlockView(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -300,6 +333,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public void releaseBlockOfRows(long vectorIndex, long vectorNum, IntBuffer buf) {
         checkCObject();
 
+        // Direct buffers are written to C++ NumericTable object without intermediate copies
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder()) {
+            releaseIntBlockView(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -629,6 +668,15 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     private native void releaseFloatBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
     private native void releaseIntBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
 
+    /* Gets NIO buffers that refer to the rows of the C++ table */
+    private native ByteBuffer getDoubleBlockView(long cObject, long vectorIndex, long vectorNum);
+    private native ByteBuffer getFloatBlockView(long cObject, long vectorIndex, long vectorNum);
+    private native ByteBuffer getIntBlockView(long cObject, long vectorIndex, long vectorNum);
+
+    private native void releaseDoubleBlockView(long cObject, long vectorIndex, long vectorNum, DoubleBuffer buffer);
+    private native void releaseFloatBlockView(long cObject, long vectorIndex, long vectorNum, FloatBuffer buffer);
+    private native void releaseIntBlockView(long cObject, long vectorIndex, long vectorNum, IntBuffer buffer);
+
     private native void assignLong(long cObject, long constValue);
     private native void assignInt(long cObject, int constValue);
     private native void assignDouble(long cObject, double constValue);
@@ -34,7 +34,7 @@ using namespace daal::algorithms::normalization::zscore;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense>::newObj(prec, method);
+    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense, fusedDense>::newObj(prec, method);
 }
 
 /*
@@ -45,7 +45,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batc
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense>::getParameter(prec, method, algAddr);
+    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense, fusedDense>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -56,7 +56,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batc
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batch_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense>::getInput(prec, method, algAddr);
+    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense, fusedDense>::getInput(prec, method, algAddr);
 }
 
 /*
@@ -67,7 +67,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batc
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batch_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense>::getResult(prec, method, algAddr);
+    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense, fusedDense>::getResult(prec, method, algAddr);
 }
 
 /*
@@ -78,7 +78,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batc
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batch_cSetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong resultAddr)
 {
-    jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense>::
+    jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense, fusedDense>::
         setResult<normalization::zscore::Result>(prec, method, algAddr, resultAddr);
 }
 
@@ -90,5 +90,5 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batch
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Batch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense>::getClone(prec, method, algAddr);
+    return jniBatch<normalization::zscore::Method, Batch, defaultDense, sumDense, fusedDense>::getClone(prec, method, algAddr);
 }
@@ -20,6 +20,7 @@
 #include "daal.h"
 
 #include "JFactory.h"
+#include "java_numeric_table.h"
 
 using namespace daal;
 using namespace daal::data_management;
@@ -37,3 +38,17 @@ JNIEXPORT jint JNICALL Java_com_intel_daal_data_1management_data_Factory_cGetSer
     int tag = (*object)->getSerializationTag();
     return (jint)tag;
 }
+
+/*
+ * Class:     com_intel_daal_data_management_data_Factory
+ * Method:    cGetHomogenNumericTable
+ * Signature: (J)Lcom/intel/daal/data_management/data/SerializableBase;
+ */
+JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_Factory_cGetHomogenNumericTable
+  (JNIEnv *env, jobject thisObj, jlong numTableAddr)
+{
+    SharedPtr<NumericTable> *table = (SharedPtr<NumericTable> *)numTableAddr;
+    JavaNumericTable *javaTable = dynamic_cast<JavaNumericTable *>(table->get());
+    if (javaTable == NULL) { return NULL; }
+    return javaTable->getJavaObject();
+}
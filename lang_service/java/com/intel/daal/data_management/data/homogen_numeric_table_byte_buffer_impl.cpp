@@ -24,6 +24,51 @@
 using namespace daal;
 using namespace daal::data_management;
 
+/* Returns a direct buffer that refers to the rows of the C++ table if the type of the table matches T, NULL otherwise */
+template<typename T>
+static jobject getBlockView(JNIEnv *env, jlong numTableAddr, jlong vectorIndex, jlong vectorNum)
+{
+    HomogenNumericTable<T> *nt = dynamic_cast<HomogenNumericTable<T> *>(((services::SharedPtr<SerializationIface> *)numTableAddr)->get());
+    if(!nt) { return NULL; }
+
+    size_t nRows = nt->getNumberOfRows();
+    size_t nCols = nt->getNumberOfColumns();
+    T *data = nt->getArray();
+    if(!data || (size_t)vectorIndex >= nRows) { return NULL; }
+
+    size_t nBlockRows = ((size_t)vectorNum < nRows - (size_t)vectorIndex ? (size_t)vectorNum : nRows - (size_t)vectorIndex);
+    return env->NewDirectByteBuffer(data + vectorIndex * nCols, (jlong)(nBlockRows * nCols * sizeof(T)));
+}
+
+/* Writes the block back to the C++ table, nothing is copied if the buffer refers to the rows of the table */
+template<typename T>
+static void releaseBlockView(JNIEnv *env, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject buffer)
+{
+    NumericTable *nt = static_cast<NumericTable *>(((services::SharedPtr<SerializationIface> *)numTableAddr)->get());
+    size_t nCols = nt->getNumberOfColumns();
+
+    T *src = (T *)(env->GetDirectBufferAddress(buffer));
+    if(!src) { return; }
+
+    HomogenNumericTable<T> *homogenNt = dynamic_cast<HomogenNumericTable<T> *>(nt);
+    if(homogenNt && homogenNt->getArray() && src == homogenNt->getArray() + vectorIndex * nCols) { return; }
+
+    BlockDescriptor<T> block;
+    nt->getBlockOfRows(vectorIndex, vectorNum, writeOnly, block);
+
+    size_t nValues = block.getNumberOfRows() * nCols;
+    size_t capacity = (size_t)(env->GetDirectBufferCapacity(buffer));
+    if(capacity < nValues) { nValues = capacity; }
+    daal::services::daal_memcpy_s(block.getBlockPtr(), nValues * sizeof(T), src, nValues * sizeof(T));
+
+    if(nt->getErrors()->size() > 0)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), nt->getErrors()->getDescription());
+    }
+
+    nt->releaseBlockOfRows(block);
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getIndexType
@@ -219,10 +264,8 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     float *src = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        data[i] = src[i];
-    }
+    size_t nValues = block.getNumberOfRows() * nCols;
+    daal::services::daal_memcpy_s(data, nValues * sizeof(data[0]), src, nValues * sizeof(data[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -249,10 +292,8 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     double *src = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        data[i] = src[i];
-    }
+    size_t nValues = block.getNumberOfRows() * nCols;
+    daal::services::daal_memcpy_s(data, nValues * sizeof(data[0]), src, nValues * sizeof(data[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -279,10 +320,8 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     int *src = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        data[i] = src[i];
-    }
+    size_t nValues = block.getNumberOfRows() * nCols;
+    daal::services::daal_memcpy_s(data, nValues * sizeof(data[0]), src, nValues * sizeof(data[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -309,10 +348,8 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     double *dst = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        dst[i] = data[i];
-    }
+    size_t nValues = block.getNumberOfRows() * nCols;
+    daal::services::daal_memcpy_s(dst, nValues * sizeof(dst[0]), data, nValues * sizeof(dst[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -340,10 +377,8 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     float *dst = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        dst[i] = data[i];
-    }
+    size_t nValues = block.getNumberOfRows() * nCols;
+    daal::services::daal_memcpy_s(dst, nValues * sizeof(dst[0]), data, nValues * sizeof(dst[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -371,10 +406,8 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     int *dst = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        dst[i] = data[i];
-    }
+    size_t nValues = block.getNumberOfRows() * nCols;
+    daal::services::daal_memcpy_s(dst, nValues * sizeof(dst[0]), data, nValues * sizeof(dst[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -386,6 +419,72 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
     return byteBuffer;
 }
 
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    getDoubleBlockView
+ * Signature:(JJJ)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_getDoubleBlockView
+(JNIEnv *env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum)
+{
+    return getBlockView<double>(env, numTableAddr, vectorIndex, vectorNum);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    getFloatBlockView
+ * Signature:(JJJ)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_getFloatBlockView
+(JNIEnv *env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum)
+{
+    return getBlockView<float>(env, numTableAddr, vectorIndex, vectorNum);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    getIntBlockView
+ * Signature:(JJJ)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_getIntBlockView
+(JNIEnv *env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum)
+{
+    return getBlockView<int>(env, numTableAddr, vectorIndex, vectorNum);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    releaseDoubleBlockView
+ * Signature:(JJJLjava/nio/DoubleBuffer;)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseDoubleBlockView
+(JNIEnv *env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject buffer)
+{
+    releaseBlockView<double>(env, numTableAddr, vectorIndex, vectorNum, buffer);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    releaseFloatBlockView
+ * Signature:(JJJLjava/nio/FloatBuffer;)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseFloatBlockView
+(JNIEnv *env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject buffer)
+{
+    releaseBlockView<float>(env, numTableAddr, vectorIndex, vectorNum, buffer);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    releaseIntBlockView
+ * Signature:(JJJLjava/nio/IntBuffer;)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseIntBlockView
+(JNIEnv *env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject buffer)
+{
+    releaseBlockView<int>(env, numTableAddr, vectorIndex, vectorNum, buffer);
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getDoubleColumnBuffer
@@ -403,10 +502,8 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     double *dst = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        dst[i] = data[i];
-    }
+    size_t nValues = block.getNumberOfRows();
+    daal::services::daal_memcpy_s(dst, nValues * sizeof(dst[0]), data, nValues * sizeof(dst[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -434,10 +531,8 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     float *dst = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        dst[i] = data[i];
-    }
+    size_t nValues = block.getNumberOfRows();
+    daal::services::daal_memcpy_s(dst, nValues * sizeof(dst[0]), data, nValues * sizeof(dst[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -465,10 +560,8 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     int *dst = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        dst[i] = data[i];
-    }
+    size_t nValues = block.getNumberOfRows();
+    daal::services::daal_memcpy_s(dst, nValues * sizeof(dst[0]), data, nValues * sizeof(dst[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -496,10 +589,8 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     float *src = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        data[i] = src[i];
-    }
+    size_t nValues = block.getNumberOfRows();
+    daal::services::daal_memcpy_s(data, nValues * sizeof(data[0]), src, nValues * sizeof(data[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -526,10 +617,8 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     double *src = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        data[i] = src[i];
-    }
+    size_t nValues = block.getNumberOfRows();
+    daal::services::daal_memcpy_s(data, nValues * sizeof(data[0]), src, nValues * sizeof(data[0]));
 
     if(nt->getErrors()->size() > 0)
     {
@@ -556,10 +645,8 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     int *src = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        data[i] = src[i];
-    }
+    size_t nValues = block.getNumberOfRows();
+    daal::services::daal_memcpy_s(data, nValues * sizeof(data[0]), src, nValues * sizeof(data[0]));
 
     if(nt->getErrors()->size() > 0)
     {
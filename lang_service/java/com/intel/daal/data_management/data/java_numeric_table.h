@@ -25,6 +25,7 @@
 #define __JAVA_NUMERIC_TABLE_H__
 
 #include <jni.h>
+#include <cstring>
 #include <tbb/tbb.h>
 
 
@@ -43,7 +44,10 @@ namespace daal
 class JavaNumericTable : public NumericTable
 {
 public:
-    explicit JavaNumericTable(bool featuresEqual = false): NumericTable(0, 0, featuresEqual), jvm(NULL), jJavaNumTable(NULL) {
+    explicit JavaNumericTable(bool featuresEqual = false): NumericTable(0, 0, featuresEqual), jvm(NULL), jJavaNumTable(NULL),
+        jJavaClass(NULL)
+    {
+        nCachedMethods = 0;
     }
 
     /**
@@ -56,8 +60,9 @@ public:
      */
     JavaNumericTable(size_t featnum, size_t obsnum, JavaVM *_jvm, jobject _JavaNumTable,
                      StorageLayout layout = layout_unknown, bool featuresEqual = false):
-        NumericTable(featnum, obsnum, featuresEqual), jvm(_jvm)
+        NumericTable(featnum, obsnum, featuresEqual), jvm(_jvm), jJavaClass(NULL)
     {
+        nCachedMethods = 0;
         _layout = layout;
         _memStatus = userAllocated;
 
@@ -81,12 +86,23 @@ public:
         {
             this->_errors->add(services::ErrorCouldntCreateGlobalReferenceToJavaObject);
         }
+        else
+        {
+            createJavaClassRef(local_tls.jenv);
+        }
 
         tls.local() = local_tls;
     }
 
+    /**
+     *  Returns the serialization tag of HomogenNumericTable for the dense tables, see serializeImpl
+     */
     virtual int getSerializationTag()
     {
+        if (isSerializedAsHomogen())
+        {
+            return getHomogenIndexType() + SERIALIZATION_HOMOGEN_NT_ID;
+        }
         return SERIALIZATION_JAVANIO_NT_ID;
     }
 
@@ -112,11 +128,18 @@ public:
             {
                 (local_tls.jenv)->DeleteGlobalRef(jJavaNumTable);
             }
+            if (jJavaClass != NULL)
+            {
+                (local_tls.jenv)->DeleteGlobalRef(jJavaClass);
+            }
         }
     }
 
     void serializeImpl (InputDataArchive  *arch)
-    {serialImpl<InputDataArchive, false>(arch);}
+    {
+        if (isSerializedAsHomogen()) { serialHomogenData(arch); return; }
+        serialImpl<InputDataArchive, false>(arch);
+    }
 
     void deserializeImpl(OutputDataArchive *arch)
     {serialImpl<OutputDataArchive, true>(arch);}
@@ -126,6 +149,96 @@ public:
     {
         NumericTable::serialImpl<Archive, onDeserialize>(arch);
 
+        serialJavaObject<Archive, onDeserialize>(arch);
+    }
+
+    /**
+     *  Returns true if the table is written to the archive in the format of HomogenNumericTable.
+     *  The rows of the dense tables are written as is and are deserialized into HomogenNumericTable,
+     *  sparse tables are serialized as Java objects
+     */
+    bool isSerializedAsHomogen() const
+    {
+        return (_layout != csrArray);
+    }
+
+    /* Writes the table in the format of HomogenNumericTable with the values of the common type of the features */
+    void serialHomogenData(InputDataArchive *arch)
+    {
+        switch (getHomogenIndexType())
+        {
+        case data_feature_utils::DAAL_FLOAT32: serialHomogenDataT<float> (arch); break;
+        case data_feature_utils::DAAL_INT32_S: serialHomogenDataT<int>   (arch); break;
+        default:                               serialHomogenDataT<double>(arch); break;
+        }
+    }
+
+    template<typename T>
+    void serialHomogenDataT(InputDataArchive *arch)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nrows = getNumberOfRows();
+
+        /* The dictionary describes the values of the archive, so it is replaced if the features are converted */
+        services::SharedPtr<NumericTableDictionary> ddict = _ddict;
+        if (!haveFeaturesIndexType(data_feature_utils::getIndexNumType<T>()))
+        {
+            ddict = services::SharedPtr<NumericTableDictionary>(new NumericTableDictionary(ncols));
+            NumericTableFeature df;
+            df.setType<T>();
+            ddict->setAllFeatures(df);
+        }
+
+        StorageLayout layout = aos;
+        arch->setSharedPtrObj(ddict);
+        arch->set(_obsnum);
+        arch->set(layout);
+
+        if (ncols == 0) { return; }
+
+        /* Rows are requested from the Java object in blocks of limited size */
+        size_t blockSize = rawDataBlockSizeInBytes / (ncols * sizeof(T));
+        if (blockSize == 0) { blockSize = 1; }
+
+        for (size_t i = 0; i < nrows; i += blockSize)
+        {
+            size_t nBlockRows = (nrows - i < blockSize ? nrows - i : blockSize);
+            BlockDescriptor<T> block;
+            getBlockOfRows(i, nBlockRows, readOnly, block);
+            arch->set(block.getBlockPtr(), nBlockRows * ncols);
+            releaseBlockOfRows(block);
+        }
+    }
+
+    /* Returns the type of the values written to the archive: the type shared by all features
+       if it is float, double or int, and double otherwise */
+    int getHomogenIndexType()
+    {
+        size_t ncols = getNumberOfColumns();
+        if (ncols == 0) { return data_feature_utils::DAAL_FLOAT64; }
+
+        int indexType = (*_ddict)[0].indexType;
+        if ((indexType == data_feature_utils::DAAL_FLOAT32 || indexType == data_feature_utils::DAAL_INT32_S) &&
+            haveFeaturesIndexType(indexType))
+        {
+            return indexType;
+        }
+        return data_feature_utils::DAAL_FLOAT64;
+    }
+
+    bool haveFeaturesIndexType(int indexType)
+    {
+        size_t ncols = getNumberOfColumns();
+        for (size_t i = 0; i < ncols; i++)
+        {
+            if ((*_ddict)[i].indexType != indexType) { return false; }
+        }
+        return true;
+    }
+
+    template<typename Archive, bool onDeserialize>
+    void serialJavaObject(Archive *arch)
+    {
         if (!onDeserialize)
         {
             _tls local_tls = tls.local();
@@ -215,6 +328,10 @@ public:
             {
                 this->_errors->add(services::ErrorCouldntCreateGlobalReferenceToJavaObject);
             }
+            else
+            {
+                createJavaClassRef(local_tls.jenv);
+            }
             daal::services::daal_free(ptr);
             tls.local() = local_tls;
         }
@@ -296,7 +413,7 @@ public:
         block.setDetails( 0, idx, rwFlag );
 
         /* Get JNI interface pointer for current thread */
-        status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
+        status = attachCurrentThread(local_tls);
         if(status != JNI_OK) { this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM); return; }
 
         local_tls.is_attached = true;
@@ -308,8 +425,8 @@ public:
 
         void *buf = block.getBlockPtr();
 
-        /* Get class associated with Java object */
-        local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
+        /* Get class associated with Java object, the reference is created once per table */
+        local_tls.jcls = jJavaClass;
         if(local_tls.jcls == NULL)
         {
             this->_errors->add(services::ErrorCouldntFindClassForJavaObject);
@@ -317,8 +434,7 @@ public:
         }
 
         /* Get ID of the 'getBlockOfRows' method of the Java class */
-        jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                        javaMethodSignature);
+        jmethodID jmeth = getMethodID(local_tls.jenv, javaMethodName, javaMethodSignature);
         if(jmeth == NULL)
         {
             services::SharedPtr<services::Error> e(new services::Error(services::ErrorCouldntFindJavaMethod));
@@ -328,24 +444,23 @@ public:
         }
 
         /* Call 'getBlockOfRows' Java method */
-        local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer( buf, bufferSize);
-        local_tls.jbuf = (local_tls.jenv)->CallObjectMethod(jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, local_tls.jbuf);
+        jobject jbuf = (local_tls.jenv)->NewDirectByteBuffer( buf, bufferSize);
+        local_tls.jbuf = (local_tls.jenv)->CallObjectMethod(jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, jbuf);
+
+        void *javaBuf = (local_tls.jenv)->GetDirectBufferAddress(local_tls.jbuf);
 
-        buf = (local_tls.jenv)->GetDirectBufferAddress(local_tls.jbuf);
+        /* Local references of the native threads are not freed until the threads detach from Java VM */
+        (local_tls.jenv)->DeleteLocalRef(jbuf);
+        if(javaBuf == buf)
+        {
+            (local_tls.jenv)->DeleteLocalRef(local_tls.jbuf);
+            local_tls.jbuf = NULL;
+        }
+        buf = javaBuf;
 
         tls.local() = local_tls;
 
         block.setPtr( (T *)buf, ncols, nrows );
-
-        if(!local_tls.is_main_thread)
-        {
-            status = jvm->DetachCurrentThread();
-            if(status != JNI_OK)
-            {
-                this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-                return;
-            }
-        }
     }
 
     template<typename T>
@@ -357,22 +472,21 @@ public:
         if(rwFlag == writeOnly)
         {
             /* Get JNI interface pointer for current thread */
-            status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
+            status = attachCurrentThread(local_tls);
             if(status != JNI_OK)
             {
                 this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
             }
 
-            /* Get class associated with Java object */
-            local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
+            /* Get class associated with Java object, the reference is created once per table */
+            local_tls.jcls = jJavaClass;
             if(local_tls.jcls == NULL)
             {
                 this->_errors->add(services::ErrorCouldntFindClassForJavaObject);
             }
 
             /* Get ID of the 'releaseBlockOfRows' method of the Java class */
-            jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                            "(JJLjava/nio/ByteBuffer;)V");
+            jmethodID jmeth = getMethodID(local_tls.jenv, javaMethodName, "(JJLjava/nio/ByteBuffer;)V");
             if(jmeth == NULL)
             {
                 services::SharedPtr<services::Error> e(new services::Error(services::ErrorCouldntFindJavaMethod));
@@ -382,20 +496,13 @@ public:
 
             size_t ncols = _ddict->getNumberOfFeatures();
             size_t bufferSize = nrows * ncols * sizeof(T);
-            local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer(buf, bufferSize);
+            jobject jbuf = (local_tls.jenv)->NewDirectByteBuffer(buf, bufferSize);
 
             /* Call 'releaseBlockOfRows' Java method */
             (local_tls.jenv)->CallObjectMethod(
-                jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, local_tls.jbuf, rwFlag);
+                jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, jbuf, rwFlag);
 
-            if(!local_tls.is_main_thread)
-            {
-                status = jvm->DetachCurrentThread();
-                if(status != JNI_OK)
-                {
-                    this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-                }
-            }
+            (local_tls.jenv)->DeleteLocalRef(jbuf);
         }
 
         tls.local() = local_tls;
@@ -409,28 +516,30 @@ public:
         if(block.getRWFlag() == writeOnly)
         {
             /* Get JNI interface pointer for current thread */
-            status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
+            status = attachCurrentThread(local_tls);
             if(status != JNI_OK)
             {
                 this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
                 return;
             }
 
-            /* Get class associated with Java object */
-            local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
+            /* Get class associated with Java object, the reference is created once per table */
+            local_tls.jcls = jJavaClass;
             if(local_tls.jcls == NULL)
             {
                 this->_errors->add(services::ErrorCouldntFindClassForJavaObject);
+                releaseJavaBufferRef(local_tls);
                 return;
             }
 
             /* Get ID of the 'releaseBlockOfRows' method of the Java class */
-            jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName, "(JJLjava/nio/ByteBuffer;)V");
+            jmethodID jmeth = getMethodID(local_tls.jenv, javaMethodName, "(JJLjava/nio/ByteBuffer;)V");
             if(jmeth == NULL)
             {
                 services::SharedPtr<services::Error> e(new services::Error(services::ErrorCouldntFindJavaMethod));
                 e->addStringDetail(services::Method, services::String(javaMethodName));
                 this->_errors->add(e);
+                releaseJavaBufferRef(local_tls);
                 return;
             }
 
@@ -438,24 +547,16 @@ public:
             size_t nrows = block.getNumberOfRows();
             size_t ncols = _ddict->getNumberOfFeatures();
             size_t bufferSize = nrows * ncols * sizeof(T);
-            local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
+            jobject jbuf = (local_tls.jenv)->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
 
             /* Call 'releaseBlockOfRows' Java method */
             (local_tls.jenv)->CallObjectMethod(
-                jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, local_tls.jbuf, block.getRWFlag());
+                jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, jbuf, block.getRWFlag());
 
-            if(!local_tls.is_main_thread)
-            {
-                status = jvm->DetachCurrentThread();
-                if(status != JNI_OK)
-                {
-                    this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-                    return;
-                }
-            }
+            (local_tls.jenv)->DeleteLocalRef(jbuf);
         }
 
-        tls.local() = local_tls;
+        releaseJavaBufferRef(local_tls);
         block.setDetails( 0, 0, 0 );
     }
 
@@ -470,7 +571,7 @@ public:
         block.setDetails( feature_idx, idx, rwFlag );
 
         /* Get JNI interface pointer for current thread */
-        status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
+        status = attachCurrentThread(local_tls);
         if(status != JNI_OK)
         {
             this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
@@ -485,8 +586,8 @@ public:
 
         void *buf = block.getBlockPtr();
 
-        /* Get class associated with Java object */
-        local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
+        /* Get class associated with Java object, the reference is created once per table */
+        local_tls.jcls = jJavaClass;
         if(local_tls.jcls == NULL)
         {
             this->_errors->add(services::ErrorCouldntFindClassForJavaObject);
@@ -494,8 +595,7 @@ public:
         }
 
         /* Get ID of the 'getBlockOfRows' method of the Java class */
-        jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                        javaMethodSignature);
+        jmethodID jmeth = getMethodID(local_tls.jenv, javaMethodName, javaMethodSignature);
         if(jmeth == NULL)
         {
             services::SharedPtr<services::Error> e(new services::Error(services::ErrorCouldntFindJavaMethod));
@@ -505,12 +605,21 @@ public:
         }
 
         /* Call 'getBlockOfRows' Java method */
-        local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer(buf, bufferSize);
+        jobject jbuf = (local_tls.jenv)->NewDirectByteBuffer(buf, bufferSize);
 
         local_tls.jbuf = (local_tls.jenv)->CallObjectMethod(
-                             jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows, local_tls.jbuf);
+                             jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows, jbuf);
 
-        buf = (local_tls.jenv)->GetDirectBufferAddress(local_tls.jbuf);
+        void *javaBuf = (local_tls.jenv)->GetDirectBufferAddress(local_tls.jbuf);
+
+        /* Local references of the native threads are not freed until the threads detach from Java VM */
+        (local_tls.jenv)->DeleteLocalRef(jbuf);
+        if(javaBuf == buf)
+        {
+            (local_tls.jenv)->DeleteLocalRef(local_tls.jbuf);
+            local_tls.jbuf = NULL;
+        }
+        buf = javaBuf;
 
         tls.local() = local_tls;
 
@@ -526,22 +635,21 @@ public:
         {
             _tls local_tls = tls.local();
             /* Get JNI interface pointer for current thread */
-            status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
+            status = attachCurrentThread(local_tls);
             if(status != JNI_OK)
             {
                 this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
             }
 
-            /* Get class associated with Java object */
-            local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
+            /* Get class associated with Java object, the reference is created once per table */
+            local_tls.jcls = jJavaClass;
             if(local_tls.jcls == NULL)
             {
                 this->_errors->add(services::ErrorCouldntFindClassForJavaObject);
             }
 
             /* Get ID of the 'releaseBlockOfRows' method of the Java class */
-            jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                            "(JJJLjava/nio/ByteBuffer;)V");
+            jmethodID jmeth = getMethodID(local_tls.jenv, javaMethodName, "(JJJLjava/nio/ByteBuffer;)V");
             if(jmeth == NULL)
             {
                 services::SharedPtr<services::Error> e(new services::Error(services::ErrorCouldntFindJavaMethod));
@@ -550,11 +658,13 @@ public:
             }
 
             size_t bufferSize = nrows * sizeof(T);
-            local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer(buf, bufferSize);
+            jobject jbuf = (local_tls.jenv)->NewDirectByteBuffer(buf, bufferSize);
 
             /* Call 'releaseBlockOfRows' Java method */
             (local_tls.jenv)->CallObjectMethod(
-                jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows, local_tls.jbuf, rwFlag);
+                jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows, jbuf, rwFlag);
+
+            (local_tls.jenv)->DeleteLocalRef(jbuf);
 
             tls.local() = local_tls;
         }
@@ -564,33 +674,34 @@ public:
     void releaseTFeature(BlockDescriptor<T> &block, const char *javaMethodName)
     {
         jint status = JNI_OK;
+        _tls local_tls = tls.local();
         if(block.getRWFlag() == writeOnly)
         {
-            _tls local_tls = tls.local();
             /* Get JNI interface pointer for current thread */
-            status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
+            status = attachCurrentThread(local_tls);
             if(status != JNI_OK)
             {
                 this->_errors->add(services::ErrorCouldntAttachCurrentThreadToJavaVM);
                 return;
             }
 
-            /* Get class associated with Java object */
-            local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
+            /* Get class associated with Java object, the reference is created once per table */
+            local_tls.jcls = jJavaClass;
             if(local_tls.jcls == NULL)
             {
                 this->_errors->add(services::ErrorCouldntFindClassForJavaObject);
+                releaseJavaBufferRef(local_tls);
                 return;
             }
 
             /* Get ID of the 'releaseBlockOfRows' method of the Java class */
-            jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                            "(JJJLjava/nio/ByteBuffer;)V");
+            jmethodID jmeth = getMethodID(local_tls.jenv, javaMethodName, "(JJJLjava/nio/ByteBuffer;)V");
             if(jmeth == NULL)
             {
                 services::SharedPtr<services::Error> e(new services::Error(services::ErrorCouldntFindJavaMethod));
                 e->addStringDetail(services::Method, services::String(javaMethodName));
                 this->_errors->add(e);
+                releaseJavaBufferRef(local_tls);
                 return;
             }
 
@@ -599,14 +710,16 @@ public:
             size_t feature_idx = block.getColumnsOffset();
 
             size_t bufferSize = nrows * sizeof(T);
-            local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
+            jobject jbuf = (local_tls.jenv)->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
 
             /* Call 'releaseBlockOfRows' Java method */
             (local_tls.jenv)->CallObjectMethod( jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows,
-                                                local_tls.jbuf, block.getRWFlag());
+                                                jbuf, block.getRWFlag());
 
-            tls.local() = local_tls;
+            (local_tls.jenv)->DeleteLocalRef(jbuf);
         }
+
+        releaseJavaBufferRef(local_tls);
         block.setDetails( 0, 0, 0 );
     }
 
@@ -638,8 +751,13 @@ public:
         return globalDaalContext.local();
     }
 
+    /**
+     *  Returns Java object associated with this C++ object
+     */
     jobject getJavaObject() { return jJavaNumTable; }
 protected:
+    static const size_t rawDataBlockSizeInBytes = 16 * 1024 * 1024;
+
     struct _tls
     {
         JNIEnv *jenv;    // JNI interface poiner
@@ -657,9 +775,106 @@ protected:
             is_attached = false;
         }
     };
+
+    /**
+     *  Returns JNI interface pointer for the current thread.
+     *  Native threads are attached to Java VM as daemons once and stay attached until they exit,
+     *  so the kernels that access the table from many threads do not attach to Java VM on every block
+     */
+    jint attachCurrentThread(_tls &local_tls)
+    {
+        if(local_tls.is_main_thread)
+        {
+            return jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
+        }
+
+        if(jvm->GetEnv((void **)(&(local_tls.jenv)), JNI_VERSION_1_2) == JNI_OK) { return JNI_OK; }
+
+        jint status = jvm->AttachCurrentThreadAsDaemon((void **)(&(local_tls.jenv)), NULL);
+        if(status == JNI_OK)
+        {
+            static thread_local DaemonThreadDetacher detacher;
+            detacher.jvm = jvm;
+        }
+        return status;
+    }
+
+    /**
+     *  Frees the reference to the Java buffer that the get method keeps while the block refers to the memory of the buffer.
+     *  Called when the block is released in any mode
+     */
+    void releaseJavaBufferRef(_tls &local_tls)
+    {
+        if(local_tls.jbuf && local_tls.jenv)
+        {
+            (local_tls.jenv)->DeleteLocalRef(local_tls.jbuf);
+        }
+        local_tls.jbuf = NULL;
+        tls.local() = local_tls;
+    }
+
+    /**
+     *  Returns ID of the method of the Java class associated with this table.
+     *  Method IDs are valid in all threads and are looked up once per table
+     */
+    jmethodID getMethodID(JNIEnv *jenv, const char *javaMethodName, const char *javaMethodSignature)
+    {
+        size_t nMethods = nCachedMethods;
+        for(size_t i = 0; i < nMethods; i++)
+        {
+            if(!strcmp(methodCache[i].name, javaMethodName) && !strcmp(methodCache[i].signature, javaMethodSignature))
+            {
+                return methodCache[i].id;
+            }
+        }
+
+        jmethodID jmeth = jenv->GetMethodID(jJavaClass, javaMethodName, javaMethodSignature);
+        if(jmeth == NULL) { return NULL; }
+
+        tbb::spin_mutex::scoped_lock lock(methodCacheMutex);
+        nMethods = nCachedMethods;
+        if(nMethods < maxCachedMethods)
+        {
+            methodCache[nMethods].name      = javaMethodName;
+            methodCache[nMethods].signature = javaMethodSignature;
+            methodCache[nMethods].id        = jmeth;
+            nCachedMethods = nMethods + 1;
+        }
+        return jmeth;
+    }
+
+    void createJavaClassRef(JNIEnv *jenv)
+    {
+        jclass jcls = jenv->GetObjectClass(jJavaNumTable);
+        if(jcls != NULL)
+        {
+            jJavaClass = (jclass)jenv->NewGlobalRef(jcls);
+            jenv->DeleteLocalRef(jcls);
+        }
+    }
+
+    struct DaemonThreadDetacher
+    {
+        JavaVM *jvm;
+        DaemonThreadDetacher() : jvm(NULL) {}
+        ~DaemonThreadDetacher() { if(jvm != NULL) { jvm->DetachCurrentThread(); } }
+    };
+
+    struct CachedMethod
+    {
+        const char *name;
+        const char *signature;
+        jmethodID id;
+    };
+    static const size_t maxCachedMethods = 32;
+
     tbb::enumerable_thread_specific<_tls> tls;  /**< Thread local storage */
     jobject jJavaNumTable;                      /**< Java object associated with this C++ object */
     JavaVM *jvm;                                /**< Java VM interface function table */
+    jclass jJavaClass;                          /**< Java class associated with this C++ object */
+    CachedMethod methodCache[maxCachedMethods]; /**< IDs of the methods of the Java class */
+    tbb::atomic<size_t> nCachedMethods;         /**< Number of the method IDs stored in the cache */
+    tbb::spin_mutex methodCacheMutex;
 
 private:
     static JavaVM *globalJavaVM;
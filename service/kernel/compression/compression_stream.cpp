@@ -22,6 +22,11 @@
 */
 
 #include "compression_stream.h"
+#include "zlibcompression.h"
+#include "bzip2compression.h"
+#include "lzocompression.h"
+#include "rlecompression.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -475,5 +480,682 @@ size_t DecompressionStream::getDecompressedDataSize()
     return _decompressedDataSize;
 }
 
+//chunked stream layout
+static const DAAL_UINT64 chunkedStreamSignature = 0x314B4E4843414144ULL;
+static const size_t chunkedStreamHeaderSize     = 2 * sizeof(DAAL_UINT64);
+static const size_t chunkedStreamIndexEntrySize = 2 * sizeof(DAAL_UINT64);
+static const size_t chunkOutputReserve          = 1024;
+
+typedef services::Collection<services::SharedPtr<services::ErrorCollection> > ErrorCollections;
+typedef services::Collection<size_t> RawSizes;
+
+template<CompressionMethod method>
+static CompressionBlock *compressChunk(Compressor<method> *prototype, CompressionBlock *inBlock,
+                                       services::SharedPtr<services::ErrorCollection> &errors)
+{
+    Compressor<method> compr;
+    compr.parameter = prototype->parameter;
+
+    size_t capacity = inBlock->getWriteOffset() + chunkOutputReserve;
+    CompressionBlock *outBlock = new CompressionBlock(capacity);
+    if(outBlock->getPtr() == NULL)
+    {
+        delete outBlock;
+        errors = services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection());
+        errors->add(services::ErrorMemoryAllocationFailed);
+        return NULL;
+    }
+
+    compr.setInputDataBlock(inBlock->getPtr(), inBlock->getWriteOffset(), 0);
+
+    size_t used = 0;
+    do
+    {
+        if(used == capacity)
+        {
+            CompressionBlock *tmpBlock = new CompressionBlock(2 * capacity);
+            if(tmpBlock->getPtr() == NULL)
+            {
+                delete tmpBlock;
+                delete outBlock;
+                errors = services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection());
+                errors->add(services::ErrorMemoryAllocationFailed);
+                return NULL;
+            }
+            daal::services::daal_memcpy_s((void *)tmpBlock->getPtr(), 2 * capacity, (void *)outBlock->getPtr(), used);
+            delete outBlock;
+            outBlock = tmpBlock;
+            capacity *= 2;
+        }
+        compr.run(outBlock->getPtr(), capacity - used, used);
+        if(compr.getErrors()->size() != 0)
+        {
+            delete outBlock;
+            errors = compr.getErrors();
+            return NULL;
+        }
+        used += compr.getUsedOutputDataBlockSize();
+    }
+    while(compr.isOutputDataBlockFull());
+
+    outBlock->setWriteOffset(used);
+    outBlock->setSize(used);
+    outBlock->setComprState(compressed);
+    return outBlock;
+}
+
+//parallel compression stream realization
+template<CompressionMethod method>
+ParallelCompressionStream<method>::ParallelCompressionStream(Compressor<method> *compr, size_t chunkSize) :
+    pending(NULL), chunks(NULL), rawSizes(NULL), header(NULL), compressor(NULL), _chunkSize(chunkSize), readPos(0), readOffset(0),
+    _isValid(true), _errors(new services::ErrorCollection())
+{
+    if(compr == NULL || chunkSize == 0)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    compressor = compr;
+    pending  = (void *) new CBC;
+    chunks   = (void *) new CBC;
+    rawSizes = (void *) new RawSizes;
+}
+
+template<CompressionMethod method>
+ParallelCompressionStream<method>::~ParallelCompressionStream()
+{
+    if(pending) { delete (CBC *)pending; }
+    if(chunks) { delete (CBC *)chunks; }
+    if(rawSizes) { delete (RawSizes *)rawSizes; }
+    if(header) { delete (CompressionBlock *)header; }
+}
+
+template<CompressionMethod method>
+void ParallelCompressionStream<method>::compressPendingChunks()
+{
+    CBC &in = *(CBC *)pending;
+    size_t nChunks = in.size();
+    if(nChunks == 0 || !_isValid)
+    {
+        /* The data that follows the failed chunk is not compressed */
+        in.clear();
+        return;
+    }
+
+    CBC out(nChunks);
+    ErrorCollections errors(nChunks);
+    Compressor<method> *prototype = compressor;
+
+    daal::threader_for(nChunks, nChunks, [ =, &in, &out, &errors ](int i)
+    {
+        CompressionBlock *outBlock = compressChunk<method>(prototype, in[i].get(), errors[i]);
+        out[i] = services::SharedPtr<CompressionBlock>(outBlock);
+    } );
+
+    /* The stream ends before the first chunk that failed, so the chunks and their raw sizes follow the input.
+       The data after the failed chunk is dropped and the stream does not accept new data */
+    for(size_t i = 0; i < nChunks; i++)
+    {
+        if(errors[i])
+        {
+            this->_errors->add(errors[i]);
+            this->_errors->add(services::ErrorChunkedStreamInvalid);
+            _isValid = false;
+            break;
+        }
+        (*(CBC *)chunks).push_back(out[i]);
+        (*(RawSizes *)rawSizes).push_back(in[i]->getWriteOffset());
+    }
+    in.clear();
+}
+
+template<CompressionMethod method>
+void ParallelCompressionStream<method>::push_back(DataBlock *block)
+{
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    size_t inSize = block->getSize();
+    if ( inSize == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    if ( compressor == NULL )
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    if ( !_isValid )
+    {
+        this->_errors->add(services::ErrorChunkedStreamInvalid);
+        return;
+    }
+    //end checkParams;
+
+    if(header)
+    {
+        if(readOffset != 0)
+        {
+            /* Chunked stream cannot be extended while it is being read */
+            this->_errors->add(services::ErrorIncorrectParameter);
+            return;
+        }
+        /* Chunk index is rebuilt on the next read */
+        delete (CompressionBlock *)header;
+        header = NULL;
+    }
+
+    CBC &in = *(CBC *)pending;
+    byte *blockPtr = block->getPtr();
+    size_t inOffset = 0;
+    bool hasExternalChunks = false;
+
+    /* Fill the incomplete chunk left by the previous push_back */
+    if(in.size() > 0 && in[in.size() - 1]->getAllocState() == internallocated &&
+       in[in.size() - 1]->getWriteOffset() < _chunkSize)
+    {
+        CompressionBlock *tail = in[in.size() - 1].get();
+        size_t tailOffset = tail->getWriteOffset();
+        size_t copySize = _chunkSize - tailOffset < inSize ? _chunkSize - tailOffset : inSize;
+
+        daal::services::daal_memcpy_s((void *)(tail->getPtr() + tailOffset), copySize, (void *)blockPtr, copySize);
+
+        tail->setWriteOffset(tailOffset + copySize);
+        inOffset += copySize;
+    }
+
+    /* Complete chunks are compressed directly from the input block */
+    while(inSize - inOffset >= _chunkSize)
+    {
+        in.push_back(services::SharedPtr<CompressionBlock>(new CompressionBlock(blockPtr + inOffset, _chunkSize)));
+        inOffset += _chunkSize;
+        hasExternalChunks = true;
+    }
+
+    if(inOffset < inSize)
+    {
+        CompressionBlock *tail = new CompressionBlock(_chunkSize);
+        if(tail->getPtr() == NULL)
+        {
+            delete tail;
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        size_t copySize = inSize - inOffset;
+        daal::services::daal_memcpy_s((void *)tail->getPtr(), _chunkSize, (void *)(blockPtr + inOffset), copySize);
+        tail->setWriteOffset(copySize);
+        in.push_back(services::SharedPtr<CompressionBlock>(tail));
+    }
+
+    /* Chunks referencing the input block must be compressed before the block is released.
+       Internal chunks are accumulated until there are enough of them to occupy all threads */
+    size_t nComplete = in.size() - (in[in.size() - 1]->getWriteOffset() < _chunkSize ? 1 : 0);
+    if(hasExternalChunks || nComplete >= (size_t)daal::threader_get_threads_number())
+    {
+        if(in[in.size() - 1]->getWriteOffset() < _chunkSize)
+        {
+            /* Keep the incomplete chunk pending */
+            services::SharedPtr<CompressionBlock> tail = in[in.size() - 1];
+            in.erase(in.size() - 1);
+            compressPendingChunks();
+            in.push_back(tail);
+        }
+        else
+        {
+            compressPendingChunks();
+        }
+    }
+}
+
+template<CompressionMethod method>
+void ParallelCompressionStream<method>::finalizeStream()
+{
+    if(header)
+    {
+        return;
+    }
+    if(compressor == NULL)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+
+    compressPendingChunks();
+
+    CBC &out = *(CBC *)chunks;
+    size_t nChunks = out.size();
+    size_t headerSize = chunkedStreamHeaderSize + nChunks * chunkedStreamIndexEntrySize;
+
+    CompressionBlock *headerBlock = new CompressionBlock(headerSize);
+    if(headerBlock->getPtr() == NULL)
+    {
+        delete headerBlock;
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    DAAL_UINT64 *headerPtr = (DAAL_UINT64 *)headerBlock->getPtr();
+    headerPtr[0] = chunkedStreamSignature;
+    headerPtr[1] = (DAAL_UINT64)nChunks;
+    for(size_t i = 0; i < nChunks; i++)
+    {
+        headerPtr[2 + 2 * i]     = (DAAL_UINT64)(*(RawSizes *)rawSizes)[i];
+        headerPtr[2 + 2 * i + 1] = (DAAL_UINT64)out[i]->getWriteOffset();
+    }
+    headerBlock->setWriteOffset(headerSize);
+    headerBlock->setComprState(compressed);
+
+    header = (void *)headerBlock;
+    readPos = 0;
+    readOffset = 0;
+}
+
+template<CompressionMethod method>
+void ParallelCompressionStream<method>::resetStream()
+{
+    (*(CBC *)chunks).clear();
+    (*(RawSizes *)rawSizes).clear();
+    if(header) { delete (CompressionBlock *)header; }
+    header = NULL;
+    readPos = 0;
+    readOffset = 0;
+}
+
+template<CompressionMethod method>
+size_t ParallelCompressionStream<method>::getNumberOfChunks()
+{
+    finalizeStream();
+    return (chunks ? (*(CBC *)chunks).size() : 0);
+}
+
+template<CompressionMethod method>
+size_t ParallelCompressionStream<method>::getCompressedDataSize()
+{
+    finalizeStream();
+    if(!header)
+    {
+        return 0;
+    }
+
+    size_t compressedDataSize = ((CompressionBlock *)header)->getWriteOffset();
+    for(size_t i = 0; i < (*(CBC *)chunks).size(); i++)
+    {
+        compressedDataSize += (*(CBC *)chunks)[i]->getWriteOffset();
+    }
+    return compressedDataSize - readOffset;
+}
+
+template<CompressionMethod method>
+services::SharedPtr<DataBlockCollection> ParallelCompressionStream<method>::getCompressedBlocksCollection()
+{
+    finalizeStream();
+
+    services::SharedPtr<DataBlockCollection> retBlocks = services::SharedPtr<DataBlockCollection>(new DataBlockCollection);
+    if(!header)
+    {
+        return retBlocks;
+    }
+
+    retBlocks->push_back(services::SharedPtr<DataBlock>((CompressionBlock *)header));
+    header = NULL;
+    for(size_t i = 0; i < (*(CBC *)chunks).size(); i++)
+    {
+        retBlocks->push_back(services::SharedPtr<DataBlock>((*(CBC *)chunks)[i]));
+    }
+    resetStream();
+    return retBlocks;
+}
+
+template<CompressionMethod method>
+size_t ParallelCompressionStream<method>::copyCompressedArray(byte *ptr, size_t size)
+{
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    finalizeStream();
+    if(!header)
+    {
+        return 0;
+    }
+
+    CBC &out = *(CBC *)chunks;
+    size_t readSize = 0;
+
+    /* readPos == 0 refers to the header block, readPos == i + 1 to the i-th chunk */
+    while(readSize < size && readPos <= out.size())
+    {
+        CompressionBlock *current = (readPos == 0 ? (CompressionBlock *)header : out[readPos - 1].get());
+        size_t availSize = current->getWriteOffset() - current->getReadOffset();
+        size_t rs = size - readSize > availSize ? availSize : size - readSize;
+
+        daal::services::daal_memcpy_s((void *)(ptr + readSize), rs, (void *)(current->getPtr() + current->getReadOffset()), rs);
+
+        current->setReadOffset(current->getReadOffset() + rs);
+        readSize += rs;
+        readOffset += rs;
+
+        if(current->getReadOffset() == current->getWriteOffset())
+        {
+            readPos++;
+        }
+    }
+
+    if(readPos > out.size())
+    {
+        resetStream();
+    }
+    return readSize;
+}
+
+//parallel decompression stream realization
+template<CompressionMethod method>
+ParallelDecompressionStream<method>::ParallelDecompressionStream(Decompressor<method> *decompr) :
+    _data(NULL), _dataSize(0), _dataCapacity(0), _nChunks(0), _rawOffsets(NULL), _chunkOffsets(NULL), decompressor(NULL),
+    _errors(new services::ErrorCollection())
+{
+    if(decompr == NULL)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    decompressor = decompr;
+}
+
+template<CompressionMethod method>
+ParallelDecompressionStream<method>::~ParallelDecompressionStream()
+{
+    daal::services::daal_free(_data);
+    daal::services::daal_free(_rawOffsets);
+    daal::services::daal_free(_chunkOffsets);
+}
+
+template<CompressionMethod method>
+void ParallelDecompressionStream<method>::push_back(DataBlock *block)
+{
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    size_t inSize = block->getSize();
+    if ( inSize == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    if(_dataSize + inSize > _dataCapacity)
+    {
+        size_t newCapacity = (2 * _dataCapacity > _dataSize + inSize ? 2 * _dataCapacity : _dataSize + inSize);
+        byte *newData = (byte *)daal::services::daal_malloc(newCapacity);
+        if(newData == NULL)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        if(_data)
+        {
+            daal::services::daal_memcpy_s((void *)newData, newCapacity, (void *)_data, _dataSize);
+            daal::services::daal_free(_data);
+        }
+        _data = newData;
+        _dataCapacity = newCapacity;
+    }
+
+    daal::services::daal_memcpy_s((void *)(_data + _dataSize), _dataCapacity - _dataSize, (void *)block->getPtr(), inSize);
+    _dataSize += inSize;
+}
+
+template<CompressionMethod method>
+bool ParallelDecompressionStream<method>::readIndex()
+{
+    if(_rawOffsets)
+    {
+        return true;
+    }
+    if(_dataSize < chunkedStreamHeaderSize)
+    {
+        return false;
+    }
+
+    const DAAL_UINT64 *headerPtr = (const DAAL_UINT64 *)_data;
+    if(headerPtr[0] != chunkedStreamSignature)
+    {
+        this->_errors->add(services::ErrorChunkedStreamDataFormat);
+        return false;
+    }
+
+    /* The number of the chunks is read from the stream, so it is compared with the number of the index entries
+       received so far before the size of the index is computed */
+    const DAAL_UINT64 nChunksInHeader = headerPtr[1];
+    if(nChunksInHeader > (DAAL_UINT64)((_dataSize - chunkedStreamHeaderSize) / chunkedStreamIndexEntrySize))
+    {
+        return false;
+    }
+    size_t nChunks = (size_t)nChunksInHeader;
+    size_t headerSize = chunkedStreamHeaderSize + nChunks * chunkedStreamIndexEntrySize;
+
+    _rawOffsets   = (size_t *)daal::services::daal_malloc((nChunks + 1) * sizeof(size_t));
+    _chunkOffsets = (size_t *)daal::services::daal_malloc((nChunks + 1) * sizeof(size_t));
+    if(_rawOffsets == NULL || _chunkOffsets == NULL)
+    {
+        daal::services::daal_free(_rawOffsets);
+        daal::services::daal_free(_chunkOffsets);
+        _rawOffsets = NULL;
+        _chunkOffsets = NULL;
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return false;
+    }
+
+    _rawOffsets[0] = 0;
+    _chunkOffsets[0] = headerSize;
+    const size_t maxSize = (size_t)-1;
+    bool isValid = true;
+    for(size_t i = 0; i < nChunks && isValid; i++)
+    {
+        const DAAL_UINT64 rawSize   = headerPtr[2 + 2 * i];
+        const DAAL_UINT64 chunkSize = headerPtr[2 + 2 * i + 1];
+        isValid = (rawSize   <= (DAAL_UINT64)(maxSize - _rawOffsets[i]) &&
+                   chunkSize <= (DAAL_UINT64)(maxSize - _chunkOffsets[i]));
+        if(isValid)
+        {
+            _rawOffsets[i + 1]   = _rawOffsets[i]   + (size_t)rawSize;
+            _chunkOffsets[i + 1] = _chunkOffsets[i] + (size_t)chunkSize;
+        }
+    }
+    if(!isValid)
+    {
+        daal::services::daal_free(_rawOffsets);
+        daal::services::daal_free(_chunkOffsets);
+        _rawOffsets = NULL;
+        _chunkOffsets = NULL;
+        this->_errors->add(services::ErrorChunkedStreamDataFormat);
+        return false;
+    }
+    _nChunks = nChunks;
+    return true;
+}
+
+template<CompressionMethod method>
+size_t ParallelDecompressionStream<method>::getNumberOfChunks()
+{
+    return (readIndex() ? _nChunks : 0);
+}
+
+template<CompressionMethod method>
+size_t ParallelDecompressionStream<method>::getDecompressedChunkSize(size_t chunk)
+{
+    if(!readIndex())
+    {
+        return 0;
+    }
+    if(chunk >= _nChunks)
+    {
+        this->_errors->add(services::ErrorIncorrectIndex);
+        return 0;
+    }
+    return _rawOffsets[chunk + 1] - _rawOffsets[chunk];
+}
+
+template<CompressionMethod method>
+size_t ParallelDecompressionStream<method>::getDecompressedDataSize()
+{
+    return (readIndex() ? _rawOffsets[_nChunks] : 0);
+}
+
+template<CompressionMethod method>
+bool ParallelDecompressionStream<method>::decompressChunkImpl(size_t chunk, byte *outPtr)
+{
+    size_t rawSize = _rawOffsets[chunk + 1] - _rawOffsets[chunk];
+    size_t compressedSize = _chunkOffsets[chunk + 1] - _chunkOffsets[chunk];
+
+    Decompressor<method> decompr;
+    decompr.parameter = decompressor->parameter;
+    decompr.setInputDataBlock(_data, compressedSize, _chunkOffsets[chunk]);
+
+    size_t used = 0;
+    do
+    {
+        decompr.run(outPtr, rawSize - used, used);
+        if(decompr.getErrors()->size() != 0)
+        {
+            return false;
+        }
+        used += decompr.getUsedOutputDataBlockSize();
+    }
+    while(decompr.isOutputDataBlockFull() && used < rawSize);
+
+    return (used == rawSize);
+}
+
+template<CompressionMethod method>
+size_t ParallelDecompressionStream<method>::decompressChunk(size_t chunk, byte *ptr, size_t size)
+{
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( decompressor == NULL )
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return 0;
+    }
+    //end checkParams;
+
+    size_t rawSize = getDecompressedChunkSize(chunk);
+    if(rawSize == 0)
+    {
+        return 0;
+    }
+    if(size < rawSize)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    if(_dataSize < _chunkOffsets[chunk + 1])
+    {
+        this->_errors->add(services::ErrorChunkedStreamNotFull);
+        return 0;
+    }
+    if(!decompressChunkImpl(chunk, ptr))
+    {
+        this->_errors->add(services::ErrorChunkedStreamDataFormat);
+        return 0;
+    }
+    return rawSize;
+}
+
+template<CompressionMethod method>
+size_t ParallelDecompressionStream<method>::copyDecompressedArray(byte *ptr, size_t size)
+{
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    if ( decompressor == NULL )
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return 0;
+    }
+    //end checkParams;
+
+    if(!readIndex())
+    {
+        this->_errors->add(services::ErrorChunkedStreamNotFull);
+        return 0;
+    }
+    if(_dataSize < _chunkOffsets[_nChunks])
+    {
+        this->_errors->add(services::ErrorChunkedStreamNotFull);
+        return 0;
+    }
+    if(size < _rawOffsets[_nChunks])
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+
+    bool *failed = (bool *)daal::services::daal_malloc(_nChunks * sizeof(bool));
+    if(_nChunks && failed == NULL)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return 0;
+    }
+
+    daal::threader_for(_nChunks, _nChunks, [ =, &failed ](int i)
+    {
+        failed[i] = !decompressChunkImpl(i, ptr + _rawOffsets[i]);
+    } );
+
+    bool status = true;
+    for(size_t i = 0; i < _nChunks; i++)
+    {
+        status = status && !failed[i];
+    }
+    daal::services::daal_free(failed);
+
+    if(!status)
+    {
+        this->_errors->add(services::ErrorChunkedStreamDataFormat);
+        return 0;
+    }
+    return _rawOffsets[_nChunks];
+}
+
+template class ParallelCompressionStream<zlib>;
+template class ParallelCompressionStream<lzo>;
+template class ParallelCompressionStream<rle>;
+template class ParallelCompressionStream<bzip2>;
+
+template class ParallelDecompressionStream<zlib>;
+template class ParallelDecompressionStream<lzo>;
+template class ParallelDecompressionStream<rle>;
+template class ParallelDecompressionStream<bzip2>;
+
 } //namespace data_management
 } //namespace daal